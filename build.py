@@ -28,7 +28,9 @@ class Compile:
         if not self.compile_mode and self.lib_type and self.plam_type and self.hcc_path and self.kconf_dir:
             log_msg('error', 'load config.xml env error')
             sys.exit(0)
-        self.config_file_path = '%s/build/uniproton_config/config_%s'%(self.home_path, self.kconf_dir)
+        # RPROTON_CONFIG_DIR指定时使用其中的defconfig编译，不改动仓库中的配置
+        self.config_file_path = self.UniProton_config_dir if self.UniProton_config_dir else \
+            '%s/build/uniproton_config/config_%s'%(self.home_path, self.kconf_dir)
 
         self.objcopy_path = self.hcc_path
 
@@ -104,8 +106,9 @@ class Compile:
         self.lib_run_type = lib_run_type
         self.make_choice = choice.lower()
         self.make_phase = make_phase
-        self.UniProton_packing_path = UniProton_packing_path if make_phase == "CREATE_CMAKE_FILE" else '%s/output'%self.home_path
+        self.UniProton_packing_path = UniProton_packing_path if UniProton_packing_path else '%s/output'%self.home_path
         self.UniProton_binary_dir = os.getenv('RPROTON_BINARY_DIR')
+        self.UniProton_config_dir = os.getenv('RPROTON_CONFIG_DIR')
         self.UniProton_install_file_option = os.getenv('RPROTON_INSTALL_FILE_OPTION')
         self.UniProton_make_jx = 'VERBOSE=1' if self.UniProton_install_file_option == 'SUPER_BUILD' else 'VERBOSE=1 -j$(nproc)'
         # 当前编译平台信息
@@ -228,7 +231,7 @@ class Compile:
 
     def MakeBuildef(self):
 
-        if not make_buildef(globle.home_path,self.kconf_dir,"CREATE"):
+        if not make_buildef(globle.home_path,self.kconf_dir,"CREATE",self.config_file_path):
             sys.exit(1)
         log_msg('info', 'make_buildef_file.sh %s successfully.' % self.kconf_dir)
 
@@ -11,9 +11,12 @@ from Kconfig2macro import do_cmd
 
 logging.basicConfig(stream=sys.stdout, level=logging.NOTSET) 
 
-def make_buildef(home_path, kconf_dir, choice):
-    kconfig_dir = "{}/build/uniproton_config/config_{}/defconfig".format(home_path,kconf_dir)
-    buildef_file = "{}/build/uniproton_config/config_{}/prt_buildef.h".format(home_path,kconf_dir)
+# config_dir非空时使用该目录下的defconfig，生成的prt_buildef.h也放在该目录
+def make_buildef(home_path, kconf_dir, choice, config_dir=""):
+    if not config_dir:
+        config_dir = "{}/build/uniproton_config/config_{}".format(home_path,kconf_dir)
+    kconfig_dir = "{}/defconfig".format(config_dir)
+    buildef_file = "{}/prt_buildef.h".format(config_dir)
     if choice == "CREATE":
         paras = ["-f", kconfig_dir, "-o", buildef_file]
         if do_cmd(paras, False) != 0:
@@ -96,7 +96,7 @@ else()
     endif()
 endif()
 install(FILES
-    ${PROJECT_SOURCE_DIR}/build/uniproton_config/config_m4/prt_buildef.h
+    ${CONFIG_FILE_PATH}/prt_buildef.h
     DESTINATION ${INSTALL_M4_CORTEX_ARCHIVE_CONFIG_DIR}/cortex_m4/config_m4
 )
 if (NOT "${RPROTON_INSTALL_FILE_OPTION}" STREQUAL "SUPER_BUILD")
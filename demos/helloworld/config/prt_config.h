@@ -72,7 +72,7 @@ extern "C" {
 /* 用户可以创建的最大分区数，取值范围[0,253] */
 #define OS_MEM_MAX_PT_NUM                               10
 /* 私有FSC内存分区起始地址 */
-#define OS_MEM_FSC_PT_ADDR                              (U32)&m_aucMemRegion00[0]
+#define OS_MEM_FSC_PT_ADDR                              (uintptr_t)&m_aucMemRegion00[0]
 /* 私有FSC内存分区大小 */
 #define OS_MEM_FSC_PT_SIZE                              0x00008000
 
@@ -6,6 +6,7 @@
 #include "prt_config.h"
 #include "prt_config_internal.h"
 #include "prt_task.h"
+#include "serial.h"
 #include "test.h"
 
 TskHandle g_testTskHandle;
@@ -63,6 +64,11 @@ U32 PRT_AppInit(void)
 {
     U32 ret;
 
+    ret = PRT_UartRecvInit();
+    if (ret) {
+        return ret;
+    }
+
     ret = OsTestInit();
     if (ret) {
         return ret;
@@ -4,9 +4,15 @@
 #include "securec.h"
 #include "serial.h"
 #include "prt_hwi.h"
+#include "prt_queue.h"
 
 typedef U32 (*PrintFunc)(const char *format, va_list vaList);
 #define OS_MAX_SHOW_LEN 0x200
+#define UART_RECV_STREAM_SIZE 0x400
+#define UART_RECV_TRIGGER_LEVEL 1
+#define UART_RECV_BATCH_LEN 32
+
+static U32 g_uartRecvStream;
 
 U32 uart_recv(U8 *value)
 {
@@ -21,12 +27,39 @@ U32 uart_recv(U8 *value)
     return 0;
 }
 
-void uart_recv_hwi(void) 
+void uart_recv_hwi(void)
 {
-    U8 data;
-    while (uart_recv(&data) == 0) {
+    U8 data[UART_RECV_BATCH_LEN];
+    U32 len = 0;
+    U32 written;
+
+    /* Drain the rx FIFO in batches into the stream buffer, bytes are dropped when it is full */
+    while (uart_recv(&data[len]) == 0) {
         /*Do not printf in this task*/
+        len++;
+        if (len == UART_RECV_BATCH_LEN) {
+            if (g_uartRecvStream != 0) {
+                (void)PRT_QueueStreamWrite(g_uartRecvStream, data, len, &written);
+            }
+            len = 0;
+        }
     }
+
+    if ((len != 0) && (g_uartRecvStream != 0)) {
+        (void)PRT_QueueStreamWrite(g_uartRecvStream, data, len, &written);
+    }
+}
+
+/* Create the uart rx stream buffer, must be called after the queue module is initialized */
+U32 PRT_UartRecvInit(void)
+{
+    return PRT_QueueCreateStream(UART_RECV_STREAM_SIZE, UART_RECV_TRIGGER_LEVEL, &g_uartRecvStream);
+}
+
+/* Read uart rx data in task context, *len is the buf size on input and the bytes read on output */
+U32 PRT_UartRead(U8 *buf, U32 *len, U32 timeOut)
+{
+    return PRT_QueueStreamRead(g_uartRecvStream, buf, len, timeOut);
 }
 
 U32 PRT_UartInit(void)
@@ -52,5 +52,7 @@ extern void printf_resource_init(void);
 extern S32 uart_init(serial_cfg *cfg);
 extern void uart_raw_puts(S32 uart_no, const S8 *str);
 extern S32 uart_busy_poll(S32 hw_uart_no);
+extern U32 PRT_UartRecvInit(void);
+extern U32 PRT_UartRead(U8 *buf, U32 *len, U32 timeOut);
 
 #endif /* __SERIAL_H__ */
\ No newline at end of file
@@ -25,7 +25,11 @@ U32 OsMemConfigReg(void)
 {
     U32 ret;
 
-    ret = OsFscMemInit(OS_MEM_FSC_PT_ADDR, OS_MEM_FSC_PT_SIZE);
+#if defined(OS_OPTION_MEM_TLSF)
+    ret = OsTlsfMemInit((uintptr_t)OS_MEM_FSC_PT_ADDR, OS_MEM_FSC_PT_SIZE);
+#else
+    ret = OsFscMemInit((uintptr_t)OS_MEM_FSC_PT_ADDR, OS_MEM_FSC_PT_SIZE);
+#endif
     if (ret != OS_OK) {
         return ret;
     }
@@ -27,7 +27,7 @@ extern "C" {
 /* ***************************** 配置系统基本信息 ******************************* */
 /* 芯片主频 */
 #define OS_SYS_CLOCK                                    250000000
-/* 用户注册的获取系统时间的函数*/
+/* 用户注册的获取系统时间的函数，为NULL时使用通用定时器计数，主频取CNTFRQ_EL0，OS_SYS_CLOCK不生效 */
 #define OS_SYS_TIME_HOOK                                NULL
 
 /* ***************************** 中断模块配置 ************************** */
@@ -35,7 +35,8 @@ extern "C" {
 #define WORD_PACK(val) (((val) << 24) | ((val) << 16) | ((val) << 8) | (val))
 
 /* UniProton模块注册函数的声明 */
-extern U32 OsFscMemInit(U32 addr, U32 size);
+extern U32 OsFscMemInit(uintptr_t addr, uintptr_t size);
+extern U32 OsTlsfMemInit(uintptr_t addr, uintptr_t size);
 extern U32 OsSysRegister(struct SysModInfo *modInfo);
 extern U32 OsTickRegister(struct TickModInfo *modInfo);
 extern U32 OsTskRegister(struct TskModInfo *modInfo);
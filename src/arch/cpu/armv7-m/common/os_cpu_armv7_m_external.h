@@ -137,6 +137,126 @@ OS_SEC_ALW_INLINE INLINE void OsSpinLockInitInner(volatile uintptr_t *lockVar)
     (void)lockVar;
 }
 
+/*
+ * 描述: 从单向链表栈顶原子地取出一个节点，节点首个字保存下一节点地址，栈空返回NULL。
+ * 异常进入及退出时硬件清除本地独占监视器，被中断打断的STREX失败后重试，中断中可调用
+ */
+OS_SEC_ALW_INLINE INLINE void *OsAtomicStackPop(void **top)
+{
+    void *node;
+    void *next;
+    U32 fail;
+
+    OS_EMBED_ASM(
+        "1: ldrex   %0, [%3]        \n"
+        "   cmp     %0, #0          \n"
+        "   beq     2f              \n"
+        "   ldr     %1, [%0]        \n"
+        "   strex   %2, %1, [%3]    \n"
+        "   cmp     %2, #0          \n"
+        "   bne     1b              \n"
+        "   dmb                     \n"
+        "   b       3f              \n"
+        "2: clrex                   \n"
+        "3:                         \n"
+        : "=&r"(node), "=&r"(next), "=&r"(fail)
+        : "r"(top)
+        : "memory", "cc");
+
+    return node;
+}
+
+/*
+ * 描述: 原子地将节点压入单向链表栈顶，链接字在独占访问之外写入，栈顶变化时重试
+ */
+OS_SEC_ALW_INLINE INLINE void OsAtomicStackPush(void **top, void *node)
+{
+    void *old;
+    void *cur;
+    U32 fail;
+
+    OS_EMBED_ASM(
+        "   dmb                     \n"
+        "1: ldr     %0, [%4]        \n"
+        "   str     %0, [%3]        \n"
+        "   ldrex   %1, [%4]        \n"
+        "   cmp     %1, %0          \n"
+        "   beq     2f              \n"
+        "   clrex                   \n"
+        "   b       1b              \n"
+        "2: strex   %2, %3, [%4]    \n"
+        "   cmp     %2, #0          \n"
+        "   bne     1b              \n"
+        : "=&r"(old), "=&r"(cur), "=&r"(fail)
+        : "r"(node), "r"(top)
+        : "memory", "cc");
+}
+
+/*
+ * 描述: 原子地取走单向链表栈上的全部节点并将栈置空，返回原栈顶，栈空返回NULL
+ */
+OS_SEC_ALW_INLINE INLINE void *OsAtomicStackTake(void **top)
+{
+    void *node;
+    U32 fail;
+
+    OS_EMBED_ASM(
+        "1: ldrex   %0, [%3]        \n"
+        "   strex   %1, %2, [%3]    \n"
+        "   cmp     %1, #0          \n"
+        "   bne     1b              \n"
+        "   dmb                     \n"
+        : "=&r"(node), "=&r"(fail)
+        : "r"(0), "r"(top)
+        : "memory", "cc");
+
+    return node;
+}
+
+/*
+ * 描述: 原子加，返回相加后的值
+ */
+OS_SEC_ALW_INLINE INLINE U32 OsAtomicAdd32(volatile U32 *addr, U32 val)
+{
+    U32 newVal;
+    U32 fail;
+
+    OS_EMBED_ASM(
+        "1: ldrex   %0, [%2]        \n"
+        "   add     %0, %0, %3      \n"
+        "   strex   %1, %0, [%2]    \n"
+        "   cmp     %1, #0          \n"
+        "   bne     1b              \n"
+        : "=&r"(newVal), "=&r"(fail)
+        : "r"(addr), "r"(val)
+        : "memory", "cc");
+
+    return newVal;
+}
+
+/*
+ * 描述: 原子地将*addr更新为其与val中的较大值，用于记录峰值
+ */
+OS_SEC_ALW_INLINE INLINE void OsAtomicMax32(volatile U32 *addr, U32 val)
+{
+    U32 cur;
+    U32 fail;
+
+    OS_EMBED_ASM(
+        "1: ldrex   %0, [%2]        \n"
+        "   cmp     %0, %3          \n"
+        "   bhs     2f              \n"
+        "   strex   %1, %3, [%2]    \n"
+        "   cmp     %1, #0          \n"
+        "   bne     1b              \n"
+        "   b       3f              \n"
+        "2: clrex                   \n"
+        "3:                         \n"
+        : "=&r"(cur), "=&r"(fail)
+        : "r"(addr), "r"(val)
+        : "memory", "cc");
+}
+
 #if (OS_HARDWARE_PLATFORM == OS_CORTEX_M4)
 #include "../cortex-m4/prt_cpu_m4_external.h"
 #endif
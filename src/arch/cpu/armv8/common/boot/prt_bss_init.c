@@ -13,15 +13,15 @@
  * Description: BSS初始化。
  */
 #include "prt_cpu_external.h"
+#include "prt_lib_external.h"
 /*
- * 描述: BSS段初始化
+ * 描述: BSS段初始化，此时MMU及cache未使能，按双字对齐批量写零
  */
 INIT_SEC_L4_TEXT void OsBssInit(void)
 {
     uintptr_t len = (uintptr_t)(&__bss_end__) - (uintptr_t)(&__bss_start__);
-    if (memset_s((void *)&__bss_start__, len, 0, len) != EOK) {
-        OS_GOTO_SYS_ERROR();
-    }
+
+    OsMemSetDword((uintptr_t)&__bss_start__, len, 0);
 
     return;
 }
\ No newline at end of file
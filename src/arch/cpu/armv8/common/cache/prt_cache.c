@@ -0,0 +1,51 @@
+/*
+ * Copyright (c) 2023-2023 Huawei Technologies Co., Ltd. All rights reserved.
+ *
+ * UniProton is licensed under Mulan PSL v2.
+ * You can use this software according to the terms and conditions of the Mulan PSL v2.
+ * You may obtain a copy of Mulan PSL v2 at:
+ *          http://license.coscl.org.cn/MulanPSL2
+ * THIS SOFTWARE IS PROVIDED ON AN "AS IS" BASIS, WITHOUT WARRANTIES OF ANY KIND,
+ * EITHER EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO NON-INFRINGEMENT,
+ * MERCHANTABILITY OR FIT FOR A PARTICULAR PURPOSE.
+ * See the Mulan PSL v2 for more details.
+ * Create: 2023-06-01
+ * Description: 按地址范围的cache维护接口。
+ */
+#include "prt_cpu_external.h"
+
+OS_SEC_L4_TEXT void PRT_DCacheFlush(const void *addr, uintptr_t size)
+{
+    if (size == 0) {
+        return;
+    }
+
+    OsCacheFlushDcache((uintptr_t)addr, size);
+}
+
+OS_SEC_L4_TEXT void PRT_DCacheInv(void *addr, uintptr_t size)
+{
+    if (size == 0) {
+        return;
+    }
+
+    OsCacheInvDcache((uintptr_t)addr, size);
+}
+
+OS_SEC_L4_TEXT void PRT_DCacheFlushInv(void *addr, uintptr_t size)
+{
+    if (size == 0) {
+        return;
+    }
+
+    OsCacheFlushInvDcache((uintptr_t)addr, size);
+}
+
+OS_SEC_L4_TEXT void PRT_ICacheInv(const void *addr, uintptr_t size)
+{
+    if (size == 0) {
+        return;
+    }
+
+    OsCacheInvIcache((uintptr_t)addr, size);
+}
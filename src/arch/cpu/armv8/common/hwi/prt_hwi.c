@@ -16,6 +16,7 @@
 #include "prt_task_external.h"
 #include "prt_irq_external.h"
 #include "prt_hwi_internal.h"
+#include "prt_irqsoff_external.h"
 
 /*
  * 描述: GIC模块初始化
@@ -146,6 +147,12 @@ OS_SEC_L0_TEXT uintptr_t PRT_HwiUnLock(void)
 {
     uintptr_t state = 0;
 
+#if defined(OS_OPTION_IRQSOFF_TRACE)
+    OS_EMBED_ASM("mrs %0, DAIF" : "=r"(state) : : "memory");
+    if ((state & INT_MASK) != 0) {
+        OsIrqsOffTraceRestore((uintptr_t)__builtin_return_address(0));
+    }
+#endif
     OS_EMBED_ASM(
         "mrs %0, DAIF      \n"
         "msr DAIFClr, %1   \n"
@@ -168,6 +175,11 @@ OS_SEC_L0_TEXT uintptr_t PRT_HwiLock(void)
         : "=r"(state)
         : "i"(DAIF_IRQ_BIT)
         : "memory", "cc");
+#if defined(OS_OPTION_IRQSOFF_TRACE)
+    if ((state & INT_MASK) == 0) {
+        OsIrqsOffTraceLock((uintptr_t)__builtin_return_address(0));
+    }
+#endif
     return state & INT_MASK;
 }
 
@@ -177,6 +189,9 @@ OS_SEC_L0_TEXT uintptr_t PRT_HwiLock(void)
 OS_SEC_L0_TEXT void PRT_HwiRestore(uintptr_t intSave)
 {
     if ((intSave & INT_MASK) == 0) {
+#if defined(OS_OPTION_IRQSOFF_TRACE)
+        OsIrqsOffTraceRestore((uintptr_t)__builtin_return_address(0));
+#endif
         OS_EMBED_ASM(
             "msr DAIFClr, %0\n"
             :
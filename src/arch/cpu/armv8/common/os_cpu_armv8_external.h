@@ -99,6 +99,10 @@ extern uintptr_t OsGetSysStackStart(void);
 extern uintptr_t OsGetSysStackEnd(void);
 extern void OsTaskTrap(void);
 extern void OsTskContextLoad(uintptr_t stackPointer);
+extern void OsCacheFlushDcache(uintptr_t addr, uintptr_t size);
+extern void OsCacheInvDcache(uintptr_t addr, uintptr_t size);
+extern void OsCacheFlushInvDcache(uintptr_t addr, uintptr_t size);
+extern void OsCacheInvIcache(uintptr_t addr, uintptr_t size);
 
 /*
  * 描述: 使能IRQ中断
@@ -188,6 +192,31 @@ OS_SEC_ALW_INLINE INLINE uintptr_t OsGetSp(void)
     return sp;
 }
 
+/*
+ * 描述: 读取通用定时器虚拟计数，计数为64位且全局单调，ISB防止读操作被提前执行，无需关中断
+ */
+OS_SEC_ALW_INLINE INLINE U64 OsHwCycleGet64(void)
+{
+    U64 cycle;
+
+    OS_EMBED_ASM("ISB\n"
+                 "MRS  %0, CNTVCT_EL0" : "=r"(cycle) : : "memory");
+
+    return cycle;
+}
+
+/*
+ * 描述: 读取通用定时器计数频率，由启动固件写入CNTFRQ_EL0
+ */
+OS_SEC_ALW_INLINE INLINE U64 OsHwCycleFreqGet(void)
+{
+    U64 freq;
+
+    OS_EMBED_ASM("MRS  %0, CNTFRQ_EL0" : "=r"(freq) : : "memory");
+
+    return freq;
+}
+
 /*
  * 描述: 传入任务切换时的栈地址
  */
@@ -207,4 +236,115 @@ OS_SEC_ALW_INLINE INLINE void OsTaskTrapFastPs(uintptr_t intSave)
     OsTaskTrap();
 }
 
+/*
+ * 描述: 从单向链表栈顶原子地取出一个节点，节点首个字保存下一节点地址，栈空返回NULL。
+ * 独占访问期间被中断打断时，异常返回会清除独占监视器，STXR失败后重试，中断中可调用
+ */
+OS_SEC_ALW_INLINE INLINE void *OsAtomicStackPop(void **top)
+{
+    void *node;
+    void *next;
+    U32 fail;
+
+    OS_EMBED_ASM(
+        "1: ldaxr   %0, [%3]        \n"
+        "   cbz     %0, 2f          \n"
+        "   ldr     %1, [%0]        \n"
+        "   stxr    %w2, %1, [%3]   \n"
+        "   cbnz    %w2, 1b         \n"
+        "   b       3f              \n"
+        "2: clrex                   \n"
+        "3:                         \n"
+        : "=&r"(node), "=&r"(next), "=&r"(fail)
+        : "r"(top)
+        : "memory", "cc");
+
+    return node;
+}
+
+/*
+ * 描述: 原子地将节点压入单向链表栈顶，链接字在独占访问之外写入，栈顶变化时重试
+ */
+OS_SEC_ALW_INLINE INLINE void OsAtomicStackPush(void **top, void *node)
+{
+    void *old;
+    void *cur;
+    U32 fail;
+
+    OS_EMBED_ASM(
+        "1: ldr     %0, [%4]        \n"
+        "   str     %0, [%3]        \n"
+        "   ldxr    %1, [%4]        \n"
+        "   cmp     %1, %0          \n"
+        "   b.eq    2f              \n"
+        "   clrex                   \n"
+        "   b       1b              \n"
+        "2: stlxr   %w2, %3, [%4]   \n"
+        "   cbnz    %w2, 1b         \n"
+        : "=&r"(old), "=&r"(cur), "=&r"(fail)
+        : "r"(node), "r"(top)
+        : "memory", "cc");
+}
+
+/*
+ * 描述: 原子地取走单向链表栈上的全部节点并将栈置空，返回原栈顶，栈空返回NULL
+ */
+OS_SEC_ALW_INLINE INLINE void *OsAtomicStackTake(void **top)
+{
+    void *node;
+    U32 fail;
+
+    OS_EMBED_ASM(
+        "1: ldaxr   %0, [%2]        \n"
+        "   stxr    %w1, xzr, [%2]  \n"
+        "   cbnz    %w1, 1b         \n"
+        : "=&r"(node), "=&r"(fail)
+        : "r"(top)
+        : "memory");
+
+    return node;
+}
+
+/*
+ * 描述: 原子加，返回相加后的值
+ */
+OS_SEC_ALW_INLINE INLINE U32 OsAtomicAdd32(volatile U32 *addr, U32 val)
+{
+    U32 newVal;
+    U32 fail;
+
+    OS_EMBED_ASM(
+        "1: ldxr    %w0, [%2]       \n"
+        "   add     %w0, %w0, %w3   \n"
+        "   stxr    %w1, %w0, [%2]  \n"
+        "   cbnz    %w1, 1b         \n"
+        : "=&r"(newVal), "=&r"(fail)
+        : "r"(addr), "r"(val)
+        : "memory");
+
+    return newVal;
+}
+
+/*
+ * 描述: 原子地将*addr更新为其与val中的较大值，用于记录峰值
+ */
+OS_SEC_ALW_INLINE INLINE void OsAtomicMax32(volatile U32 *addr, U32 val)
+{
+    U32 cur;
+    U32 fail;
+
+    OS_EMBED_ASM(
+        "1: ldxr    %w0, [%2]       \n"
+        "   cmp     %w0, %w3        \n"
+        "   b.hs    2f              \n"
+        "   stxr    %w1, %w3, [%2]  \n"
+        "   cbnz    %w1, 1b         \n"
+        "   b       3f              \n"
+        "2: clrex                   \n"
+        "3:                         \n"
+        : "=&r"(cur), "=&r"(fail)
+        : "r"(addr), "r"(val)
+        : "memory", "cc");
+}
+
 #endif /* OS_CPU_ARMV8_EXTERNAL_H */
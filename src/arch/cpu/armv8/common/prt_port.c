@@ -14,6 +14,7 @@
  */
 #include "prt_cpu_external.h"
 #include "prt_sys_external.h"
+#include "prt_clk.h"
 
 #define ARMV8_X1_INIT_VALUE     0x01010101UL
 #define ARMV8_X2_INIT_VALUE     0x02020202UL
@@ -133,6 +134,14 @@ INIT_SEC_L4_TEXT void *OsTskContextInit(U32 taskID, U32 stackSize, uintptr_t *to
     return stack;
 }
 
+/*
+ * 描述: 获取64位cycle计数，直接读取通用定时器计数，未注册系统时间钩子时作为缺省钩子，主频取CNTFRQ_EL0
+ */
+OS_SEC_L2_TEXT U64 PRT_ClkGetCycleCount64(void)
+{
+    return OsHwCycleGet64();
+}
+
 /*
  * 描述: 从指定地址获取任务上下文
  */
@@ -25,7 +25,11 @@ U32 OsMemConfigReg(void)
 {
     U32 ret;
 
-    ret = OsFscMemInit(OS_MEM_FSC_PT_ADDR, OS_MEM_FSC_PT_SIZE);
+#if defined(OS_OPTION_MEM_TLSF)
+    ret = OsTlsfMemInit((uintptr_t)OS_MEM_FSC_PT_ADDR, OS_MEM_FSC_PT_SIZE);
+#else
+    ret = OsFscMemInit((uintptr_t)OS_MEM_FSC_PT_ADDR, OS_MEM_FSC_PT_SIZE);
+#endif
     if (ret != OS_OK) {
         return ret;
     }
@@ -244,22 +248,31 @@ U32 OsModuleConfigRun(enum OsinitPhaseId initPhaseId, U32 initPhase)
 {
     U32 idx = 0;
     U32 ret = OS_OK;
+    U64 startCycle;
     while (g_moduleConfigTab[idx].moudleId != OS_MID_BUTT) {
         if (g_moduleConfigTab[idx].moudleConfigFunc[initPhaseId] == NULL) {
             idx++;
             continue;
         }
+        startCycle = OsCurCycleGet64();
         ret = g_moduleConfigTab[idx].moudleConfigFunc[initPhaseId]();
         if (ret != OS_OK) {
             break;
         }
+        if (initPhaseId == OS_INIT_ID) {
+            OsSysModInitCycleRecord((U32)g_moduleConfigTab[idx].moudleId, startCycle);
+        }
         idx++;
     }
     return ret;
 }
 U32 OsRegister(void)
 {
-    return OsModuleConfigRun(OS_REGISTER_ID, OS_REGISTER_PHASE);
+    U32 ret;
+
+    ret = OsModuleConfigRun(OS_REGISTER_ID, OS_REGISTER_PHASE);
+    OsSysBootCycleRecord(OS_SYS_BOOT_REGISTER);
+    return ret;
 }
 
 /*
@@ -267,7 +280,11 @@ U32 OsRegister(void)
  */
 U32 OsInitialize(void)
 {
-    return OsModuleConfigRun(OS_INIT_ID, OS_INITIALIZE_PHASE);
+    U32 ret;
+
+    ret = OsModuleConfigRun(OS_INIT_ID, OS_INITIALIZE_PHASE);
+    OsSysBootCycleRecord(OS_SYS_BOOT_INITIALIZE);
+    return ret;
 }
 
 /*
@@ -277,6 +294,8 @@ U32 OsStart(void)
 {
     U32 ret;
 
+    OsSysBootCycleRecord(OS_SYS_BOOT_START);
+
 #if (OS_INCLUDE_TICK == YES)
     /* 表示系统在进行启动阶段，匹配MOUDLE_ID之后，标记进入TICK模块的启动 */
     ret = OsTickStart();
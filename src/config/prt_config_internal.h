@@ -35,7 +35,8 @@ extern "C" {
 #define WORD_PACK(val) (((val) << 24) | ((val) << 16) | ((val) << 8) | (val))
 
 /* UniProton模块注册函数的声明 */
-extern U32 OsFscMemInit(U32 addr, U32 size);
+extern U32 OsFscMemInit(uintptr_t addr, uintptr_t size);
+extern U32 OsTlsfMemInit(uintptr_t addr, uintptr_t size);
 extern U32 OsSysRegister(struct SysModInfo *modInfo);
 extern U32 OsTickRegister(struct TickModInfo *modInfo);
 extern U32 OsTskRegister(struct TskModInfo *modInfo);
@@ -60,6 +61,9 @@ extern U32 PRT_HardDrvInit(void);
 /* Notes: PRT_HardBootInit接口在栈保护支持随机数设置场景下必须在bss初始化后调用 */
 extern void PRT_HardBootInit(void);
 extern U32 PRT_AppInit(void);
+extern U64 OsCurCycleGet64(void);
+extern void OsSysBootCycleRecord(enum SysBootPhase phase);
+extern void OsSysModInitCycleRecord(U32 mid, U64 startCycle);
 
 extern U32 OsQueueRegister(U16 maxQueue);
 extern U32 OsQueueConfigInit(void);
@@ -14,6 +14,7 @@
  */
 #include "prt_event.h"
 #include "prt_task_external.h"
+#include "prt_trace_external.h"
 
 // 支持功能宏裁剪
 #if defined(OS_OPTION_EVENT)
@@ -75,6 +76,7 @@ OS_SEC_ALW_INLINE INLINE U32 OsEventReadNeedSche(U32 flags, struct TagTskCb *run
     }
 
     OsTskReadyDel(runTsk);
+    OS_TRACE(OS_TRACE_EVENT_TASK_BLOCK, runTsk->taskPid, 0, 0);
 
     TSK_STATUS_SET(runTsk, OS_TSK_EVENT_PEND);
 
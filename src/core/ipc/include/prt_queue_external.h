@@ -29,6 +29,16 @@
 #define OS_QUEUE_PID_INVALID       0xFFFFU /* 节点未使用 */
 #define OS_QUEUE_NODE_SIZE_ALIGN   0x2U
 
+/* 队列属性 */
+#define OS_QUEUE_ATTR_FIFO         0x0U /* 普通队列，紧急消息写入队列头，普通消息写入队列尾 */
+#define OS_QUEUE_ATTR_PRIO         0x1U /* 优先级队列，消息按优先级有序存放，同优先级先进先出 */
+#define OS_QUEUE_ATTR_VARLEN       0x2U /* 变长消息队列，消息按实际长度存放在字节环形缓冲区中 */
+#define OS_QUEUE_ATTR_STREAM       0x3U /* 字节流缓冲区，单生产者单消费者，不区分消息边界 */
+#define OS_QUEUE_ATTR_OVERWRITE    0x4U /* 覆盖写队列，队列满时丢弃最早的消息，写操作不阻塞 */
+
+#define OS_QUEUE_MSG_PRIO_MAX      0x7FFFU /* 优先级队列支持的最大消息优先级 */
+#define OS_QUEUE_LINK_INVALID      0xFFFFU /* 优先级队列链接结束标记 */
+
 #define GET_QUEUE_HANDLE(queueId) (((struct TagQueCb *)g_allQueue) + (queueId))
 
 #define OS_QUEUE_INNER_ID(queueId)  ((queueId) - 1)
@@ -36,6 +46,14 @@
 
 #define OS_QUEUE_NAME_LEN   16
 
+/* 优先级队列节点链接信息，与节点一一对应 */
+struct QueLink {
+    /* 下一个节点下标 */
+    U16 next;
+    /* 节点中消息的优先级 */
+    U16 prio;
+};
+
 /* 队列控制块结构体 */
 struct TagQueCb {
     /* 队列起始地址指针 */
@@ -60,6 +78,16 @@ struct TagQueCb {
     struct TagListObject writeList;
     /* 读队列超时LIST */
     struct TagListObject readList;
+    /* 队列属性，取值为OS_QUEUE_ATTR_* */
+    U16 queueAttr;
+    /* 优先级队列的空闲节点链表头下标 */
+    U16 freeHead;
+    /* 已被读写操作唤醒、尚未恢复运行的任务个数，这些任务恢复后仍会访问队列缓冲区 */
+    U16 busyCnt;
+    /* 覆盖写队列被覆盖的消息个数，与nodePeak一样在队列删除前不清零 */
+    U32 overwriteCnt;
+    /* 优先级队列的节点链接表，普通队列为NULL */
+    struct QueLink *link;
 };
 
 /* 队列节点的数据结构 */
@@ -76,4 +104,8 @@ struct QueNode {
 extern U16 g_maxQueue;
 extern struct TagQueCb *g_allQueue;
 
+extern U32 OsQueueCreateWithAttr(U16 nodeNum, U16 maxNodeSize, U16 attr, U32 *queueId);
+extern U32 OsQueueRead(U32 queueId, void *bufferAddr, U32 *len, U32 *prio, U32 timeOut);
+extern U32 OsQueueWrite(U32 queueId, void *bufferAddr, U32 bufferSize, U32 timeOut, U32 prio, bool *firstMsg);
+
 #endif /* PRT_QUEUE_EXTERNAL_H */
@@ -12,125 +12,76 @@
  * Create: 2009-12-22
  * Description: 队列函数实现
  */
-#include "prt_queue_external.h"
-#include "prt_task_external.h"
-#include "prt_asm_cpu_external.h"
-
-OS_SEC_ALW_INLINE INLINE U32 OsGetSrcPid(void)
-{
-    U32 srcPid;
-
-    if (OS_HWI_ACTIVE) {
-        /* 硬中断创建消息不具体区别中断号 */
-        srcPid = COMPOSE_PID(0x0U, OS_HWI_HANDLE);
-    } else {
-        srcPid = RUNNING_TASK->taskPid;
-    }
-
-    return srcPid;
-}
+#include "prt_queue_internal.h"
 
 /*
- * 描述：内部Pend操作，这个函数在调用之前必须关中断。
+ * 描述：取出队列头部的消息节点，返回节点下标
  */
-OS_SEC_ALW_INLINE INLINE U32 OsInnerPend(U16 *count, struct TagListObject *pendList, U32 timeOut)
+OS_SEC_ALW_INLINE INLINE U16 OsQueueHeadNodeTake(struct TagQueCb *queueCb, U32 *prio)
 {
-    struct TagTskCb *runTsk = NULL;
+    U16 nodeIdx = queueCb->queueHead;
 
-    /* 判断是否需要阻塞 */
-    if (*count > 0) {
-        (*count)--;
-        return OS_OK;
-    }
+    if (queueCb->queueAttr == OS_QUEUE_ATTR_PRIO) {
+        /* 优先级队列头部即为优先级最高的消息，取出后节点回收到空闲链表 */
+        queueCb->queueHead = queueCb->link[nodeIdx].next;
+        if (queueCb->queueHead == OS_QUEUE_LINK_INVALID) {
+            queueCb->queueTail = OS_QUEUE_LINK_INVALID;
+        }
 
-    /* 阻塞任务 */
-    if (timeOut == OS_QUEUE_NO_WAIT) {
-        return OS_ERRNO_QUEUE_NO_SOURCE;
-    }
+        if (prio != NULL) {
+            *prio = queueCb->link[nodeIdx].prio;
+        }
 
-    if (OS_INT_ACTIVE) {
-        return OS_ERRNO_QUEUE_IN_INTERRUPT;
+        queueCb->link[nodeIdx].next = queueCb->freeHead;
+        queueCb->freeHead = nodeIdx;
+        return nodeIdx;
     }
 
-    /* 如果锁任务的情况下 */
-    if (OS_TASK_LOCK_DATA != 0) {
-        return OS_ERRNO_QUEUE_PEND_IN_LOCK;
+    if (prio != NULL) {
+        *prio = 0;
     }
 
-    /* 利用局部变量 runTsk 完成对任务控制块的相关操作，不修改 RUNNING_TASK */
-    runTsk = (struct TagTskCb *)RUNNING_TASK;
-
-    /* 从任务的Ready list上把当前任务删除，添加到pend list上 */
-    OsTskReadyDel(runTsk);
-
-    TSK_STATUS_SET(runTsk, OS_TSK_QUEUE_PEND);
-    ListTailAdd(&runTsk->pendList, pendList);
-
-    /* 如果timeOut > 0,timeOut为等待时间，如果timeOut == OS_QUEUE_WAIT_FOREVER，表示永久等待 */
-    if (timeOut != OS_QUEUE_WAIT_FOREVER) {
-        /* 如果不是永久等待则将任务挂到计时器链表中，设置OS_TSK_TIMEOUT是为了判断是否等待超时 */
-        TSK_STATUS_SET(runTsk, OS_TSK_TIMEOUT);
-        OsTskTimerAdd(runTsk, timeOut);
+    /* 队列头指针加1 */
+    queueCb->queueHead++;
+    /* 如果队列头指针已经到队列尾，那么头指针指向队列头 */
+    if (queueCb->queueHead == queueCb->nodeNum) {
+        queueCb->queueHead = 0;
     }
 
-    /* 调用函数之前已经关中断，此处关中断进行调度 */
-    /* 触发任务调度 */
-    OsTskSchedule();
-    TSK_STATUS_CLEAR(runTsk, OS_TSK_QUEUE_BUSY);
-
-    /* 判断是否是等待队列超时 */
-    if ((runTsk->taskStatus & OS_TSK_TIMEOUT) != 0) {
-        TSK_STATUS_CLEAR(runTsk, OS_TSK_TIMEOUT);
-
-        /* 在函数的外面会开中断 */
-        return OS_ERRNO_QUEUE_TIMEOUT;
-    }
-    /* 在函数的外面会开中断 */
-    return OS_OK;
+    return nodeIdx;
 }
 
-OS_SEC_ALW_INLINE INLINE bool OsQueuePendNeedProc(struct TagListObject *objectList)
+/*
+ * 描述：读变长消息队列，读出的空间可能满足多个写任务，唤醒所有等待的写任务重新检查空闲空间
+ */
+OS_SEC_ALW_INLINE INLINE void OsQueueVarLenReadProc(struct TagQueCb *queueCb, void *bufferAddr, U32 *len, U32 *prio)
 {
-    struct TagTskCb *resumedTask = NULL;
+    bool needSched = FALSE;
 
-    /* 判断是否有任务阻塞于该队列 */
-    if (ListEmpty(objectList)) {
-        return FALSE;
+    if (prio != NULL) {
+        *prio = 0;
     }
 
-    /* 激活阻塞在该队列的首个任务 */
-    resumedTask = GET_TCB_PEND(OS_LIST_FIRST(objectList));
-    ListDelete(OS_LIST_FIRST(objectList));
+    OsQueueVarLenRead(queueCb, bufferAddr, len);
 
-    /* 去除该任务的队列阻塞位 */
-    TSK_STATUS_CLEAR(resumedTask, OS_TSK_QUEUE_PEND);
-    /* 如果阻塞的任务属于定时等待的任务时候，去掉其定时等待标志位，并将其从去除 */
-    if ((resumedTask->taskStatus & OS_TSK_TIMEOUT) != 0) {
-        /*
-         * 添加PEND状态时，会加上TIMEOUT标志和timer，或者都不加。
-         * 所以此时有TIMEOUT标志就一定有timer，且只有一个，且只用于该PEND方式
-         */
-        OS_TSK_DELAY_LOCKED_DETACH(resumedTask);
-        TSK_STATUS_CLEAR(resumedTask, OS_TSK_TIMEOUT);
+    while (OsQueuePendNeedProc(queueCb, &queueCb->writeList)) {
+        needSched = TRUE;
     }
 
-    TSK_STATUS_SET(resumedTask, OS_TSK_QUEUE_BUSY);
-
-    /* 如果去除队列阻塞位后，该任务不处于挂起态则将该任务挂入就绪队列并触发任务调度 */
-    if ((resumedTask->taskStatus & OS_TSK_SUSPEND) == 0) {
-        OsTskReadyAddBgd(resumedTask);
+    if (needSched) {
+        OsTskSchedule();
     }
-    return TRUE;
 }
 
 /*
- * 描述：读指定队列
+ * 描述：读指定队列，prio非空时输出消息优先级
  */
-OS_SEC_L4_TEXT U32 PRT_QueueRead(U32 queueId, void *bufferAddr, U32 *len, U32 timeOut)
+OS_SEC_L4_TEXT U32 OsQueueRead(U32 queueId, void *bufferAddr, U32 *len, U32 *prio, U32 timeOut)
 {
     uintptr_t intSave;
     U32 ret;
     U32 bufLen;
+    U16 nodeIdx;
     U32 innerId = OS_QUEUE_INNER_ID(queueId);
     struct TagQueCb *queueCb = NULL;
     struct QueNode *queueNode = NULL;
@@ -157,14 +108,27 @@ OS_SEC_L4_TEXT U32 PRT_QueueRead(U32 queueId, void *bufferAddr, U32 *len, U32 ti
         goto QUEUE_END;
     }
 
+    /* 字节流缓冲区只能通过PRT_QueueStreamRead/PRT_QueueStreamWrite读写 */
+    if (queueCb->queueAttr == OS_QUEUE_ATTR_STREAM) {
+        ret = OS_ERRNO_QUEUE_ATTR_INVALID;
+        goto QUEUE_END;
+    }
+    OS_TRACE(OS_TRACE_EVENT_QUEUE_READ, queueId, timeOut, bufLen);
+
     /* 读队列PEND */
-    ret = OsInnerPend(&queueCb->readableCnt, &queueCb->readList, timeOut);
+    ret = OsInnerPend(queueCb, &queueCb->readableCnt, &queueCb->readList, timeOut);
     if (ret != OS_OK) {
         goto QUEUE_END;
     }
 
+    if (queueCb->queueAttr == OS_QUEUE_ATTR_VARLEN) {
+        OsQueueVarLenReadProc(queueCb, bufferAddr, len, prio);
+        goto QUEUE_END;
+    }
+
     /* 获取该队列中第一个有数据结点首地址，并将数据存入buffer中 */
-    queueNode = (struct QueNode *)(uintptr_t)&queueCb->queue[(queueCb->queueHead) * (queueCb->nodeSize)];
+    nodeIdx = OsQueueHeadNodeTake(queueCb, prio);
+    queueNode = (struct QueNode *)(uintptr_t)&queueCb->queue[nodeIdx * (queueCb->nodeSize)];
 
     /* 如果buf的长度小于数据长度，则仅返回buf大小的数据，如果大于，则返回全部数据 */
     if (*len > queueNode->size) {
@@ -177,14 +141,7 @@ OS_SEC_L4_TEXT U32 PRT_QueueRead(U32 queueId, void *bufferAddr, U32 *len, U32 ti
 
     queueNode->srcPid = OS_QUEUE_PID_INVALID;
 
-    /* 队列头指针加1 */
-    queueCb->queueHead++;
-    /* 如果队列头指针已经到队列尾，那么头指针指向队列头 */
-    if (queueCb->queueHead == queueCb->nodeNum) {
-        queueCb->queueHead = 0;
-    }
-
-    if (OsQueuePendNeedProc(&queueCb->writeList)) {
+    if (OsQueuePendNeedProc(queueCb, &queueCb->writeList)) {
         OsTskSchedule();
         OsIntRestore(intSave);
         return OS_OK;
@@ -197,6 +154,14 @@ QUEUE_END:
     return ret;
 }
 
+/*
+ * 描述：读指定队列
+ */
+OS_SEC_L4_TEXT U32 PRT_QueueRead(U32 queueId, void *bufferAddr, U32 *len, U32 timeOut)
+{
+    return OsQueueRead(queueId, bufferAddr, len, NULL, timeOut);
+}
+
 OS_SEC_L4_TEXT U32 OsQueueWriteParaCheck(U32 innerId, uintptr_t bufferAddr, U32 bufferSize, U32 prio)
 {
     if (innerId >= g_maxQueue) {
@@ -218,12 +183,55 @@ OS_SEC_L4_TEXT U32 OsQueueWriteParaCheck(U32 innerId, uintptr_t bufferAddr, U32
     return OS_OK;
 }
 
+/*
+ * 描述：为优先级队列申请一个空闲节点，并按优先级插入消息链表，同优先级消息先进先出
+ */
+OS_SEC_ALW_INLINE INLINE U16 OsQueuePrioNodeInsert(struct TagQueCb *queueCb, U32 prio)
+{
+    U16 prev;
+    U16 nodeIdx = queueCb->freeHead;
+    struct QueLink *link = queueCb->link;
+
+    queueCb->freeHead = link[nodeIdx].next;
+    link[nodeIdx].prio = (U16)prio;
+
+    if (queueCb->queueHead == OS_QUEUE_LINK_INVALID) {
+        /* 队列为空 */
+        link[nodeIdx].next = OS_QUEUE_LINK_INVALID;
+        queueCb->queueHead = nodeIdx;
+        queueCb->queueTail = nodeIdx;
+    } else if (prio <= link[queueCb->queueTail].prio) {
+        /* 不高于队尾消息优先级，直接挂到队尾，常见场景O(1) */
+        link[nodeIdx].next = OS_QUEUE_LINK_INVALID;
+        link[queueCb->queueTail].next = nodeIdx;
+        queueCb->queueTail = nodeIdx;
+    } else if (prio > link[queueCb->queueHead].prio) {
+        /* 高于队头消息优先级，挂到队头 */
+        link[nodeIdx].next = queueCb->queueHead;
+        queueCb->queueHead = nodeIdx;
+    } else {
+        /* 插入到最后一个优先级不低于该消息的节点之后，只修改链接，不搬移消息数据 */
+        prev = queueCb->queueHead;
+        while (link[link[prev].next].prio >= prio) {
+            prev = link[prev].next;
+        }
+        link[nodeIdx].next = link[prev].next;
+        link[prev].next = nodeIdx;
+    }
+
+    return nodeIdx;
+}
+
 OS_SEC_ALW_INLINE INLINE void OsQueueCpData2Node(U32 prio, uintptr_t bufferAddr, U32 bufferSize,
                                                  struct TagQueCb *queueCb)
 {
     U16 peak;
     struct QueNode *queueNode = NULL;
-    if (prio == (U32)OS_QUEUE_NORMAL) {
+    if (queueCb->queueAttr == OS_QUEUE_ATTR_PRIO) {
+        /* 优先级队列按消息优先级有序插入 */
+        queueNode = (struct QueNode *)(uintptr_t)&queueCb->queue[(OsQueuePrioNodeInsert(queueCb, prio) *
+            (queueCb->nodeSize))];
+    } else if (prio == (U32)OS_QUEUE_NORMAL) {
         /* 普通消息加到队列尾部 */
         queueNode = (struct QueNode *)(uintptr_t)&queueCb->queue[((queueCb->queueTail) * (queueCb->nodeSize))];
 
@@ -249,8 +257,13 @@ OS_SEC_ALW_INLINE INLINE void OsQueueCpData2Node(U32 prio, uintptr_t bufferAddr,
     queueNode->size = (U16)bufferSize;
     queueNode->srcPid = (U16)OsGetSrcPid();
 
-    peak = queueCb->queueTail > queueCb->queueHead ? queueCb->queueTail - queueCb->queueHead
-           : (queueCb->nodeNum - queueCb->queueHead) + queueCb->queueTail;
+    if (queueCb->queueAttr == OS_QUEUE_ATTR_PRIO) {
+        /* 写资源已在PEND时扣除，未归还的写资源即为已使用的节点 */
+        peak = queueCb->nodeNum - queueCb->writableCnt;
+    } else {
+        peak = queueCb->queueTail > queueCb->queueHead ? queueCb->queueTail - queueCb->queueHead
+               : (queueCb->nodeNum - queueCb->queueHead) + queueCb->queueTail;
+    }
 
     if (peak > queueCb->nodePeak) {
         queueCb->nodePeak = peak;
@@ -258,18 +271,43 @@ OS_SEC_ALW_INLINE INLINE void OsQueueCpData2Node(U32 prio, uintptr_t bufferAddr,
 }
 
 /*
- * 描述：写指定队列
+ * 描述：覆盖写队列已满时丢弃最早的消息，腾出的节点直接用于写入新消息。
+ * 队列满时不会有读任务阻塞，因此不需要唤醒任务及触发调度。
  */
-OS_SEC_L4_TEXT U32 PRT_QueueWrite(U32 queueId, void *bufferAddr, U32 bufferSize, U32 timeOut, U32 prio)
+OS_SEC_ALW_INLINE INLINE void OsQueueOverwrite(U32 prio, uintptr_t bufferAddr, U32 bufferSize,
+                                               struct TagQueCb *queueCb)
+{
+    /* 队列满时头尾下标重合，头指针后移丢弃最早的消息，普通消息写入原头节点后尾指针随之后移 */
+    queueCb->queueHead++;
+    if (queueCb->queueHead == queueCb->nodeNum) {
+        queueCb->queueHead = 0;
+    }
+
+    OsQueueCpData2Node(prio, bufferAddr, bufferSize, queueCb);
+
+    if (queueCb->overwriteCnt != OS_MAX_U32) {
+        queueCb->overwriteCnt++;
+    }
+}
+
+/*
+ * 描述：写指定队列，优先级队列的prio为消息优先级，普通队列的prio为OS_QUEUE_NORMAL或OS_QUEUE_URGENT。
+ * firstMsg非空时输出本次写入是否使队列由空变为非空，消息直接交给阻塞的读任务时不算
+ */
+OS_SEC_L4_TEXT U32 OsQueueWrite(U32 queueId, void *bufferAddr, U32 bufferSize, U32 timeOut, U32 prio,
+                                bool *firstMsg)
 {
     U32 ret;
     uintptr_t intSave;
     U32 innerId = OS_QUEUE_INNER_ID(queueId);
     struct TagQueCb *queueCb = NULL;
 
-    ret = OsQueueWriteParaCheck(innerId, (uintptr_t)bufferAddr, bufferSize, prio);
-    if (ret != OS_OK) {
-        return ret;
+    if (firstMsg != NULL) {
+        *firstMsg = FALSE;
+    }
+
+    if (innerId >= g_maxQueue) {
+        return OS_ERRNO_QUEUE_INVALID;
     }
 
     /* 获取指定队列控制块 */
@@ -280,29 +318,74 @@ OS_SEC_L4_TEXT U32 PRT_QueueWrite(U32 queueId, void *bufferAddr, U32 bufferSize,
         goto QUEUE_END;
     }
 
+    /* 字节流缓冲区只能通过PRT_QueueStreamRead/PRT_QueueStreamWrite读写 */
+    if (queueCb->queueAttr == OS_QUEUE_ATTR_STREAM) {
+        ret = OS_ERRNO_QUEUE_ATTR_INVALID;
+        goto QUEUE_END;
+    }
+
     if (bufferSize > (queueCb->nodeSize - OS_QUEUE_NODE_HEAD_LEN)) {
         ret = OS_ERRNO_QUEUE_SIZE_TOO_BIG;
         goto QUEUE_END;
     }
 
-    /* 读队列PEND */
-    ret = OsInnerPend(&queueCb->writableCnt, &queueCb->writeList, timeOut);
+    if ((queueCb->queueAttr == OS_QUEUE_ATTR_PRIO) && (prio > OS_QUEUE_MSG_PRIO_MAX)) {
+        ret = OS_ERRNO_QUEUE_PRIO_INVALID;
+        goto QUEUE_END;
+    }
+    OS_TRACE(OS_TRACE_EVENT_QUEUE_WRITE, queueId, timeOut, bufferSize);
+
+    /* 覆盖写队列满时原地覆盖最早的消息，不阻塞 */
+    if ((queueCb->queueAttr == OS_QUEUE_ATTR_OVERWRITE) && (queueCb->writableCnt == 0)) {
+        OsQueueOverwrite(prio, (uintptr_t)bufferAddr, bufferSize, queueCb);
+        ret = OS_OK;
+        goto QUEUE_END;
+    }
+
+    /* 写队列PEND，变长消息队列等待足够的空闲字节 */
+    if (queueCb->queueAttr == OS_QUEUE_ATTR_VARLEN) {
+        ret = OsQueueVarLenPend(queueCb, bufferSize + OS_QUEUE_NODE_HEAD_LEN, timeOut);
+    } else {
+        ret = OsInnerPend(queueCb, &queueCb->writableCnt, &queueCb->writeList, timeOut);
+    }
     if (ret != OS_OK) {
         goto QUEUE_END;
     }
 
     /* 选取消息节点，初始化消息节点拷贝数据 */
-    OsQueueCpData2Node(prio, (uintptr_t)bufferAddr, bufferSize, queueCb);
+    if (queueCb->queueAttr == OS_QUEUE_ATTR_VARLEN) {
+        OsQueueVarLenCpData(queueCb, prio, (uintptr_t)bufferAddr, bufferSize, OsGetSrcPid());
+    } else {
+        OsQueueCpData2Node(prio, (uintptr_t)bufferAddr, bufferSize, queueCb);
+    }
 
-    if (OsQueuePendNeedProc(&queueCb->readList)) {
+    if (OsQueuePendNeedProc(queueCb, &queueCb->readList)) {
         OsTskSchedule();
         OsIntRestore(intSave);
         return OS_OK;
     }
 
+    if (firstMsg != NULL) {
+        *firstMsg = (queueCb->readableCnt == 0);
+    }
     queueCb->readableCnt++;
 
 QUEUE_END:
     OsIntRestore(intSave);
     return ret;
 }
+
+/*
+ * 描述：写指定队列
+ */
+OS_SEC_L4_TEXT U32 PRT_QueueWrite(U32 queueId, void *bufferAddr, U32 bufferSize, U32 timeOut, U32 prio)
+{
+    U32 ret;
+
+    ret = OsQueueWriteParaCheck(OS_QUEUE_INNER_ID(queueId), (uintptr_t)bufferAddr, bufferSize, prio);
+    if (ret != OS_OK) {
+        return ret;
+    }
+
+    return OsQueueWrite(queueId, bufferAddr, bufferSize, timeOut, prio, NULL);
+}
@@ -42,7 +42,8 @@ OS_SEC_L4_TEXT U32 PRT_QueueDelete(U32 queueId)
         goto QUEUE_END;
     }
 
-    if ((queueCb->writableCnt + queueCb->readableCnt) != queueCb->nodeNum) {
+    /* 已被唤醒还未运行的任务恢复后仍会访问队列缓冲区 */
+    if (queueCb->busyCnt != 0) {
         ret = OS_ERRNO_QUEUE_BUSY;
         goto QUEUE_END;
     }
@@ -73,10 +73,29 @@ OS_SEC_L4_TEXT U32 OsQueueCreatParaCheck(U16 nodeNum, U16 nodeSize, const U32 *q
     return OS_OK;
 }
 
-OS_SEC_L4_TEXT U32 OsQueueCreate(U16 nodeNum, U16 maxNodeSize, U32 *queueId)
+OS_SEC_ALW_INLINE INLINE void OsQueuePrioLinkInit(struct TagQueCb *queueCb, U16 nodeNum)
+{
+    U32 index;
+
+    /* 优先级队列的节点链接表紧跟在节点数据之后，初始时所有节点挂在空闲链表上 */
+    queueCb->link = (struct QueLink *)(uintptr_t)&queueCb->queue[(U32)nodeNum * (U32)queueCb->nodeSize];
+    for (index = 0; index < nodeNum; index++) {
+        queueCb->link[index].next = (U16)(index + 1);
+        queueCb->link[index].prio = 0;
+    }
+    queueCb->link[nodeNum - 1].next = OS_QUEUE_LINK_INVALID;
+    queueCb->freeHead = 0;
+
+    /* 优先级队列空时头尾均为无效下标 */
+    queueCb->queueHead = OS_QUEUE_LINK_INVALID;
+    queueCb->queueTail = OS_QUEUE_LINK_INVALID;
+}
+
+OS_SEC_L4_TEXT U32 OsQueueCreate(U16 nodeNum, U16 maxNodeSize, U16 attr, U32 *queueId)
 {
     U32 index;
     U32 qId = 0;
+    U32 memSize;
     struct QueNode *queueNode = NULL;
     U16 nodeSize = maxNodeSize;
     struct TagQueCb *queueCb = NULL;
@@ -95,7 +114,12 @@ OS_SEC_L4_TEXT U32 OsQueueCreate(U16 nodeNum, U16 maxNodeSize, U32 *queueId)
     }
 
     nodeSize = (U16)OsQueueGetNodeSize(nodeSize);
-    queueCb->queue = (U8 *)OsMemAlloc(OS_MID_QUEUE, OS_MEM_DEFAULT_FSC_PT, (U32)nodeNum * (U32)nodeSize);
+    memSize = (U32)nodeNum * (U32)nodeSize;
+    if (attr == OS_QUEUE_ATTR_PRIO) {
+        memSize += (U32)nodeNum * sizeof(struct QueLink);
+    }
+
+    queueCb->queue = (U8 *)OsMemAlloc(OS_MID_QUEUE, OS_MEM_DEFAULT_FSC_PT, memSize);
     if (queueCb->queue == NULL) {
         return OS_ERRNO_QUEUE_CREATE_NO_MEMORY;
     }
@@ -108,13 +132,20 @@ OS_SEC_L4_TEXT U32 OsQueueCreate(U16 nodeNum, U16 maxNodeSize, U32 *queueId)
     queueCb->nodeNum = nodeNum;
     queueCb->nodeSize = nodeSize;
     queueCb->queueState = OS_QUEUE_USED;
+    queueCb->queueAttr = attr;
     INIT_LIST_OBJECT(&queueCb->writeList);
     INIT_LIST_OBJECT(&queueCb->readList);
     queueCb->writableCnt = nodeNum;
     queueCb->queueHead = 0;
     queueCb->queueTail = 0;
     queueCb->nodePeak = 0;
+    queueCb->overwriteCnt = 0;
     queueCb->readableCnt = 0;
+    queueCb->busyCnt = 0;
+    queueCb->link = NULL;
+    if (attr == OS_QUEUE_ATTR_PRIO) {
+        OsQueuePrioLinkInit(queueCb, nodeNum);
+    }
 
     *queueId = qId;
 
@@ -122,9 +153,9 @@ OS_SEC_L4_TEXT U32 OsQueueCreate(U16 nodeNum, U16 maxNodeSize, U32 *queueId)
 }
 
 /*
- * 描述：创建队列接口
+ * 描述：按指定属性创建队列
  */
-OS_SEC_L4_TEXT U32 PRT_QueueCreate(U16 nodeNum, U16 maxNodeSize, U32 *queueId)
+OS_SEC_L4_TEXT U32 OsQueueCreateWithAttr(U16 nodeNum, U16 maxNodeSize, U16 attr, U32 *queueId)
 {
     uintptr_t intSave;
     U32 ret;
@@ -136,7 +167,7 @@ OS_SEC_L4_TEXT U32 PRT_QueueCreate(U16 nodeNum, U16 maxNodeSize, U32 *queueId)
     }
 
     intSave = OsIntLock();
-    ret = OsQueueCreate(nodeNum, maxNodeSize, &qId);
+    ret = OsQueueCreate(nodeNum, maxNodeSize, attr, &qId);
     if (ret != OS_OK) {
         OsIntRestore(intSave);
         return ret;
@@ -146,3 +177,19 @@ OS_SEC_L4_TEXT U32 PRT_QueueCreate(U16 nodeNum, U16 maxNodeSize, U32 *queueId)
     OsIntRestore(intSave);
     return OS_OK;
 }
+
+/*
+ * 描述：创建队列接口
+ */
+OS_SEC_L4_TEXT U32 PRT_QueueCreate(U16 nodeNum, U16 maxNodeSize, U32 *queueId)
+{
+    return OsQueueCreateWithAttr(nodeNum, maxNodeSize, OS_QUEUE_ATTR_FIFO, queueId);
+}
+
+/*
+ * 描述：创建覆盖写队列接口
+ */
+OS_SEC_L4_TEXT U32 PRT_QueueCreateOverwrite(U16 nodeNum, U16 maxNodeSize, U32 *queueId)
+{
+    return OsQueueCreateWithAttr(nodeNum, maxNodeSize, OS_QUEUE_ATTR_OVERWRITE, queueId);
+}
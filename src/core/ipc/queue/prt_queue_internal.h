@@ -0,0 +1,202 @@
+/*
+ * Copyright (c) 2009-2022 Huawei Technologies Co., Ltd. All rights reserved.
+ *
+ * UniProton is licensed under Mulan PSL v2.
+ * You can use this software according to the terms and conditions of the Mulan PSL v2.
+ * You may obtain a copy of Mulan PSL v2 at:
+ *          http://license.coscl.org.cn/MulanPSL2
+ * THIS SOFTWARE IS PROVIDED ON AN "AS IS" BASIS, WITHOUT WARRANTIES OF ANY KIND,
+ * EITHER EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO NON-INFRINGEMENT,
+ * MERCHANTABILITY OR FIT FOR A PARTICULAR PURPOSE.
+ * See the Mulan PSL v2 for more details.
+ * Create: 2009-12-22
+ * Description: queue模块的模块内头文件
+ */
+#ifndef PRT_QUEUE_INTERNAL_H
+#define PRT_QUEUE_INTERNAL_H
+
+#include "prt_queue_external.h"
+#include "prt_task_external.h"
+#include "prt_asm_cpu_external.h"
+#include "prt_trace_external.h"
+
+/*
+ * 模块内宏定义
+ */
+#define OS_QUEUE_VARLEN_CTRL(queueCb) ((struct QueVarLenCtrl *)(uintptr_t)(queueCb)->queue)
+#define OS_QUEUE_VARLEN_BUF(queueCb)  (&(queueCb)->queue[sizeof(struct QueVarLenCtrl)])
+
+#define OS_QUEUE_STREAM_CTRL(queueCb) ((struct QueStreamCtrl *)(uintptr_t)(queueCb)->queue)
+#define OS_QUEUE_STREAM_BUF(queueCb)  (&(queueCb)->queue[sizeof(struct QueStreamCtrl)])
+
+/* 编译器内存屏障，保证读写索引与数据拷贝的先后顺序不被重排 */
+#define OS_QUEUE_STREAM_BARRIER() OS_EMBED_ASM("" : : : "memory")
+
+/*
+ * 模块内结构体定义
+ */
+/* 变长消息队列控制头，位于队列内存起始处，其后紧跟环形缓冲区，每条消息为QueNode头加实际数据 */
+struct QueVarLenCtrl {
+    /* 环形缓冲区字节数 */
+    U32 bufSize;
+    /* 最早写入的消息记录起始偏移 */
+    U32 head;
+    /* 下一条消息记录的写入偏移 */
+    U32 tail;
+    /* 空闲字节数 */
+    U32 freeSize;
+    /* 缓冲区中的消息条数 */
+    U32 msgNum;
+};
+
+/*
+ * 字节流缓冲区控制头，位于队列内存起始处，其后紧跟环形缓冲区。
+ * head只由读任务修改，tail只由写者修改，二者均为自由增长的字节计数，缓冲区大小为2的幂。
+ */
+struct QueStreamCtrl {
+    /* 已读出的字节计数 */
+    volatile U32 head;
+    /* 已写入的字节计数 */
+    volatile U32 tail;
+    /* 环形缓冲区字节数 */
+    U32 bufSize;
+    /* 触发水位，缓冲区数据达到该字节数时唤醒读任务 */
+    volatile U32 triggerLevel;
+    /* 读任务阻塞时等待的字节数，为0表示没有读任务阻塞 */
+    volatile U32 waitLevel;
+    /* 缓冲区历史最大使用字节数 */
+    U32 peak;
+};
+
+/*
+ * 模块内函数声明
+ */
+extern U32 OsQueueVarLenPend(struct TagQueCb *queueCb, U32 recordLen, U32 timeOut);
+extern void OsQueueVarLenCpData(struct TagQueCb *queueCb, U32 prio, uintptr_t bufferAddr, U32 bufferSize,
+                                U32 srcPid);
+extern void OsQueueVarLenRead(struct TagQueCb *queueCb, void *bufferAddr, U32 *len);
+extern void OsQueueVarLenNodeNum(struct TagQueCb *queueCb, U32 taskPid, U32 *num, U32 *numAll);
+
+OS_SEC_ALW_INLINE INLINE U32 OsGetSrcPid(void)
+{
+    U32 srcPid;
+
+    if (OS_HWI_ACTIVE) {
+        /* 硬中断创建消息不具体区别中断号 */
+        srcPid = COMPOSE_PID(0x0U, OS_HWI_HANDLE);
+    } else {
+        srcPid = RUNNING_TASK->taskPid;
+    }
+
+    return srcPid;
+}
+
+/*
+ * 描述：将当前任务阻塞到指定的等待链表上，这个函数在调用之前必须关中断。
+ */
+OS_SEC_ALW_INLINE INLINE U32 OsQueuePendSelf(struct TagQueCb *queueCb, struct TagListObject *pendList, U32 timeOut)
+{
+    struct TagTskCb *runTsk = NULL;
+
+    /* 阻塞任务 */
+    if (timeOut == OS_QUEUE_NO_WAIT) {
+        return OS_ERRNO_QUEUE_NO_SOURCE;
+    }
+
+    if (OS_INT_ACTIVE) {
+        return OS_ERRNO_QUEUE_IN_INTERRUPT;
+    }
+
+    /* 如果锁任务的情况下 */
+    if (OS_TASK_LOCK_DATA != 0) {
+        return OS_ERRNO_QUEUE_PEND_IN_LOCK;
+    }
+
+    /* 利用局部变量 runTsk 完成对任务控制块的相关操作，不修改 RUNNING_TASK */
+    runTsk = (struct TagTskCb *)RUNNING_TASK;
+
+    /* 从任务的Ready list上把当前任务删除，添加到pend list上 */
+    OsTskReadyDel(runTsk);
+    OS_TRACE(OS_TRACE_EVENT_TASK_BLOCK, runTsk->taskPid, 0, 0);
+
+    TSK_STATUS_SET(runTsk, OS_TSK_QUEUE_PEND);
+    ListTailAdd(&runTsk->pendList, pendList);
+
+    /* 如果timeOut > 0,timeOut为等待时间，如果timeOut == OS_QUEUE_WAIT_FOREVER，表示永久等待 */
+    if (timeOut != OS_QUEUE_WAIT_FOREVER) {
+        /* 如果不是永久等待则将任务挂到计时器链表中，设置OS_TSK_TIMEOUT是为了判断是否等待超时 */
+        TSK_STATUS_SET(runTsk, OS_TSK_TIMEOUT);
+        OsTskTimerAdd(runTsk, timeOut);
+    }
+
+    /* 调用函数之前已经关中断，此处关中断进行调度 */
+    /* 触发任务调度 */
+    OsTskSchedule();
+    /* 被读写操作唤醒的任务已恢复运行，关中断期间完成对队列缓冲区的访问 */
+    if (TSK_STATUS_TST(runTsk, OS_TSK_QUEUE_BUSY)) {
+        TSK_STATUS_CLEAR(runTsk, OS_TSK_QUEUE_BUSY);
+        queueCb->busyCnt--;
+    }
+
+    /* 判断是否是等待队列超时 */
+    if ((runTsk->taskStatus & OS_TSK_TIMEOUT) != 0) {
+        TSK_STATUS_CLEAR(runTsk, OS_TSK_TIMEOUT);
+
+        /* 在函数的外面会开中断 */
+        return OS_ERRNO_QUEUE_TIMEOUT;
+    }
+    /* 在函数的外面会开中断 */
+    return OS_OK;
+}
+
+/*
+ * 描述：内部Pend操作，这个函数在调用之前必须关中断。
+ */
+OS_SEC_ALW_INLINE INLINE U32 OsInnerPend(struct TagQueCb *queueCb, U16 *count, struct TagListObject *pendList,
+                                         U32 timeOut)
+{
+    /* 判断是否需要阻塞 */
+    if (*count > 0) {
+        (*count)--;
+        return OS_OK;
+    }
+
+    return OsQueuePendSelf(queueCb, pendList, timeOut);
+}
+
+OS_SEC_ALW_INLINE INLINE bool OsQueuePendNeedProc(struct TagQueCb *queueCb, struct TagListObject *objectList)
+{
+    struct TagTskCb *resumedTask = NULL;
+
+    /* 判断是否有任务阻塞于该队列 */
+    if (ListEmpty(objectList)) {
+        return FALSE;
+    }
+
+    /* 激活阻塞在该队列的首个任务 */
+    resumedTask = GET_TCB_PEND(OS_LIST_FIRST(objectList));
+    ListDelete(OS_LIST_FIRST(objectList));
+
+    /* 去除该任务的队列阻塞位 */
+    TSK_STATUS_CLEAR(resumedTask, OS_TSK_QUEUE_PEND);
+    /* 如果阻塞的任务属于定时等待的任务时候，去掉其定时等待标志位，并将其从去除 */
+    if ((resumedTask->taskStatus & OS_TSK_TIMEOUT) != 0) {
+        /*
+         * 添加PEND状态时，会加上TIMEOUT标志和timer，或者都不加。
+         * 所以此时有TIMEOUT标志就一定有timer，且只有一个，且只用于该PEND方式
+         */
+        OS_TSK_DELAY_LOCKED_DETACH(resumedTask);
+        TSK_STATUS_CLEAR(resumedTask, OS_TSK_TIMEOUT);
+    }
+
+    TSK_STATUS_SET(resumedTask, OS_TSK_QUEUE_BUSY);
+    queueCb->busyCnt++;
+
+    /* 如果去除队列阻塞位后，该任务不处于挂起态则将该任务挂入就绪队列并触发任务调度 */
+    if ((resumedTask->taskStatus & OS_TSK_SUSPEND) == 0) {
+        OsTskReadyAddBgd(resumedTask);
+    }
+    return TRUE;
+}
+
+#endif /* PRT_QUEUE_INTERNAL_H */
@@ -12,7 +12,7 @@
  * Create: 2009-12-22
  * Description: 队列维测函数实现
  */
-#include "prt_queue_external.h"
+#include "prt_queue_internal.h"
 
 OS_SEC_L2_TEXT U32 OsQueueGetParaCheck(U32 innerId, const U32 *num, struct TagQueCb **queueCb)
 {
@@ -48,7 +48,35 @@ OS_SEC_L2_TEXT U32 PRT_QueueGetUsedPeak(U32 queueId, U32 *queueUsedNum)
         return ret;
     }
 
-    *queueUsedNum = (U32)queueCb->nodePeak;
+    /* 字节流缓冲区的峰值单位为字节 */
+    if (queueCb->queueAttr == OS_QUEUE_ATTR_STREAM) {
+        *queueUsedNum = OS_QUEUE_STREAM_CTRL(queueCb)->peak;
+    } else {
+        *queueUsedNum = (U32)queueCb->nodePeak;
+    }
+    OsIntRestore(intSave);
+
+    return OS_OK;
+}
+
+/*
+ * 描述：获取覆盖写队列被覆盖的消息个数。
+ */
+OS_SEC_L2_TEXT U32 PRT_QueueGetOverwriteCnt(U32 queueId, U32 *overwriteCnt)
+{
+    U32 innerId = OS_QUEUE_INNER_ID(queueId);
+    struct TagQueCb *queueCb = NULL;
+    uintptr_t intSave;
+    U32 ret;
+
+    intSave = OsIntLock();
+    ret = OsQueueGetParaCheck(innerId, overwriteCnt, &queueCb);
+    if (ret != OS_OK) {
+        OsIntRestore(intSave);
+        return ret;
+    }
+
+    *overwriteCnt = queueCb->overwriteCnt;
     OsIntRestore(intSave);
 
     return OS_OK;
@@ -75,7 +103,13 @@ OS_SEC_L2_TEXT U32 PRT_QueueGetNodeNum(U32 queueId, U32 taskPid, U32 *queueNum)
         return ret;
     }
 
-    if (taskPid != OS_QUEUE_PID_INVALID) {
+    if (queueCb->queueAttr == OS_QUEUE_ATTR_STREAM) {
+        /* 字节流缓冲区不记录消息来源，返回缓冲区中的字节数 */
+        numAll = OS_QUEUE_STREAM_CTRL(queueCb)->tail - OS_QUEUE_STREAM_CTRL(queueCb)->head;
+        num = numAll;
+    } else if ((taskPid != OS_QUEUE_PID_INVALID) && (queueCb->queueAttr == OS_QUEUE_ATTR_VARLEN)) {
+        OsQueueVarLenNodeNum(queueCb, taskPid, &num, &numAll);
+    } else if (taskPid != OS_QUEUE_PID_INVALID) {
         for (loop = 0; loop < queueCb->nodeNum; loop++) {
             queueNode = (struct QueNode *)(uintptr_t)&queueCb->queue[loop * (queueCb->nodeSize)];
             if (queueNode->srcPid == taskPid) {
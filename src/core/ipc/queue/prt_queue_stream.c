@@ -0,0 +1,321 @@
+/*
+ * Copyright (c) 2023-2023 Huawei Technologies Co., Ltd. All rights reserved.
+ *
+ * UniProton is licensed under Mulan PSL v2.
+ * You can use this software according to the terms and conditions of the Mulan PSL v2.
+ * You may obtain a copy of Mulan PSL v2 at:
+ *          http://license.coscl.org.cn/MulanPSL2
+ * THIS SOFTWARE IS PROVIDED ON AN "AS IS" BASIS, WITHOUT WARRANTIES OF ANY KIND,
+ * EITHER EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO NON-INFRINGEMENT,
+ * MERCHANTABILITY OR FIT FOR A PARTICULAR PURPOSE.
+ * See the Mulan PSL v2 for more details.
+ * Create: 2023-06-01
+ * Description: 字节流缓冲区函数实现
+ */
+#include "securec.h"
+#include "prt_queue_internal.h"
+#include "prt_mem_external.h"
+
+/*
+ * 描述：获取字节流缓冲区控制块，队列未创建或不是字节流缓冲区时返回错误码
+ */
+OS_SEC_ALW_INLINE INLINE U32 OsQueueStreamCbGet(U32 queueId, struct TagQueCb **queueCb)
+{
+    U32 innerId = OS_QUEUE_INNER_ID(queueId);
+
+    if (innerId >= g_maxQueue) {
+        return OS_ERRNO_QUEUE_INVALID;
+    }
+
+    *queueCb = (struct TagQueCb *)GET_QUEUE_HANDLE(innerId);
+    if ((*queueCb)->queueState == OS_QUEUE_UNUSED) {
+        return OS_ERRNO_QUEUE_NOT_CREATE;
+    }
+
+    if ((*queueCb)->queueAttr != OS_QUEUE_ATTR_STREAM) {
+        return OS_ERRNO_QUEUE_ATTR_INVALID;
+    }
+
+    return OS_OK;
+}
+
+/*
+ * 描述：唤醒阻塞在字节流缓冲区上的读任务，仅在读任务阻塞且数据达到其等待字节数时调用
+ */
+OS_SEC_ALW_INLINE INLINE void OsQueueStreamWakeReader(struct TagQueCb *queueCb, U32 used)
+{
+    uintptr_t intSave;
+    struct QueStreamCtrl *ctrl = OS_QUEUE_STREAM_CTRL(queueCb);
+
+    intSave = OsIntLock();
+    /* 关中断后重新检查，读任务可能已超时返回 */
+    if ((ctrl->waitLevel != 0) && (used >= ctrl->waitLevel)) {
+        ctrl->waitLevel = 0;
+        if (OsQueuePendNeedProc(queueCb, &queueCb->readList)) {
+            OsTskSchedule();
+        }
+    }
+    OsIntRestore(intSave);
+}
+
+/*
+ * 描述：写字节流缓冲区，空闲空间不足时只写入能容纳的部分，不阻塞，可在中断中调用
+ */
+OS_SEC_L2_TEXT U32 PRT_QueueStreamWrite(U32 queueId, const void *bufferAddr, U32 bufferSize, U32 *written)
+{
+    U32 ret;
+    U32 head;
+    U32 tail;
+    U32 len;
+    U32 offset;
+    U32 firstLen;
+    U32 used;
+    U8 *buf = NULL;
+    struct TagQueCb *queueCb = NULL;
+    struct QueStreamCtrl *ctrl = NULL;
+
+    if ((bufferAddr == NULL) || (written == NULL)) {
+        return OS_ERRNO_QUEUE_PTR_NULL;
+    }
+
+    ret = OsQueueStreamCbGet(queueId, &queueCb);
+    if (ret != OS_OK) {
+        return ret;
+    }
+
+    ctrl = OS_QUEUE_STREAM_CTRL(queueCb);
+    buf = OS_QUEUE_STREAM_BUF(queueCb);
+
+    /* 单生产者，tail只由写者修改；head可能被读任务并发推进，只会使空闲空间变大 */
+    tail = ctrl->tail;
+    head = ctrl->head;
+    OS_QUEUE_STREAM_BARRIER();
+
+    len = ctrl->bufSize - (tail - head);
+    if (bufferSize < len) {
+        len = bufferSize;
+    }
+
+    offset = tail & (ctrl->bufSize - 1);
+    firstLen = ctrl->bufSize - offset;
+    if (len < firstLen) {
+        firstLen = len;
+    }
+
+    if ((firstLen != 0) && (memcpy_s(&buf[offset], ctrl->bufSize - offset, bufferAddr, firstLen) != EOK)) {
+        OS_GOTO_SYS_ERROR1();
+    }
+
+    if ((len > firstLen) && (memcpy_s(buf, ctrl->bufSize, (const U8 *)bufferAddr + firstLen, len - firstLen) != EOK)) {
+        OS_GOTO_SYS_ERROR1();
+    }
+
+    /* 数据拷贝完成后再发布tail，读任务看到新的tail时数据已经可见 */
+    OS_QUEUE_STREAM_BARRIER();
+    ctrl->tail = tail + len;
+    OS_QUEUE_STREAM_BARRIER();
+
+    used = (tail + len) - head;
+    if (used > ctrl->peak) {
+        ctrl->peak = used;
+    }
+
+    *written = len;
+
+    /* 无读任务阻塞时不进入临界区，写路径无锁 */
+    if ((ctrl->waitLevel != 0) && (used >= ctrl->waitLevel)) {
+        OsQueueStreamWakeReader(queueCb, used);
+    }
+
+    return OS_OK;
+}
+
+/*
+ * 描述：读字节流缓冲区，数据不足触发水位时阻塞，超时后返回已有的数据
+ */
+OS_SEC_L2_TEXT U32 PRT_QueueStreamRead(U32 queueId, void *bufferAddr, U32 *len, U32 timeOut)
+{
+    U32 ret;
+    U32 head;
+    U32 used;
+    U32 need;
+    U32 offset;
+    U32 firstLen;
+    uintptr_t intSave;
+    U8 *buf = NULL;
+    struct TagQueCb *queueCb = NULL;
+    struct QueStreamCtrl *ctrl = NULL;
+
+    if ((bufferAddr == NULL) || (len == NULL)) {
+        return OS_ERRNO_QUEUE_PTR_NULL;
+    }
+
+    if (*len == 0) {
+        return OS_ERRNO_QUEUE_SIZE_ZERO;
+    }
+
+    intSave = OsIntLock();
+    ret = OsQueueStreamCbGet(queueId, &queueCb);
+    if (ret != OS_OK) {
+        OsIntRestore(intSave);
+        return ret;
+    }
+
+    ctrl = OS_QUEUE_STREAM_CTRL(queueCb);
+    buf = OS_QUEUE_STREAM_BUF(queueCb);
+    head = ctrl->head;
+
+    /* 读缓冲区小于触发水位时，数据填满读缓冲区即可返回 */
+    need = (*len < ctrl->triggerLevel) ? *len : ctrl->triggerLevel;
+    used = ctrl->tail - head;
+    if (used < need) {
+        ctrl->waitLevel = need;
+        /* 被写者唤醒后到恢复运行前计入busyCnt，期间不能删除缓冲区 */
+        ret = OsQueuePendSelf(queueCb, &queueCb->readList, timeOut);
+        ctrl->waitLevel = 0;
+        used = ctrl->tail - head;
+    }
+    OsIntRestore(intSave);
+
+    /* 超时或不等待时只要有数据就返回已有的数据 */
+    if (used == 0) {
+        return (ret == OS_OK) ? OS_ERRNO_QUEUE_NO_SOURCE : ret;
+    }
+
+    OS_QUEUE_STREAM_BARRIER();
+
+    if (*len > used) {
+        *len = used;
+    }
+
+    offset = head & (ctrl->bufSize - 1);
+    firstLen = ctrl->bufSize - offset;
+    if (*len < firstLen) {
+        firstLen = *len;
+    }
+
+    if (memcpy_s(bufferAddr, *len, &buf[offset], firstLen) != EOK) {
+        OS_GOTO_SYS_ERROR1();
+    }
+
+    if ((*len > firstLen) && (memcpy_s((U8 *)bufferAddr + firstLen, *len - firstLen, buf, *len - firstLen) != EOK)) {
+        OS_GOTO_SYS_ERROR1();
+    }
+
+    /* 数据读出后再发布head，写者看到新的head时该段空间才可被覆盖 */
+    OS_QUEUE_STREAM_BARRIER();
+    ctrl->head = head + *len;
+
+    return OS_OK;
+}
+
+/*
+ * 描述：设置字节流缓冲区的触发水位
+ */
+OS_SEC_L4_TEXT U32 PRT_QueueStreamTriggerSet(U32 queueId, U32 triggerLevel)
+{
+    U32 ret;
+    uintptr_t intSave;
+    struct TagQueCb *queueCb = NULL;
+
+    intSave = OsIntLock();
+    ret = OsQueueStreamCbGet(queueId, &queueCb);
+    if (ret != OS_OK) {
+        OsIntRestore(intSave);
+        return ret;
+    }
+
+    if ((triggerLevel == 0) || (triggerLevel > OS_QUEUE_STREAM_CTRL(queueCb)->bufSize)) {
+        OsIntRestore(intSave);
+        return OS_ERRNO_QUEUE_TRIGGER_INVALID;
+    }
+
+    OS_QUEUE_STREAM_CTRL(queueCb)->triggerLevel = triggerLevel;
+    OsIntRestore(intSave);
+
+    return OS_OK;
+}
+
+OS_SEC_L4_TEXT U32 OsQueueStreamCreate(U32 bufSize, U32 triggerLevel, U32 *queueId)
+{
+    U32 index;
+    struct TagQueCb *queueCb = NULL;
+    struct QueStreamCtrl *ctrl = NULL;
+
+    /* 获取一个空闲的队列资源 */
+    queueCb = g_allQueue;
+    for (index = 0; index < g_maxQueue; index++, queueCb++) {
+        if (queueCb->queueState == OS_QUEUE_UNUSED) {
+            break;
+        }
+    }
+
+    if (index == g_maxQueue) {
+        return OS_ERRNO_QUEUE_CB_UNAVAILABLE;
+    }
+
+    queueCb->queue = (U8 *)OsMemAlloc(OS_MID_QUEUE, OS_MEM_DEFAULT_FSC_PT, sizeof(struct QueStreamCtrl) + bufSize);
+    if (queueCb->queue == NULL) {
+        return OS_ERRNO_QUEUE_CREATE_NO_MEMORY;
+    }
+
+    ctrl = OS_QUEUE_STREAM_CTRL(queueCb);
+    ctrl->head = 0;
+    ctrl->tail = 0;
+    ctrl->bufSize = bufSize;
+    ctrl->triggerLevel = triggerLevel;
+    ctrl->waitLevel = 0;
+    ctrl->peak = 0;
+
+    /* 字节流缓冲区不按节点管理，节点相关字段不使用 */
+    queueCb->nodeNum = 0;
+    queueCb->nodeSize = 0;
+    queueCb->queueState = OS_QUEUE_USED;
+    queueCb->queueAttr = OS_QUEUE_ATTR_STREAM;
+    INIT_LIST_OBJECT(&queueCb->writeList);
+    INIT_LIST_OBJECT(&queueCb->readList);
+    queueCb->writableCnt = 0;
+    queueCb->queueHead = 0;
+    queueCb->queueTail = 0;
+    queueCb->nodePeak = 0;
+    queueCb->overwriteCnt = 0;
+    queueCb->readableCnt = 0;
+    queueCb->busyCnt = 0;
+    queueCb->link = NULL;
+
+    *queueId = OS_QUEUE_ID(index);
+
+    return OS_OK;
+}
+
+/*
+ * 描述：创建字节流缓冲区接口
+ */
+OS_SEC_L4_TEXT U32 PRT_QueueCreateStream(U32 bufSize, U32 triggerLevel, U32 *queueId)
+{
+    uintptr_t intSave;
+    U32 ret;
+
+    if (queueId == NULL) {
+        return OS_ERRNO_QUEUE_CREAT_PTR_NULL;
+    }
+
+    if (bufSize == 0) {
+        return OS_ERRNO_QUEUE_PARA_ZERO;
+    }
+
+    /* 缓冲区大小为2的幂，读写索引自由增长，回绕时仍能直接相减得到数据量 */
+    if (((bufSize & (bufSize - 1)) != 0) || (bufSize > OS_QUEUE_VARLEN_BUF_MAX)) {
+        return OS_ERRNO_QUEUE_BUF_SIZE_INVALID;
+    }
+
+    if ((triggerLevel == 0) || (triggerLevel > bufSize)) {
+        return OS_ERRNO_QUEUE_TRIGGER_INVALID;
+    }
+
+    intSave = OsIntLock();
+    ret = OsQueueStreamCreate(bufSize, triggerLevel, queueId);
+    OsIntRestore(intSave);
+
+    return ret;
+}
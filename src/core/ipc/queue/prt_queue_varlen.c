@@ -0,0 +1,266 @@
+/*
+ * Copyright (c) 2023-2023 Huawei Technologies Co., Ltd. All rights reserved.
+ *
+ * UniProton is licensed under Mulan PSL v2.
+ * You can use this software according to the terms and conditions of the Mulan PSL v2.
+ * You may obtain a copy of Mulan PSL v2 at:
+ *          http://license.coscl.org.cn/MulanPSL2
+ * THIS SOFTWARE IS PROVIDED ON AN "AS IS" BASIS, WITHOUT WARRANTIES OF ANY KIND,
+ * EITHER EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO NON-INFRINGEMENT,
+ * MERCHANTABILITY OR FIT FOR A PARTICULAR PURPOSE.
+ * See the Mulan PSL v2 for more details.
+ * Create: 2023-06-01
+ * Description: 变长消息队列函数实现
+ */
+#include "securec.h"
+#include "prt_queue_internal.h"
+#include "prt_mem_external.h"
+#include "prt_sys_external.h"
+
+OS_SEC_ALW_INLINE INLINE U32 OsQueueVarLenOffsetAdd(const struct QueVarLenCtrl *ctrl, U32 offset, U32 len)
+{
+    offset += len;
+    if (offset >= ctrl->bufSize) {
+        offset -= ctrl->bufSize;
+    }
+
+    return offset;
+}
+
+/*
+ * 描述：从offset处向环形缓冲区写入数据，数据跨越缓冲区尾部时回卷到缓冲区头部
+ */
+OS_SEC_ALW_INLINE INLINE U32 OsQueueVarLenCopyIn(struct TagQueCb *queueCb, U32 offset, const void *src, U32 len)
+{
+    struct QueVarLenCtrl *ctrl = OS_QUEUE_VARLEN_CTRL(queueCb);
+    U8 *buf = OS_QUEUE_VARLEN_BUF(queueCb);
+    U32 firstLen = ctrl->bufSize - offset;
+
+    if (len <= firstLen) {
+        firstLen = len;
+    }
+
+    if (firstLen != 0 && memcpy_s(&buf[offset], ctrl->bufSize - offset, src, firstLen) != EOK) {
+        OS_GOTO_SYS_ERROR1();
+    }
+
+    if ((len > firstLen) && (memcpy_s(buf, ctrl->bufSize, (const U8 *)src + firstLen, len - firstLen) != EOK)) {
+        OS_GOTO_SYS_ERROR1();
+    }
+
+    return OsQueueVarLenOffsetAdd(ctrl, offset, len);
+}
+
+/*
+ * 描述：从环形缓冲区的offset处读出数据，数据跨越缓冲区尾部时从缓冲区头部继续读取
+ */
+OS_SEC_ALW_INLINE INLINE void OsQueueVarLenCopyOut(struct TagQueCb *queueCb, U32 offset, void *dst, U32 len)
+{
+    struct QueVarLenCtrl *ctrl = OS_QUEUE_VARLEN_CTRL(queueCb);
+    U8 *buf = OS_QUEUE_VARLEN_BUF(queueCb);
+    U32 firstLen = ctrl->bufSize - offset;
+
+    if (len <= firstLen) {
+        firstLen = len;
+    }
+
+    if (firstLen != 0 && memcpy_s(dst, len, &buf[offset], firstLen) != EOK) {
+        OS_GOTO_SYS_ERROR1();
+    }
+
+    if ((len > firstLen) && (memcpy_s((U8 *)dst + firstLen, len - firstLen, buf, len - firstLen) != EOK)) {
+        OS_GOTO_SYS_ERROR1();
+    }
+}
+
+/*
+ * 描述：等待环形缓冲区中有recordLen字节的空闲空间，这个函数在调用之前必须关中断。
+ */
+OS_SEC_L4_TEXT U32 OsQueueVarLenPend(struct TagQueCb *queueCb, U32 recordLen, U32 timeOut)
+{
+    U32 ret;
+    U64 expireTick = g_uniTicks + timeOut;
+    U32 waitTime = timeOut;
+    struct QueVarLenCtrl *ctrl = OS_QUEUE_VARLEN_CTRL(queueCb);
+
+    while (ctrl->freeSize < recordLen) {
+        ret = OsQueuePendSelf(queueCb, &queueCb->writeList, waitTime);
+        if (ret != OS_OK) {
+            return ret;
+        }
+
+        if (ctrl->freeSize >= recordLen) {
+            break;
+        }
+
+        /* 被唤醒后空间仍不足(被其他写任务占用)，按剩余时间继续等待 */
+        if (timeOut != OS_QUEUE_WAIT_FOREVER) {
+            if (g_uniTicks >= expireTick) {
+                return OS_ERRNO_QUEUE_TIMEOUT;
+            }
+            waitTime = (U32)(expireTick - g_uniTicks);
+        }
+    }
+
+    return OS_OK;
+}
+
+/*
+ * 描述：向环形缓冲区写入一条消息记录，普通消息写到尾部，紧急消息写到头部
+ */
+OS_SEC_L4_TEXT void OsQueueVarLenCpData(struct TagQueCb *queueCb, U32 prio, uintptr_t bufferAddr, U32 bufferSize,
+                                        U32 srcPid)
+{
+    U32 offset;
+    U32 recordLen = bufferSize + OS_QUEUE_NODE_HEAD_LEN;
+    struct QueNode nodeHead;
+    struct QueVarLenCtrl *ctrl = OS_QUEUE_VARLEN_CTRL(queueCb);
+
+    nodeHead.srcPid = (U16)srcPid;
+    nodeHead.size = (U16)bufferSize;
+
+    if (prio == (U32)OS_QUEUE_NORMAL) {
+        offset = OsQueueVarLenCopyIn(queueCb, ctrl->tail, &nodeHead, OS_QUEUE_NODE_HEAD_LEN);
+        ctrl->tail = OsQueueVarLenCopyIn(queueCb, offset, (void *)bufferAddr, bufferSize);
+    } else {
+        /* 紧急消息加到队列头上，头偏移向前回退一条记录的长度 */
+        ctrl->head = OsQueueVarLenOffsetAdd(ctrl, ctrl->head, ctrl->bufSize - recordLen);
+        offset = OsQueueVarLenCopyIn(queueCb, ctrl->head, &nodeHead, OS_QUEUE_NODE_HEAD_LEN);
+        (void)OsQueueVarLenCopyIn(queueCb, offset, (void *)bufferAddr, bufferSize);
+    }
+
+    ctrl->freeSize -= recordLen;
+    ctrl->msgNum++;
+
+    if (ctrl->msgNum > queueCb->nodePeak) {
+        queueCb->nodePeak = (U16)ctrl->msgNum;
+    }
+}
+
+/*
+ * 描述：从环形缓冲区头部读出一条消息记录，*len传入buf大小，输出实际读取的长度
+ */
+OS_SEC_L4_TEXT void OsQueueVarLenRead(struct TagQueCb *queueCb, void *bufferAddr, U32 *len)
+{
+    U32 offset;
+    struct QueNode nodeHead;
+    struct QueVarLenCtrl *ctrl = OS_QUEUE_VARLEN_CTRL(queueCb);
+
+    OsQueueVarLenCopyOut(queueCb, ctrl->head, &nodeHead, OS_QUEUE_NODE_HEAD_LEN);
+    offset = OsQueueVarLenOffsetAdd(ctrl, ctrl->head, OS_QUEUE_NODE_HEAD_LEN);
+
+    /* 如果buf的长度小于数据长度，则仅返回buf大小的数据，如果大于，则返回全部数据 */
+    if (*len > nodeHead.size) {
+        *len = nodeHead.size;
+    }
+    OsQueueVarLenCopyOut(queueCb, offset, bufferAddr, *len);
+
+    ctrl->head = OsQueueVarLenOffsetAdd(ctrl, offset, nodeHead.size);
+    ctrl->freeSize += (U32)nodeHead.size + OS_QUEUE_NODE_HEAD_LEN;
+    ctrl->msgNum--;
+}
+
+/*
+ * 描述：统计环形缓冲区中指定源PID的消息条数及消息总条数
+ */
+OS_SEC_L2_TEXT void OsQueueVarLenNodeNum(struct TagQueCb *queueCb, U32 taskPid, U32 *num, U32 *numAll)
+{
+    U32 loop;
+    U32 offset;
+    struct QueNode nodeHead;
+    struct QueVarLenCtrl *ctrl = OS_QUEUE_VARLEN_CTRL(queueCb);
+
+    offset = ctrl->head;
+    for (loop = 0; loop < ctrl->msgNum; loop++) {
+        OsQueueVarLenCopyOut(queueCb, offset, &nodeHead, OS_QUEUE_NODE_HEAD_LEN);
+        if (nodeHead.srcPid == taskPid) {
+            (*num)++;
+        }
+        offset = OsQueueVarLenOffsetAdd(ctrl, offset, (U32)nodeHead.size + OS_QUEUE_NODE_HEAD_LEN);
+    }
+
+    *numAll = ctrl->msgNum;
+}
+
+OS_SEC_L4_TEXT U32 OsQueueVarLenCreate(U32 bufSize, U16 maxNodeSize, U32 *queueId)
+{
+    U32 index;
+    struct TagQueCb *queueCb = NULL;
+    struct QueVarLenCtrl *ctrl = NULL;
+
+    /* 获取一个空闲的队列资源 */
+    queueCb = g_allQueue;
+    for (index = 0; index < g_maxQueue; index++, queueCb++) {
+        if (queueCb->queueState == OS_QUEUE_UNUSED) {
+            break;
+        }
+    }
+
+    if (index == g_maxQueue) {
+        return OS_ERRNO_QUEUE_CB_UNAVAILABLE;
+    }
+
+    queueCb->queue = (U8 *)OsMemAlloc(OS_MID_QUEUE, OS_MEM_DEFAULT_FSC_PT, sizeof(struct QueVarLenCtrl) + bufSize);
+    if (queueCb->queue == NULL) {
+        return OS_ERRNO_QUEUE_CREATE_NO_MEMORY;
+    }
+
+    ctrl = OS_QUEUE_VARLEN_CTRL(queueCb);
+    ctrl->bufSize = bufSize;
+    ctrl->head = 0;
+    ctrl->tail = 0;
+    ctrl->freeSize = bufSize;
+    ctrl->msgNum = 0;
+
+    /* 变长消息队列不按节点管理，nodeNum及writableCnt不使用，nodeSize用于校验消息长度 */
+    queueCb->nodeNum = 0;
+    queueCb->nodeSize = (U16)(maxNodeSize + OS_QUEUE_NODE_HEAD_LEN);
+    queueCb->queueState = OS_QUEUE_USED;
+    queueCb->queueAttr = OS_QUEUE_ATTR_VARLEN;
+    INIT_LIST_OBJECT(&queueCb->writeList);
+    INIT_LIST_OBJECT(&queueCb->readList);
+    queueCb->writableCnt = 0;
+    queueCb->queueHead = 0;
+    queueCb->queueTail = 0;
+    queueCb->nodePeak = 0;
+    queueCb->overwriteCnt = 0;
+    queueCb->readableCnt = 0;
+    queueCb->busyCnt = 0;
+    queueCb->link = NULL;
+
+    *queueId = OS_QUEUE_ID(index);
+
+    return OS_OK;
+}
+
+/*
+ * 描述：创建变长消息队列接口
+ */
+OS_SEC_L4_TEXT U32 PRT_QueueCreateVarLen(U32 bufSize, U16 maxNodeSize, U32 *queueId)
+{
+    uintptr_t intSave;
+    U32 ret;
+
+    if (queueId == NULL) {
+        return OS_ERRNO_QUEUE_CREAT_PTR_NULL;
+    }
+
+    if ((bufSize == 0) || (maxNodeSize == 0)) {
+        return OS_ERRNO_QUEUE_PARA_ZERO;
+    }
+
+    if (((U32)maxNodeSize + OS_QUEUE_NODE_HEAD_LEN) > OS_MAX_U16) {
+        return OS_ERRNO_QUEUE_NSIZE_INVALID;
+    }
+
+    /* 缓冲区至少容纳一条最大长度的消息；限制上限保证消息条数不超过U16的读计数范围 */
+    if ((bufSize < ((U32)maxNodeSize + OS_QUEUE_NODE_HEAD_LEN)) || (bufSize > OS_QUEUE_VARLEN_BUF_MAX)) {
+        return OS_ERRNO_QUEUE_BUF_SIZE_INVALID;
+    }
+
+    intSave = OsIntLock();
+    ret = OsQueueVarLenCreate(bufSize, maxNodeSize, queueId);
+    OsIntRestore(intSave);
+
+    return ret;
+}
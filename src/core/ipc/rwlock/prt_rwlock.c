@@ -14,6 +14,7 @@
  */
 #include "prt_rwlock_internal.h"
 #include "prt_task_external.h"
+#include "prt_trace_external.h"
 
 OS_SEC_ALW_INLINE INLINE bool OsRwlockPriCompare(struct TagTskCb *runTask, struct TagListObject *rwList)
 {
@@ -75,6 +76,7 @@ struct TagListObject *OsRwLockPendFindPos(struct TagTskCb *runTask, struct TagLi
 void OsRwLockPendPre(struct TagTskCb *runTask, struct TagListObject *list, U32 timeout)
 {
     OsTskReadyDel(runTask);
+    OS_TRACE(OS_TRACE_EVENT_TASK_BLOCK, runTask->taskPid, 0, 0);
 
     TSK_STATUS_SET(runTask, OS_TSK_PEND);
 
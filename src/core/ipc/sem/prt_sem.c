@@ -14,6 +14,12 @@
  */
 #include "prt_sem_external.h"
 #include "prt_asm_cpu_external.h"
+#include "prt_trace_external.h"
+
+/* 互斥信号量与计数信号量记录为不同的跟踪事件 */
+#define OS_SEM_TRACE(sem, semEvent, mutexEvent, arg0, arg1, arg2)                                \
+    OS_TRACE((GET_SEM_TYPE((sem)->semType) == SEM_TYPE_BIN) ? (mutexEvent) : (semEvent), (arg0), \
+        (arg1), (arg2))
 
 /* 核内信号量最大个数 */
 OS_SEC_BSS U16 g_maxSem;
@@ -80,6 +86,7 @@ OS_SEC_L0_TEXT void OsSemPendListPut(struct TagSemCb *semPended, U32 timeOut)
     struct TagListObject *pendObj = &runTsk->pendList;
 
     OsTskReadyDel((struct TagTskCb *)runTsk);
+    OS_TRACE(OS_TRACE_EVENT_TASK_BLOCK, runTsk->taskPid, 0, 0);
 
     runTsk->taskSem = (void *)semPended;
 
@@ -198,6 +205,7 @@ OS_SEC_L0_TEXT U32 PRT_SemPend(SemHandle semHandle, U32 timeout)
     runTsk = (struct TagTskCb *)RUNNING_TASK;
 
     if (OsSemPendNotNeedSche(semPended, runTsk) == TRUE) {
+        OS_SEM_TRACE(semPended, OS_TRACE_EVENT_SEM_PEND, OS_TRACE_EVENT_MUTEX_PEND, semHandle, timeout, 0);
         OsIntRestore(intSave);
         return OS_OK;
     }
@@ -207,6 +215,7 @@ OS_SEC_L0_TEXT U32 PRT_SemPend(SemHandle semHandle, U32 timeout)
         OsIntRestore(intSave);
         return ret;
     }
+    OS_SEM_TRACE(semPended, OS_TRACE_EVENT_SEM_PEND, OS_TRACE_EVENT_MUTEX_PEND, semHandle, timeout, 1);
     /* 把当前任务挂接在信号量链表上 */
     OsSemPendListPut(semPended, timeout);
     if (timeout != OS_WAIT_FOREVER) {
@@ -295,6 +304,8 @@ OS_SEC_L0_TEXT U32 PRT_SemPost(SemHandle semHandle)
         return OS_OK;
     }
 
+    OS_SEM_TRACE(semPosted, OS_TRACE_EVENT_SEM_POST, OS_TRACE_EVENT_MUTEX_POST, semHandle,
+        !ListEmpty(&semPosted->semList), 0);
     /* 如果有任务阻塞在信号量上，就激活信号量阻塞队列上的首个任务 */
     if (!ListEmpty(&semPosted->semList)) {
         OsSemPostSchePre(semPosted);
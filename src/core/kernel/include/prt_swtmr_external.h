@@ -47,12 +47,18 @@ struct TagSwTmrCtrl {
     U8 mode;
     /* 软件定时器序号 */
     U16 swtmrIndex;
-    /* 定时器SortLink属性，低位为rollNum，高位为sortIndex */
-    U32 idxRollNum;
+    /* 定时器未计时时的剩余Tick数，启动时从该值开始计时，为0时从interval开始计时 */
+    U32 remain;
     /* 定时器超时时间 */
     U32 interval;
+    /* 定时器到期时间允许延后的Tick数 */
+    U32 slack;
+    /* 定时器计时时的绝对到期Tick数 */
+    U64 expire;
     /* 定时器超时次数 */
     U8 overrun;
+    /* 本次到期Tick按容差移动过 */
+    U8 slackMoved;
     /* 定时器用户参数1 */
     U32 arg1;
     /* 定时器用户参数2 */
@@ -66,13 +72,11 @@ struct TagSwTmrCtrl {
 
 }; /* 定时器数据类型 */
 
-struct TagSwTmrSortLinkAttr {
-    /* Tick游标位置 */
-    U16 cursor;
-    /* 保留数据 */
-    U16 unused;
-    /* 软件定时器指针数组 */
-    struct TagListObject *sortLink;
+struct TagSwTmrWheel {
+    /* 时间轮已处理到的Tick数 */
+    U64 curTick;
+    /* 各级时间轮的链表头数组 */
+    struct TagListObject *slot;
 };
 
 /*
@@ -97,6 +101,27 @@ extern struct TagSwTmrCtrl *g_swtmrCbArray;
  */
 extern U32 OsSwTmrQuery(TimerHandle tmrHandle, U32 *expireTime);
 
+/*
+ * Function    : OsSwTmrArm
+ * Description : 设置软件定时器的首次到期时间和周期并启动
+ * Input       : tmrHandle  --- 定时器句柄
+ *               expire     --- 首次到期Tick数，为0时停止定时器
+ *               interval   --- 周期Tick数，为0时为单次定时器
+ * Output      : None
+ * Return      : 成功时返回OS_OK，失败时返回错误码
+ */
+extern U32 OsSwTmrArm(TimerHandle tmrHandle, U32 expire, U32 interval);
+
+/*
+ * Function    : OsSwTmrTickQuery
+ * Description : 查询软件定时器剩余Tick数及周期Tick数
+ * Input       : tmrHandle  --- 定时器句柄
+ * Output      : remain     --- 剩余Tick数，未启动时为0
+ *               interval   --- 周期Tick数，单次定时器为0
+ * Return      : 成功时返回OS_OK，失败时返回错误码
+ */
+extern U32 OsSwTmrTickQuery(TimerHandle tmrHandle, U32 *remain, U32 *interval);
+
 /*
  * 模块间内联函数定义
  */
@@ -20,6 +20,8 @@
 #include "prt_sem.h"
 #include "prt_tick.h"
 #include "prt_list_external.h"
+#include "prt_lib_external.h"
+#include "prt_seqlock_external.h"
 #include "prt_asm_cpu_external.h"
 #include "prt_cpu_external.h"
 
@@ -42,8 +44,8 @@
 #define OS_SYS_TASK_STATUS(flag) (((flag) & OS_THREAD_FLAG_MASK) == OS_FLG_BGD_ACTIVE)
 #define OS_SYS_HWI_STATUS(flag) (((flag) & OS_FLG_HWI_ACTIVE) != 0)
 
-#define OS_MS2CYCLE(ms, clock) DIV64(((ms) * (U64)(clock)), OS_SYS_MS_PER_SECOND) /* 毫秒转换成cycle */
-#define OS_US2CYCLE(us, clock) DIV64(((us) * (U64)(clock)), OS_SYS_US_PER_SECOND) /* 微秒转换成cycle */
+#define OS_MS2CYCLE(ms, clock) OsLibDiv(((ms) * (U64)(clock)), &g_sysClkConv.msPerSec) /* 毫秒转换成cycle */
+#define OS_US2CYCLE(us, clock) OsLibDiv(((us) * (U64)(clock)), &g_sysClkConv.usPerSec) /* 微秒转换成cycle */
 
 /*
  * 模块间typedef声明
@@ -52,6 +54,31 @@ typedef void (*TickDispFunc)(void);
 /* 有TICK情况下CPU占用率触发函数类型定义。 */
 typedef void (*TickEntryFunc)(void);
 typedef void (*TaskScanFunc)(void);
+
+/*
+ * 时间管理核心数据及g_uniTicks由Tick中断在关中断下按顺序锁写侧更新，
+ * 任务和中断通过顺序锁读取一致的快照，不需要关中断，32位平台上读64位数据也不会读到一半更新的值
+ */
+struct TagTimeKeeper {
+    struct SeqLock lock;
+    /* 最近一次Tick中断的cycle数 */
+    U64 tickCycle;
+    /* 实时时间相对cycle换算时间的偏移，单位纳秒 */
+    S64 realOffset;
+};
+
+/* 系统主频确定后预先计算的换算因子，cycle转换时间时不做64位除法 */
+struct SysClkConv {
+    struct LibMulShift cycle2Ns;
+    struct LibMulShift cycle2Us;
+    struct LibMulShift cycle2Ms;
+    /* 纳秒转换为秒，与主频无关 */
+    struct LibMulShift ns2Sec;
+    /* 以每秒毫秒数、微秒数及每秒Tick数为除数的倒数因子，结果与64位除法一致 */
+    struct LibDivConst msPerSec;
+    struct LibDivConst usPerSec;
+    struct LibDivConst tickPerSec;
+};
 /*
  * 模块间全局变量声明
  */
@@ -60,9 +87,12 @@ extern U32 g_tickNoRespondCnt;
 #define TICK_NO_RESPOND_CNT g_tickNoRespondCnt
 
 extern U32 g_systemClock;
+extern SysTimeFunc g_sysTimeHook;
+extern struct SysClkConv g_sysClkConv;
 
 extern struct TickModInfo g_tickModInfo;
 extern U64 g_uniTicks;
+extern struct TagTimeKeeper g_timeKeeper;
 extern TickEntryFunc g_tickTaskEntry;
 extern TaskScanFunc g_taskScanHook;
 extern TickDispFunc g_tickDispatcher;
@@ -88,6 +118,65 @@ extern enum SysThreadType OsCurThreadType(void);
         }                             \
     } while (0)
 
+/*
+ * 描述：cycle数转换为纳秒，结果随cycle单调递增
+ */
+OS_SEC_ALW_INLINE INLINE U64 OsCycle2Ns(U64 cycle)
+{
+    return OsLibMulShift(cycle, &g_sysClkConv.cycle2Ns);
+}
+
+/*
+ * 描述：无锁读取当前Tick计数及该Tick中断发生时的cycle数，tickCycle可以为NULL
+ */
+OS_SEC_ALW_INLINE INLINE U64 OsTimeKeeperTickGet(U64 *tickCycle)
+{
+    U32 seq;
+    U64 ticks;
+    U64 cycle;
+
+    do {
+        seq = OsSeqReadBegin(&g_timeKeeper.lock);
+        ticks = g_uniTicks;
+        cycle = g_timeKeeper.tickCycle;
+    } while (OsSeqReadRetry(&g_timeKeeper.lock, seq));
+
+    if (tickCycle != NULL) {
+        *tickCycle = cycle;
+    }
+    return ticks;
+}
+
+/*
+ * 描述：无锁读取实时时间偏移
+ */
+OS_SEC_ALW_INLINE INLINE S64 OsTimeKeeperRealOffsetGet(void)
+{
+    U32 seq;
+    S64 offset;
+
+    do {
+        seq = OsSeqReadBegin(&g_timeKeeper.lock);
+        offset = g_timeKeeper.realOffset;
+    } while (OsSeqReadRetry(&g_timeKeeper.lock, seq));
+
+    return offset;
+}
+
+/*
+ * 描述：设置实时时间偏移，写侧关中断
+ */
+OS_SEC_ALW_INLINE INLINE void OsTimeKeeperRealOffsetSet(S64 offset)
+{
+    uintptr_t intSave = OsIntLock();
+
+    OsSeqWriteBegin(&g_timeKeeper.lock);
+    g_timeKeeper.realOffset = offset;
+    OsSeqWriteEnd(&g_timeKeeper.lock);
+
+    OsIntRestore(intSave);
+}
+
 OS_SEC_ALW_INLINE INLINE U32 OsSysGetTickPerSecond(void)
 {
     return g_tickModInfo.tickPerSecond;
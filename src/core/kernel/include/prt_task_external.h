@@ -43,6 +43,12 @@ struct TagOsTskSortedDelayList {
     struct TagListObject tskList;
 };
 
+#if defined(OS_OPTION_POSIX)
+/* 线程状态state除PTHREAD_CREATE_JOINABLE/PTHREAD_CREATE_DETACHED外的取值 */
+#define PTHREAD_TERMINATED  2
+#define PTHREAD_EXITED      3
+#endif
+
 /*
  * 任务线程及进程控制块的结构体统一定义。
  */
@@ -91,8 +97,20 @@ struct TagTskCb {
 
     /* 任务记录的最后一个错误码 */
     U32 lastErr;
+    /* 恢复的时间点按容差移动过 */
+    bool slackMoved;
     /* 任务恢复的时间点(单位Tick) */
     U64 expirationTick;
+#if defined(OS_OPTION_TASK_PERIOD_STAT)
+    /* 周期任务释放抖动统计 */
+    struct TskPeriodStat periodStat;
+#endif
+#if defined(OS_OPTION_TASK_WAKEUP_STAT)
+    /* 进入就绪态时的cycle数，0表示未等待运行 */
+    U64 readyCycle;
+    /* 唤醒时延统计 */
+    struct TskWakeupStat wakeupStat;
+#endif
 #if defined(OS_OPTION_POSIX)
     /* 当前任务状态 */
     U8 state;
@@ -210,6 +228,7 @@ extern void OsTskEntry(TskHandle taskId);
 extern void OsTaskExit(struct TagTskCb *tsk);
 extern void OsTskReadyAdd(struct TagTskCb *task);
 extern void OsTskReadyDel(struct TagTskCb *taskCb);
+extern void OsTskReadyRequeue(struct TagTskCb *taskCb);
 extern void OsTskSwitchHookCaller(U32 prevPid, U32 nextPid);
 extern void OsTskTimerAdd(struct TagTskCb *taskCb, uintptr_t timeout);
 
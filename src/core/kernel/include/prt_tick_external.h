@@ -16,6 +16,7 @@
 #define PRT_TICK_EXTERNAL_H
 
 #include "prt_tick.h"
+#include "prt_timer.h"
 
 /*
  * 模块间宏定义
@@ -35,8 +36,47 @@ extern TskmonTickHook g_tskMonHook;
 extern void OsTickDispatcher(void);
 
 extern U32 g_cyclePerTick;
+
+/* 容差对齐统计，软件定时器与任务延时共用 */
+extern struct SwTmrSlackStat g_tickSlackStat;
+/* 当前Tick到期的超时个数及其中到期Tick按容差移动过的个数，Tick处理结束时计入统计 */
+extern U32 g_tickSlackExpireNum;
+extern U32 g_tickSlackMovedNum;
 OS_SEC_ALW_INLINE INLINE U32 OsGetCyclePerTick(void)
 {
     return g_cyclePerTick;
 }
+
+/*
+ * 描述：在[expire, expire + slack]内选取低位连续0最多的Tick作为到期Tick，
+ * 容差窗口重叠的超时会落到同一个Tick上，从而合并处理
+ */
+OS_SEC_ALW_INLINE INLINE U64 OsTickSlackAlign(U64 expire, U32 slack)
+{
+    U64 limit = expire + slack;
+    U64 mask;
+
+    if ((slack == 0) || (expire == 0)) {
+        return expire;
+    }
+
+    /* limit与expire - 1不同的最高位以下全部清零，得到的Tick仍不小于expire */
+    mask = (expire - 1) ^ limit;
+    mask = ((U64)1 << (63U - (U32)__builtin_clzll(mask))) - 1;
+    if ((limit & ~mask) != expire) {
+        g_tickSlackStat.alignCount++;
+    }
+    return limit & ~mask;
+}
+
+/*
+ * 描述：记录一个在当前Tick到期的超时，moved表示其到期Tick由OsTickSlackAlign移动过，在Tick中断中调用
+ */
+OS_SEC_ALW_INLINE INLINE void OsTickSlackExpire(bool moved)
+{
+    g_tickSlackExpireNum++;
+    if (moved) {
+        g_tickSlackMovedNum++;
+    }
+}
 #endif /* PRT_TICK_EXTERNAL_H */
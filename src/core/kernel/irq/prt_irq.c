@@ -13,6 +13,7 @@
  * Description: 中断模块
  */
 #include "prt_irq_internal.h"
+#include "prt_trace_external.h"
 
 /* 业务没有注册中断服务程序，却触发了中断时，记录的中断号 */
 OS_SEC_L4_BSS U32 g_defHandlerHwiNum;
@@ -143,11 +144,13 @@ OS_SEC_TEXT void OsHwiHookDispatcher(HwiHandle archHwi)
     HwiHandle hwiNum = OS_HWI_GET_HWINUM(archHwi);
     U32 irqNum = OS_HWI2IRQ(hwiNum);
 
+    OS_TRACE(OS_TRACE_EVENT_HWI_ENTRY, hwiNum, 0, 0);
     OS_MHOOK_ACTIVATE_PARA1(OS_HOOK_HWI_ENTRY, hwiNum);
 
     OsHwiHandleActive(irqNum);
 
     OS_MHOOK_ACTIVATE_PARA1(OS_HOOK_HWI_EXIT, hwiNum);
+    OS_TRACE(OS_TRACE_EVENT_HWI_EXIT, hwiNum, 0, 0);
 }
 
 static OS_SEC_L4_TEXT U32 OsHwiSetAttrParaCheck(HwiHandle hwiNum, HwiPrior hwiPrio, HwiMode mode)
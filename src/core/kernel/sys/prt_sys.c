@@ -19,6 +19,8 @@
 
 /* 系统主频 */
 OS_SEC_BSS U32 g_systemClock;
+/* 主频对应的cycle换算因子 */
+OS_SEC_BSS struct SysClkConv g_sysClkConv;
 
 /* cpup */
 OS_SEC_BSS TickEntryFunc g_tickTaskEntry;
@@ -31,6 +33,8 @@ OS_SEC_BSS struct TickModInfo g_tickModInfo;
 OS_SEC_L4_BSS U32 g_threadNum;
 /* Tick计数 */
 OS_SEC_BSS U64 g_uniTicks;
+/* 时间管理核心数据，g_uniTicks也由其中的顺序锁保护 */
+OS_SEC_BSS struct TagTimeKeeper g_timeKeeper;
 
 /* 系统状态标志位 */
 OS_SEC_DATA U32 g_uniFlag = 0;
@@ -20,6 +20,10 @@
 #include "prt_lib_external.h"
 
 OS_SEC_BSS U8 g_cpuType;
+/* 启动各阶段结束时的cycle数 */
+OS_SEC_BSS U64 g_sysBootCycle[OS_SYS_BOOT_BUTT];
+/* 各模块初始化函数耗费的cycle数 */
+OS_SEC_BSS U64 g_sysModInitCycle[OS_MID_BUTT];
 
 OS_SEC_L4_TEXT U8 OsGetCpuType(void)
 {
@@ -29,6 +33,12 @@ OS_SEC_L4_TEXT U8 OsGetCpuType(void)
 OS_SEC_L4_TEXT U32 OsSysTimeHookReg(SysTimeFunc hook)
 {
 #if defined(OS_OPTION_SYS_TIME_USR)
+#if defined(OS_ARCH_ARMV8)
+    /* 用户未注册钩子时使用通用定时器计数，否则cycle数恒为0 */
+    if (hook == NULL) {
+        hook = PRT_ClkGetCycleCount64;
+    }
+#endif
     return OsSetSysTimeHook(hook);
 #else
     (void)hook;
@@ -36,21 +46,53 @@ OS_SEC_L4_TEXT U32 OsSysTimeHookReg(SysTimeFunc hook)
 #endif
 }
 
-OS_SEC_L4_TEXT U32 OsSysRegister(struct SysModInfo *modInfo)
+/*
+ * 描述：主频确定后计算cycle换算因子
+ */
+OS_SEC_ALW_INLINE INLINE void OsSysClkConvInit(U32 systemClock)
 {
-    U32 ret;
+    OsLibMulShiftInit(&g_sysClkConv.cycle2Ns, OS_SYS_NS_PER_SECOND, systemClock);
+    OsLibMulShiftInit(&g_sysClkConv.cycle2Us, OS_SYS_US_PER_SECOND, systemClock);
+    OsLibMulShiftInit(&g_sysClkConv.cycle2Ms, OS_SYS_MS_PER_SECOND, systemClock);
+    OsLibMulShiftInit(&g_sysClkConv.ns2Sec, 1, OS_SYS_NS_PER_SECOND);
+    OsLibDivConstInit(&g_sysClkConv.msPerSec, OS_SYS_MS_PER_SECOND);
+    OsLibDivConstInit(&g_sysClkConv.usPerSec, OS_SYS_US_PER_SECOND);
+}
 
-    if (modInfo->systemClock < OS_SYS_US_PER_SECOND) {
-        return OS_ERRNO_SYS_CLOCK_INVALID;
+/*
+ * 描述：获取cycle计数的频率，cycle取自通用定时器时以CNTFRQ_EL0为准，否则使用配置的主频
+ */
+OS_SEC_ALW_INLINE INLINE U32 OsSysClockGet(U32 cfgClock)
+{
+#if defined(OS_ARCH_ARMV8)
+    U64 freq;
+
+    if (g_sysTimeHook == PRT_ClkGetCycleCount64) {
+        freq = OsHwCycleFreqGet();
+        if ((freq >= OS_SYS_US_PER_SECOND) && (freq <= OS_MAX_U32)) {
+            return (U32)freq;
+        }
     }
+#endif
+    return cfgClock;
+}
+
+OS_SEC_L4_TEXT U32 OsSysRegister(struct SysModInfo *modInfo)
+{
+    U32 ret;
 
     ret = OsSysTimeHookReg(modInfo->sysTimeHook);
     if (ret != OS_OK) {
         return ret;
     }
 
+    g_systemClock = OsSysClockGet(modInfo->systemClock);
+    if (g_systemClock < OS_SYS_US_PER_SECOND) {
+        return OS_ERRNO_SYS_CLOCK_INVALID;
+    }
+
     UNI_FLAG = 0;
-    g_systemClock = modInfo->systemClock;
+    OsSysClkConvInit(g_systemClock);
     g_cpuType = (U8)modInfo->cpuType;
 #if defined(OS_OPTION_HWI_MAX_NUM_CONFIG)
     if (OsHwiCheckMaxNum(modInfo->hwiMaxNum) == FALSE) {
@@ -64,10 +106,54 @@ OS_SEC_L4_TEXT U32 OsSysRegister(struct SysModInfo *modInfo)
 
 OS_SEC_L4_TEXT U64 PRT_ClkCycle2Ms(U64 cycle)
 {
-    return DIV64(cycle, g_systemClock / OS_SYS_MS_PER_SECOND);
+    return OsLibMulShift(cycle, &g_sysClkConv.cycle2Ms);
 }
 
 OS_SEC_L4_TEXT U64 PRT_ClkCycle2Us(U64 cycle)
 {
-    return DIV64(cycle, g_systemClock / OS_SYS_US_PER_SECOND);
+    return OsLibMulShift(cycle, &g_sysClkConv.cycle2Us);
+}
+
+/*
+ * 描述：记录启动阶段结束时的cycle数
+ */
+OS_SEC_L4_TEXT void OsSysBootCycleRecord(enum SysBootPhase phase)
+{
+    g_sysBootCycle[phase] = OsCurCycleGet64();
+}
+
+/*
+ * 描述：记录模块初始化耗费的cycle数，startCycle为调用模块初始化函数前的cycle数
+ */
+OS_SEC_L4_TEXT void OsSysModInitCycleRecord(U32 mid, U64 startCycle)
+{
+    g_sysModInitCycle[mid] = OsCurCycleGet64() - startCycle;
+}
+
+OS_SEC_L4_TEXT U32 PRT_SysGetBootCycle(enum SysBootPhase phase, U64 *cycle)
+{
+    if (cycle == NULL) {
+        return OS_ERRNO_SYS_PTR_NULL;
+    }
+
+    if ((U32)phase >= (U32)OS_SYS_BOOT_BUTT) {
+        return OS_ERRNO_SYS_BOOT_PARA_INVALID;
+    }
+
+    *cycle = g_sysBootCycle[phase];
+    return OS_OK;
+}
+
+OS_SEC_L4_TEXT U32 PRT_SysGetModInitCycle(U32 mid, U64 *cycle)
+{
+    if (cycle == NULL) {
+        return OS_ERRNO_SYS_PTR_NULL;
+    }
+
+    if (mid >= (U32)OS_MID_BUTT) {
+        return OS_ERRNO_SYS_BOOT_PARA_INVALID;
+    }
+
+    *cycle = g_sysModInitCycle[mid];
+    return OS_OK;
 }
@@ -41,11 +41,11 @@ OS_SEC_L2_TEXT U64 OsCurCycleGet64(void)
 }
 
 /*
- * 描述：获取当前的tick计数
+ * 描述：获取当前的tick计数，通过顺序锁读取，不关中断
  */
 OS_SEC_L2_TEXT U64 PRT_TickGetCount(void)
 {
-    return g_uniTicks;
+    return OsTimeKeeperTickGet(NULL);
 }
 
 /*
@@ -14,6 +14,7 @@
  */
 #include "prt_task_external.h"
 #include "prt_asm_cpu_external.h"
+#include "prt_tick_external.h"
 
 OS_SEC_BSS struct TagOsTskSortedDelayList g_tskSortedDelay;
 OS_SEC_BSS struct TagOsRunQue g_runQueue;  // 核的局部运行队列
@@ -88,6 +89,7 @@ OS_SEC_TEXT void OsTaskScan(void)
         }
 
         ListDelete(&taskCb->timerList);
+        OsTickSlackExpire(taskCb->slackMoved);
 
         if ((OS_TSK_PEND & taskCb->taskStatus) != 0) {
             TSK_STATUS_CLEAR(taskCb, OS_TSK_PEND);
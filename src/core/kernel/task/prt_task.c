@@ -27,6 +27,12 @@ OS_SEC_TEXT void OsTskIdleBgd(void)
     while (TRUE) {
         OS_MHOOK_ACTIVATE_PARA0(OS_HOOK_IDLE_PERIOD);
 
+#if defined(OS_OPTION_TASK_STACK_POOL)
+        /* 空闲时填充任务栈池中回收的任务栈，创建任务时不再填充 */
+        while (OsTskStackPoolPaint()) {
+        }
+#endif
+
         /* 防止g_taskCoreSleep中间被修改后，判空无效 */
         coreSleep = g_taskCoreSleep;
         if (coreSleep != NULL) {
@@ -42,6 +48,11 @@ OS_SEC_L0_TEXT void OsTskReadyAdd(struct TagTskCb *task)
 {
     struct TagOsRunQue *rq = &g_runQueue;
     TSK_STATUS_SET(task, OS_TSK_READY);
+#if defined(OS_OPTION_TASK_WAKEUP_STAT)
+    /* 调整优先级及让出CPU时通过OsTskReadyRequeue重新入队，这里均为唤醒 */
+    task->readyCycle = OsCurCycleGet64();
+#endif
+    OS_TRACE(OS_TRACE_EVENT_TASK_READY, task->taskPid, 0, 0);
 
     OS_TSK_EN_QUE(rq, task, 0);
     OsTskHighestSet();
@@ -56,6 +67,10 @@ OS_SEC_L0_TEXT void OsTskReadyDel(struct TagTskCb *taskCb)
 {
     struct TagOsRunQue *runQue = &g_runQueue;
     TSK_STATUS_CLEAR(taskCb, OS_TSK_READY);
+#if defined(OS_OPTION_TASK_WAKEUP_STAT)
+    /* 未运行即被挂起或删除，本次唤醒不计入统计 */
+    taskCb->readyCycle = 0;
+#endif
 
     OS_TSK_DE_QUE(runQue, taskCb, 0);
     OsTskHighestSet();
@@ -63,6 +78,18 @@ OS_SEC_L0_TEXT void OsTskReadyDel(struct TagTskCb *taskCb)
     return;
 }
 
+/*
+ * 描述：就绪任务重新加入就绪链表尾部，任务状态不变，不是唤醒或阻塞，关中断外部保证
+ */
+OS_SEC_L0_TEXT void OsTskReadyRequeue(struct TagTskCb *taskCb)
+{
+    struct TagOsRunQue *runQue = &g_runQueue;
+
+    OS_TSK_DE_QUE(runQue, taskCb, 0);
+    OS_TSK_EN_QUE(runQue, taskCb, 0);
+    OsTskHighestSet();
+}
+
 /*
  * 描述：添加任务到超时链表
  */
@@ -75,6 +102,7 @@ OS_SEC_L0_TEXT void OsTskTimerAdd(struct TagTskCb *taskCb, uintptr_t timeout)
     tskDlyBase = &g_tskSortedDelay;
 
     taskCb->expirationTick = g_uniTicks + timeout;
+    taskCb->slackMoved = FALSE;
     taskList = &tskDlyBase->tskList;
 
     if (ListEmpty(taskList)) {
@@ -32,6 +32,10 @@ OS_SEC_BSS struct TagTskCb *g_highestTask;
 
 OS_SEC_TEXT void OsTskSwitchHookCaller(U32 prevPid, U32 nextPid)
 {
+#if defined(OS_OPTION_TASK_WAKEUP_STAT)
+    OsTskWakeupRecord(GET_TCB_HANDLE(nextPid));
+#endif
+    OS_TRACE(OS_TRACE_EVENT_TASK_SWITCH, prevPid, nextPid, 0);
     UNI_FLAG |= OS_FLG_SYS_ACTIVE;
     OS_MHOOK_ACTIVATE_PARA2(OS_HOOK_TSK_SWITCH, prevPid, nextPid);
     UNI_FLAG &= ~OS_FLG_SYS_ACTIVE;
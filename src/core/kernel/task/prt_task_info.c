@@ -81,12 +81,18 @@ OS_SEC_L4_TEXT void OsTaskStackPeakGet(struct TskStackInfo *stackInfo)
 {
     U32 *stack = NULL;
     if (*(U32 *)stackInfo->top == OS_TSK_STACK_TOP_MAGIC) {
+#if defined(OS_OPTION_FAST_BOOT)
+        /* 快速启动时栈未填充魔术字，无法统计历史峰值，峰值取当前使用值 */
+        (void)stack;
+        stackInfo->peakUsed = stackInfo->currUsed;
+#else
         stack = (U32 *)(stackInfo->top + sizeof(U32));
         while ((stack < (U32 *)stackInfo->sp) && (*stack == OS_TSK_STACK_MAGIC)) {
             stack += 1;
         }
 
         stackInfo->peakUsed = (U32)(stackInfo->bottom - (uintptr_t)stack);
+#endif
         stackInfo->ovf = FALSE;
     } else {
         stackInfo->peakUsed = OS_MAX_U32;
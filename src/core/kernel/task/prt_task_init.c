@@ -91,6 +91,13 @@ OS_SEC_L4_TEXT U32 OsTskInit(void)
         return ret;
     }
 
+#if defined(OS_OPTION_TASK_STACK_POOL)
+    ret = OsTskStackPoolInit();
+    if (ret != OS_OK) {
+        return ret;
+    }
+#endif
+
     g_taskScanHook = OsTaskScan;
 
 #if defined(OS_OPTION_TASK_INFO)
@@ -107,11 +114,18 @@ OS_SEC_L4_TEXT U32 OsTskInit(void)
 }
 
 /*
- * 描述：分配任务栈空间
+ * 描述：分配任务栈空间，painted输出任务栈是否已填充栈魔术字，只有取自任务栈池的任务栈可能已填充
  */
-OS_SEC_L4_TEXT void *OsTskMemAlloc(U32 size)
+OS_SEC_L4_TEXT void *OsTskMemAlloc(U32 size, bool *painted)
 {
     void *stackAddr = NULL;
+#if defined(OS_OPTION_TASK_STACK_POOL)
+    stackAddr = (void *)OsTskStackPoolGet(size, painted);
+    if (stackAddr != NULL) {
+        return stackAddr;
+    }
+#endif
+    *painted = FALSE;
     stackAddr = OsMemAllocAlign((U32)OS_MID_TSK, (U8)OS_MEM_DEFAULT_FSC_PT, size,
                                 /* 内存已按16字节大小对齐 */
                                 OS_TSK_STACK_SIZE_ALLOC_ALIGN);
@@ -236,18 +250,53 @@ OS_SEC_L4_TEXT void OsTskRecycle(void)
 
 OS_SEC_L4_TEXT void OsTskStackInit(U32 stackSize, uintptr_t topStack)
 {
-    U32 loop;
-    U32 stackMagicWord = OS_TSK_STACK_MAGIC;
+#if defined(OS_OPTION_FAST_BOOT)
+    /* 快速启动不填充整个栈，只写栈顶魔术字用于溢出检测，栈历史峰值不可统计 */
+    (void)stackSize;
+#else
+    U64 stackMagicWord = OS_TSK_STACK_MAGIC;
+
+    /* 初始化任务栈，按双字写入栈魔术字 */
+    stackMagicWord |= stackMagicWord << OS_WORD_BIT_NUM;
+    OsMemSetDword(topStack + sizeof(U32), stackSize - sizeof(U32), stackMagicWord);
+#endif
+    *((U32 *)(topStack)) = OS_TSK_STACK_TOP_MAGIC;
+}
 
-    /* 初始化任务栈，并写入栈魔术字 */
-    for (loop = 1; loop < (stackSize / sizeof(U32)); loop++) {
-        *((U32 *)topStack + loop) = stackMagicWord;
+/*
+ * 描述：获取新建任务的任务栈，调用者需关中断。
+ * 控制块上保留有大小相同的系统任务栈时直接复用，否则回收保留的任务栈后使用用户任务栈或重新申请。
+ * painted输出任务栈是否已填充栈魔术字，未填充时由调用者在关中断外填充。
+ */
+OS_SEC_L4_TEXT U32 OsTskStackGet(struct TagTskCb *taskCb, uintptr_t stackAddr, U32 stackSize, uintptr_t **topStack,
+                                 bool *painted)
+{
+    *painted = FALSE;
+    if (taskCb->topOfStack != 0) {
+        if ((stackAddr == 0) && (taskCb->stackCfgFlg == OS_TSK_STACK_CFG_BY_SYS) &&
+            (taskCb->stackSize == stackSize)) {
+            *topStack = (uintptr_t *)taskCb->topOfStack;
+            return OS_OK;
+        }
+        OsTskResRecycle(taskCb);
     }
-    *((U32 *)(topStack)) = OS_TSK_STACK_TOP_MAGIC;
+
+    if (stackAddr != 0) {
+        *topStack = (uintptr_t *)stackAddr;
+        taskCb->stackCfgFlg = OS_TSK_STACK_CFG_BY_USER;
+        return OS_OK;
+    }
+
+    *topStack = OsTskMemAlloc(stackSize, painted);
+    if (*topStack == NULL) {
+        return OS_ERRNO_TSK_NO_MEMORY;
+    }
+    taskCb->stackCfgFlg = OS_TSK_STACK_CFG_BY_SYS;
+    return OS_OK;
 }
 
 OS_SEC_ALW_INLINE INLINE U32 OsTaskCreateRsrcInit(U32 taskId, struct TskInitParam *initParam, struct TagTskCb *taskCb,
-                                                  uintptr_t **topStackOut, uintptr_t *curStackSize)
+                                                  uintptr_t **topStackOut, uintptr_t *curStackSize, bool *painted)
 {
     U32 ret = OS_OK;
     uintptr_t *topStack = NULL;
@@ -260,18 +309,8 @@ OS_SEC_ALW_INLINE INLINE U32 OsTaskCreateRsrcInit(U32 taskId, struct TskInitPara
         }
     }
 
-    /* 查看用户是否配置了任务栈，如没有，则进行内存申请，并标记为系统配置，如有，则标记为用户配置。 */
-    if (initParam->stackAddr != 0) {
-        topStack = (void *)(initParam->stackAddr);
-        taskCb->stackCfgFlg = OS_TSK_STACK_CFG_BY_USER;
-    } else {
-        topStack = OsTskMemAlloc(initParam->stackSize);
-        if (topStack == NULL) {
-            ret = OS_ERRNO_TSK_NO_MEMORY;
-        } else {
-            taskCb->stackCfgFlg = OS_TSK_STACK_CFG_BY_SYS;
-        }
-    }
+    /* 查看用户是否配置了任务栈，如没有，则复用或申请系统任务栈，并标记为系统配置，如有，则标记为用户配置。 */
+    ret = OsTskStackGet(taskCb, initParam->stackAddr, initParam->stackSize, &topStack, painted);
     *curStackSize = initParam->stackSize;
     if (ret != OS_OK) {
         return ret;
@@ -300,6 +339,17 @@ OS_SEC_ALW_INLINE INLINE void OsTskCreateTcbInit(uintptr_t stackPtr, struct TskI
     taskCb->eventMask = 0;
 #endif
     taskCb->lastErr = 0;
+#if defined(OS_OPTION_TASK_PERIOD_STAT)
+    if (memset_s(&taskCb->periodStat, sizeof(struct TskPeriodStat), 0, sizeof(struct TskPeriodStat)) != EOK) {
+        OS_GOTO_SYS_ERROR1();
+    }
+#endif
+#if defined(OS_OPTION_TASK_WAKEUP_STAT)
+    taskCb->readyCycle = 0;
+    if (memset_s(&taskCb->wakeupStat, sizeof(struct TskWakeupStat), 0, sizeof(struct TskWakeupStat)) != EOK) {
+        OS_GOTO_SYS_ERROR1();
+    }
+#endif
 
     INIT_LIST_OBJECT(&taskCb->semBList);
     INIT_LIST_OBJECT(&taskCb->pendList);
@@ -320,6 +370,7 @@ OS_SEC_L4_TEXT U32 OsTaskCreateOnly(TskHandle *taskPid, struct TskInitParam *ini
     void *stackPtr = NULL;
     struct TagTskCb *taskCb = NULL;
     uintptr_t curStackSize = 0;
+    bool painted = FALSE;
 
     ret = OsTaskCreateParaCheck(taskPid, initParam);
     if (ret != OS_OK) {
@@ -334,13 +385,19 @@ OS_SEC_L4_TEXT U32 OsTaskCreateOnly(TskHandle *taskPid, struct TskInitParam *ini
 
     taskId = taskCb->taskPid;
 
-    ret = OsTaskCreateRsrcInit(taskId, initParam, taskCb, &topStack, &curStackSize);
+    ret = OsTaskCreateRsrcInit(taskId, initParam, taskCb, &topStack, &curStackSize, &painted);
     if (ret != OS_OK) {
         ListAdd(&taskCb->pendList, &g_tskCbFreeList);
         OsIntRestore(intSave);
         return ret;
     }
-    OsTskStackInit(curStackSize, (uintptr_t)topStack);
+
+    if (!painted) {
+        OsIntRestore(intSave);
+        /* 控制块已从空闲链表摘除且处于未使用状态，填充栈魔术字不需要关中断 */
+        OsTskStackInit(curStackSize, (uintptr_t)topStack);
+        intSave = OsIntLock();
+    }
 
     stackPtr = OsTskContextInit(taskId, curStackSize, topStack, (uintptr_t)OsTskEntry);
 
@@ -17,6 +17,7 @@
 
 #include "prt_task_external.h"
 #include "prt_asm_cpu_external.h"
+#include "prt_trace_external.h"
 
 /*
  * 模块内宏定义
@@ -25,6 +26,25 @@
 #define OS_TSK_STACK_CFG_BY_USER 1
 #define OS_TSK_STACK_CFG_BY_SYS 0
 
+#if defined(OS_OPTION_TASK_STACK_POOL)
+/* 任务栈池按2的幂划分大小等级，只缓存大小恰好等于某一等级的任务栈 */
+#define OS_TSK_STACK_POOL_MIN_SIZE 0x800U
+#define OS_TSK_STACK_POOL_CLS_NUM 6
+/* 每个等级最多缓存的任务栈个数，超出后释放回内存分区 */
+#define OS_TSK_STACK_POOL_CLS_MAX 8
+/* 空闲任务栈的链表指针保存在栈顶魔术字之后的双字中 */
+#define OS_TSK_STACK_POOL_LINK_OFFSET sizeof(U64)
+
+struct TagTskStackPool {
+    /* 各等级已填充栈魔术字的空闲任务栈链表头 */
+    uintptr_t head[OS_TSK_STACK_POOL_CLS_NUM];
+    /* 各等级尚未填充栈魔术字的空闲任务栈链表头，由Idle任务填充后移入head */
+    uintptr_t dirty[OS_TSK_STACK_POOL_CLS_NUM];
+    /* 各等级空闲任务栈个数，包含正在填充的任务栈 */
+    U32 num[OS_TSK_STACK_POOL_CLS_NUM];
+};
+#endif
+
 /*
  * 模块内全局变量声明
  */
@@ -34,11 +54,49 @@ extern struct TagListObject g_tskRecyleList;
 /*
  * 模块内函数声明
  */
-extern void *OsTskMemAlloc(U32 size);
+extern void *OsTskMemAlloc(U32 size, bool *painted);
 extern void OsTskIdleBgd(void);
 extern U32 OsTaskDelStatusCheck(struct TagTskCb *taskCb);
 extern void OsTskRecycle(void);
 extern void OsTskStackInit(U32 stackSize, uintptr_t topStack);
+extern U32 OsTskStackGet(struct TagTskCb *taskCb, uintptr_t stackAddr, U32 stackSize, uintptr_t **topStack,
+                         bool *painted);
+#if defined(OS_OPTION_TASK_PERIOD_STAT)
+extern void OsTskPeriodRecord(struct TagTskCb *taskCb, U64 wakeTick, bool miss);
+#endif
+#if defined(OS_OPTION_TASK_STACK_POOL)
+extern U32 OsTskStackPoolInit(void);
+extern uintptr_t OsTskStackPoolGet(U32 size, bool *painted);
+extern bool OsTskStackPoolPut(uintptr_t topStack, U32 size, bool painted);
+extern bool OsTskStackPoolPaint(void);
+#endif
+
+#if defined(OS_OPTION_TASK_WAKEUP_STAT)
+/*
+ * 描述：任务被调度运行时记录唤醒时延，调用者需关中断
+ */
+OS_SEC_ALW_INLINE INLINE void OsTskWakeupRecord(struct TagTskCb *taskCb)
+{
+    U32 latency;
+    U32 idx;
+    struct TskWakeupStat *stat = &taskCb->wakeupStat;
+
+    if (taskCb->readyCycle == 0) {
+        return;
+    }
+
+    latency = (U32)OsLibMulShift(OsCurCycleGet64() - taskCb->readyCycle, &g_sysClkConv.cycle2Us);
+    taskCb->readyCycle = 0;
+
+    idx = OsLibLog2Bucket(latency, OS_TSK_WAKEUP_HIST_NUM);
+
+    stat->wakeupCount++;
+    stat->hist[idx]++;
+    if (latency > stat->maxLatency) {
+        stat->maxLatency = latency;
+    }
+}
+#endif
 
 OS_SEC_ALW_INLINE INLINE void OsMoveTaskToReady(struct TagTskCb *taskCb)
 {
@@ -53,15 +111,59 @@ OS_SEC_ALW_INLINE INLINE void OsMoveTaskToReady(struct TagTskCb *taskCb)
     }
 }
 
+/*
+ * 描述：释放控制块上的系统任务栈，topOfStack为0表示控制块上已没有保留的任务栈
+ */
 OS_SEC_ALW_INLINE INLINE void OsTskResRecycle(struct TagTskCb *taskCb)
 {
-    if (taskCb->stackCfgFlg == OS_TSK_STACK_CFG_BY_SYS) {
-        OS_ERR_RECORD(PRT_MemFree((U32)OS_MID_TSK, (void *)taskCb->topOfStack));
+    uintptr_t topStack = taskCb->topOfStack;
+
+    taskCb->topOfStack = 0;
+    if ((topStack == 0) || (taskCb->stackCfgFlg != OS_TSK_STACK_CFG_BY_SYS)) {
+        return;
+    }
+
+#if defined(OS_OPTION_TASK_STACK_POOL)
+    /* 放入任务栈池成功则不再释放，由Idle任务在关中断外填充栈魔术字 */
+    if (OsTskStackPoolPut(topStack, taskCb->stackSize, FALSE)) {
+        return;
+    }
+#endif
+    OS_ERR_RECORD(PRT_MemFree((U32)OS_MID_TSK, (void *)topStack));
+}
+
+/*
+ * 描述：自删除任务的控制块能否直接复用，已退出但尚未被join的线程需保留控制块中的退出状态
+ */
+OS_SEC_ALW_INLINE INLINE bool OsTskZombieReusable(struct TagTskCb *taskCb)
+{
+#if defined(OS_OPTION_POSIX)
+    if (taskCb->state == PTHREAD_EXITED) {
+        return FALSE;
     }
+#else
+    (void)taskCb;
+#endif
+    return TRUE;
 }
 
+/*
+ * 描述：获取空闲任务控制块，调用者需关中断。
+ * 优先直接复用自删除任务的控制块，其系统任务栈保留在控制块上，由OsTskStackGet复用或回收。
+ */
 OS_SEC_ALW_INLINE INLINE U32 OsTaskCreateChkAndGetTcb(struct TagTskCb **taskCb)
 {
+    struct TagTskCb *zombie = NULL;
+
+    if (!ListEmpty(&g_tskRecyleList)) {
+        zombie = GET_TCB_PEND(OS_LIST_FIRST(&g_tskRecyleList));
+        if (OsTskZombieReusable(zombie)) {
+            ListDelete(&zombie->pendList);
+            *taskCb = zombie;
+            return OS_OK;
+        }
+    }
+
     OsTskRecycle();
 
     if (ListEmpty(&g_tskCbFreeList)) {
@@ -76,4 +178,26 @@ OS_SEC_ALW_INLINE INLINE U32 OsTaskCreateChkAndGetTcb(struct TagTskCb **taskCb)
     return OS_OK;
 }
 
+/*
+ * 描述：检查当前运行任务能否延时，调用者需关中断
+ */
+OS_SEC_ALW_INLINE INLINE U32 OsTaskDelayChk(void)
+{
+    if (UNI_FLAG == 0) {
+        // 初始化过程中不允许切换
+        return OS_ERRNO_TSK_DELAY_IN_INT;
+    }
+
+    if (OS_INT_ACTIVE) {
+        OS_REPORT_ERROR(OS_ERRNO_TSK_DELAY_IN_INT);
+        return OS_ERRNO_TSK_DELAY_IN_INT;
+    }
+
+    if (OS_TASK_LOCK_DATA != 0) {
+        return OS_ERRNO_TSK_DELAY_IN_LOCK;
+    }
+
+    return OS_OK;
+}
+
 #endif /* PRT_TASK_INTERNAL_H */
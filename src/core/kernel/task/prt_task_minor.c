@@ -26,8 +26,7 @@ OS_SEC_ALW_INLINE INLINE U32 OsTaskYieldProc(TskHandle nextTaskId, U32 taskPrio,
         if (yieldTo != NULL) {
             *yieldTo = (GET_TCB_PEND(OS_LIST_FIRST(&currTask->pendList)))->taskPid;
         }
-        OsTskReadyDel(currTask);  // 从当前就绪队列删除
-        OsTskReadyAdd(currTask);  // 添加到就绪队列末尾
+        OsTskReadyRequeue(currTask);  // 移到就绪队列末尾
     } else {
         if (yieldTo != NULL) {
             *yieldTo = nextTaskId;
@@ -88,36 +87,30 @@ static OS_SEC_L2_TEXT U32 OsTaskYield(TskPrior taskPrio, TskHandle nextTaskId, T
 #endif
 
 /*
- * 描述：延迟当前运行任务的执行
+ * 描述：延迟当前运行任务的执行，到期Tick在slack个Tick的容差内对齐
  */
-OS_SEC_L0_TEXT U32 PRT_TaskDelay(U32 tick)
+OS_SEC_ALW_INLINE INLINE U32 OsTaskDelay(U32 tick, U32 slack)
 {
     U32 ret;
+    U64 expire;
     uintptr_t intSave;
     struct TagTskCb *runTask = NULL;
 
     intSave = OsIntLock();
-    if (UNI_FLAG == 0) {
-        OsIntRestore(intSave);
-        // 初始化过程中不允许切换
-        return OS_ERRNO_TSK_DELAY_IN_INT;
-    }
-
-    if (OS_INT_ACTIVE) {
-        OS_REPORT_ERROR(OS_ERRNO_TSK_DELAY_IN_INT);
+    ret = OsTaskDelayChk();
+    if (ret != OS_OK) {
         OsIntRestore(intSave);
-        return OS_ERRNO_TSK_DELAY_IN_INT;
+        return ret;
     }
 
-    if (OS_TASK_LOCK_DATA != 0) {
-        OsIntRestore(intSave);
-        return OS_ERRNO_TSK_DELAY_IN_LOCK;
-    }
     runTask = RUNNING_TASK;
     if (tick > 0) {
         OsTskReadyDel(runTask);
+        OS_TRACE(OS_TRACE_EVENT_TASK_BLOCK, runTask->taskPid, 0, 0);
         TSK_STATUS_SET(runTask, OS_TSK_DELAY);
-        OsTskTimerAdd(runTask, tick);
+        expire = OsTickSlackAlign(g_uniTicks + tick, slack);
+        OsTskTimerAdd(runTask, (uintptr_t)(expire - g_uniTicks));
+        runTask->slackMoved = (expire != g_uniTicks + tick);
         OsTskScheduleFastPs(intSave);
         OsIntRestore(intSave);
 
@@ -134,6 +127,22 @@ OS_SEC_L0_TEXT U32 PRT_TaskDelay(U32 tick)
     return ret;
 }
 
+/*
+ * 描述：延迟当前运行任务的执行
+ */
+OS_SEC_L0_TEXT U32 PRT_TaskDelay(U32 tick)
+{
+    return OsTaskDelay(tick, 0);
+}
+
+/*
+ * 描述：按容差延迟当前运行任务的执行
+ */
+OS_SEC_L0_TEXT U32 PRT_TaskDelaySlack(U32 tick, U32 slack)
+{
+    return OsTaskDelay(tick, slack);
+}
+
 /*
  * 描述：锁任务调度
  */
@@ -0,0 +1,193 @@
+/*
+ * Copyright (c) 2023-2023 Huawei Technologies Co., Ltd. All rights reserved.
+ *
+ * UniProton is licensed under Mulan PSL v2.
+ * You can use this software according to the terms and conditions of the Mulan PSL v2.
+ * You may obtain a copy of Mulan PSL v2 at:
+ *          http://license.coscl.org.cn/MulanPSL2
+ * THIS SOFTWARE IS PROVIDED ON AN "AS IS" BASIS, WITHOUT WARRANTIES OF ANY KIND,
+ * EITHER EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO NON-INFRINGEMENT,
+ * MERCHANTABILITY OR FIT FOR A PARTICULAR PURPOSE.
+ * See the Mulan PSL v2 for more details.
+ * Create: 2023-06-01
+ * Description: 周期任务实现
+ */
+#include "securec.h"
+#include "prt_task_internal.h"
+#include "prt_tick_external.h"
+#include "prt_clk.h"
+
+#if defined(OS_OPTION_TASK_PERIOD_STAT)
+/*
+ * 描述：记录周期任务的释放抖动，调用者需关中断
+ */
+OS_SEC_L0_TEXT void OsTskPeriodRecord(struct TagTskCb *taskCb, U64 wakeTick, bool miss)
+{
+    U64 cycle;
+    U32 jitter;
+    U32 idx;
+    struct TskPeriodStat *stat = &taskCb->periodStat;
+
+    /* 被删除或恢复等操作提前唤醒时不计入统计 */
+    if (g_uniTicks < wakeTick) {
+        return;
+    }
+
+    /* 从应释放的Tick中断到当前时刻，错过的Tick按每Tick的cycle数折算 */
+    cycle = (OsCurCycleGet64() - g_timeKeeper.tickCycle) + (g_uniTicks - wakeTick) * OsGetCyclePerTick();
+    jitter = (U32)PRT_ClkCycle2Us(cycle);
+
+    idx = OsLibLog2Bucket(jitter, OS_TSK_JITTER_HIST_NUM);
+
+    if ((stat->releaseCount == 0) || (jitter < stat->minJitter)) {
+        stat->minJitter = jitter;
+    }
+    if (jitter > stat->maxJitter) {
+        stat->maxJitter = jitter;
+    }
+    if (miss) {
+        stat->missCount++;
+    }
+    stat->releaseCount++;
+    stat->hist[idx]++;
+}
+#endif
+
+/*
+ * 描述：延迟当前运行任务到绝对时间点
+ */
+OS_SEC_L0_TEXT U32 PRT_TaskDelayUntil(U64 *prevWakeTick, U32 period)
+{
+    U32 ret;
+    U64 wakeTick;
+    uintptr_t intSave;
+    struct TagTskCb *runTask = NULL;
+
+    if (prevWakeTick == NULL) {
+        return OS_ERRNO_TSK_PTR_NULL;
+    }
+
+    if (period == 0) {
+        return OS_ERRNO_TSK_PERIOD_INVALID;
+    }
+
+    intSave = OsIntLock();
+    ret = OsTaskDelayChk();
+    if (ret != OS_OK) {
+        OsIntRestore(intSave);
+        return ret;
+    }
+
+    runTask = RUNNING_TASK;
+    wakeTick = *prevWakeTick + period;
+    *prevWakeTick = wakeTick;
+
+    /* 下一次释放时间已过，不延时直接返回 */
+    if (wakeTick <= g_uniTicks) {
+#if defined(OS_OPTION_TASK_PERIOD_STAT)
+        OsTskPeriodRecord(runTask, wakeTick, TRUE);
+#endif
+        OsIntRestore(intSave);
+        return OS_ERRNO_TSK_PERIOD_MISSED;
+    }
+
+    OsTskReadyDel(runTask);
+    OS_TRACE(OS_TRACE_EVENT_TASK_BLOCK, runTask->taskPid, 0, 0);
+    TSK_STATUS_SET(runTask, OS_TSK_DELAY);
+    OsTskTimerAdd(runTask, (uintptr_t)(wakeTick - g_uniTicks));
+    OsTskScheduleFastPs(intSave);
+
+#if defined(OS_OPTION_TASK_PERIOD_STAT)
+    OsTskPeriodRecord(runTask, wakeTick, FALSE);
+#endif
+    OsIntRestore(intSave);
+
+    return OS_OK;
+}
+
+/*
+ * 描述：在当前任务中周期执行处理函数，处理函数返回FALSE时结束
+ */
+OS_SEC_L4_TEXT U32 PRT_TaskPeriodRun(U32 period, TskPeriodFunc func, uintptr_t param)
+{
+    U32 ret;
+    U64 prevWakeTick;
+
+    if (func == NULL) {
+        return OS_ERRNO_TSK_PTR_NULL;
+    }
+
+    if (period == 0) {
+        return OS_ERRNO_TSK_PERIOD_INVALID;
+    }
+
+    prevWakeTick = PRT_TickGetCount();
+    while (func(param)) {
+        ret = PRT_TaskDelayUntil(&prevWakeTick, period);
+        if ((ret != OS_OK) && (ret != OS_ERRNO_TSK_PERIOD_MISSED)) {
+            return ret;
+        }
+    }
+
+    return OS_OK;
+}
+
+#if defined(OS_OPTION_TASK_PERIOD_STAT)
+/*
+ * 描述：获取周期任务的释放抖动统计信息
+ */
+OS_SEC_L4_TEXT U32 PRT_TaskPeriodStatGet(TskHandle taskPid, struct TskPeriodStat *stat)
+{
+    uintptr_t intSave;
+    struct TagTskCb *taskCb = NULL;
+
+    if (CHECK_TSK_PID_OVERFLOW(taskPid)) {
+        return OS_ERRNO_TSK_ID_INVALID;
+    }
+
+    if (stat == NULL) {
+        return OS_ERRNO_TSK_PTR_NULL;
+    }
+
+    taskCb = GET_TCB_HANDLE(taskPid);
+
+    intSave = OsIntLock();
+    if (TSK_IS_UNUSED(taskCb)) {
+        OsIntRestore(intSave);
+        return OS_ERRNO_TSK_NOT_CREATED;
+    }
+
+    *stat = taskCb->periodStat;
+    OsIntRestore(intSave);
+
+    return OS_OK;
+}
+
+/*
+ * 描述：清除周期任务的释放抖动统计信息
+ */
+OS_SEC_L4_TEXT U32 PRT_TaskPeriodStatClear(TskHandle taskPid)
+{
+    uintptr_t intSave;
+    struct TagTskCb *taskCb = NULL;
+
+    if (CHECK_TSK_PID_OVERFLOW(taskPid)) {
+        return OS_ERRNO_TSK_ID_INVALID;
+    }
+
+    taskCb = GET_TCB_HANDLE(taskPid);
+
+    intSave = OsIntLock();
+    if (TSK_IS_UNUSED(taskCb)) {
+        OsIntRestore(intSave);
+        return OS_ERRNO_TSK_NOT_CREATED;
+    }
+
+    if (memset_s(&taskCb->periodStat, sizeof(struct TskPeriodStat), 0, sizeof(struct TskPeriodStat)) != EOK) {
+        OS_GOTO_SYS_ERROR1();
+    }
+    OsIntRestore(intSave);
+
+    return OS_OK;
+}
+#endif
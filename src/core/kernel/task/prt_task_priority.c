@@ -13,6 +13,7 @@
  * Description: Task schedule implementation
  */
 #include "prt_task_external.h"
+#include "prt_amp_task_internal.h"
 
 /*
  * 描述：获取指定任务的优先级
@@ -89,9 +90,11 @@ OS_SEC_L4_TEXT U32 PRT_TaskSetPriority(TskHandle taskPid, TskPrior taskPrio)
 
     /* delete the task & insert with right priority into ready queue */
     if (isReady) {
-        OsTskReadyDel(taskCb);
+        /* 先从原优先级就绪链表摘除，再按新优先级入队，不改变任务状态 */
+        OS_TSK_DE_QUE(&g_runQueue, taskCb, 0);
         taskCb->priority = taskPrio;
-        OsTskReadyAdd(taskCb);
+        OS_TSK_EN_QUE(&g_runQueue, taskCb, 0);
+        OsTskHighestSet();
     } else {
         taskCb->priority = taskPrio;
     }
@@ -0,0 +1,159 @@
+/*
+ * Copyright (c) 2023-2023 Huawei Technologies Co., Ltd. All rights reserved.
+ *
+ * UniProton is licensed under Mulan PSL v2.
+ * You can use this software according to the terms and conditions of the Mulan PSL v2.
+ * You may obtain a copy of Mulan PSL v2 at:
+ *          http://license.coscl.org.cn/MulanPSL2
+ * THIS SOFTWARE IS PROVIDED ON AN "AS IS" BASIS, WITHOUT WARRANTIES OF ANY KIND,
+ * EITHER EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO NON-INFRINGEMENT,
+ * MERCHANTABILITY OR FIT FOR A PARTICULAR PURPOSE.
+ * See the Mulan PSL v2 for more details.
+ * Create: 2023-06-01
+ * Description: 任务栈池实现
+ */
+#include "prt_task_internal.h"
+
+#if defined(OS_OPTION_TASK_STACK_POOL)
+/* 任务栈池，调用者保证已关中断 */
+OS_SEC_BSS struct TagTskStackPool g_tskStackPool;
+
+/*
+ * 描述：获取任务栈大小所在的等级，不属于任何等级时返回OS_TSK_STACK_POOL_CLS_NUM
+ */
+OS_SEC_ALW_INLINE INLINE U32 OsTskStackPoolCls(U32 size)
+{
+    U32 cls;
+
+    for (cls = 0; cls < OS_TSK_STACK_POOL_CLS_NUM; cls++) {
+        if (size == (OS_TSK_STACK_POOL_MIN_SIZE << cls)) {
+            break;
+        }
+    }
+
+    return cls;
+}
+
+OS_SEC_ALW_INLINE INLINE void OsTskStackPoolPush(uintptr_t *list, uintptr_t topStack)
+{
+    *(uintptr_t *)(topStack + OS_TSK_STACK_POOL_LINK_OFFSET) = *list;
+    *list = topStack;
+}
+
+OS_SEC_ALW_INLINE INLINE uintptr_t OsTskStackPoolPop(uintptr_t *list)
+{
+    uintptr_t topStack = *list;
+
+    *list = *(uintptr_t *)(topStack + OS_TSK_STACK_POOL_LINK_OFFSET);
+    return topStack;
+}
+
+/*
+ * 描述：将系统申请的任务栈放入任务栈池，调用处已关中断。
+ * 未填充栈魔术字的任务栈由Idle任务调用OsTskStackPoolPaint在关中断外填充。
+ */
+OS_SEC_L4_TEXT bool OsTskStackPoolPut(uintptr_t topStack, U32 size, bool painted)
+{
+    U32 cls = OsTskStackPoolCls(size);
+
+    if ((cls == OS_TSK_STACK_POOL_CLS_NUM) || (g_tskStackPool.num[cls] >= OS_TSK_STACK_POOL_CLS_MAX)) {
+        return FALSE;
+    }
+
+    OsTskStackPoolPush(painted ? &g_tskStackPool.head[cls] : &g_tskStackPool.dirty[cls], topStack);
+    g_tskStackPool.num[cls]++;
+
+    return TRUE;
+}
+
+/*
+ * 描述：从任务栈池取出一个任务栈，优先取已填充栈魔术字的任务栈，没有对应大小的任务栈时返回0
+ */
+OS_SEC_L4_TEXT uintptr_t OsTskStackPoolGet(U32 size, bool *painted)
+{
+    uintptr_t topStack;
+    U64 stackMagicWord = OS_TSK_STACK_MAGIC;
+    U32 cls = OsTskStackPoolCls(size);
+
+    if (cls == OS_TSK_STACK_POOL_CLS_NUM) {
+        return 0;
+    }
+
+    if (g_tskStackPool.head[cls] != 0) {
+        topStack = OsTskStackPoolPop(&g_tskStackPool.head[cls]);
+        /* 链表指针所在的双字恢复为栈魔术字 */
+        stackMagicWord |= stackMagicWord << OS_WORD_BIT_NUM;
+        *(U64 *)(topStack + OS_TSK_STACK_POOL_LINK_OFFSET) = stackMagicWord;
+        *painted = TRUE;
+    } else if (g_tskStackPool.dirty[cls] != 0) {
+        topStack = OsTskStackPoolPop(&g_tskStackPool.dirty[cls]);
+        *painted = FALSE;
+    } else {
+        return 0;
+    }
+
+    g_tskStackPool.num[cls]--;
+    return topStack;
+}
+
+/*
+ * 描述：在Idle任务中填充一个尚未填充栈魔术字的任务栈，没有待填充的任务栈时返回FALSE。
+ * 填充期间任务栈不在链表上但仍计入num，不会被创建任务取走，也不会超出等级上限。
+ */
+OS_SEC_L4_TEXT bool OsTskStackPoolPaint(void)
+{
+    U32 cls;
+    uintptr_t intSave;
+    uintptr_t topStack = 0;
+
+    intSave = OsIntLock();
+    for (cls = 0; cls < OS_TSK_STACK_POOL_CLS_NUM; cls++) {
+        if (g_tskStackPool.dirty[cls] != 0) {
+            topStack = OsTskStackPoolPop(&g_tskStackPool.dirty[cls]);
+            break;
+        }
+    }
+    OsIntRestore(intSave);
+
+    if (topStack == 0) {
+        return FALSE;
+    }
+
+    OsTskStackInit(OS_TSK_STACK_POOL_MIN_SIZE << cls, topStack);
+
+    intSave = OsIntLock();
+    OsTskStackPoolPush(&g_tskStackPool.head[cls], topStack);
+    OsIntRestore(intSave);
+
+    return TRUE;
+}
+
+/*
+ * 描述：按缺省任务栈大小预先申请任务栈放入任务栈池
+ */
+OS_SEC_L4_TEXT U32 OsTskStackPoolInit(void)
+{
+    U32 idx;
+    void *topStack = NULL;
+    U32 size = g_tskModInfo.defaultSize;
+
+    if (OsTskStackPoolCls(size) == OS_TSK_STACK_POOL_CLS_NUM) {
+        return OS_OK;
+    }
+
+    for (idx = 0; idx < OS_TSK_STACK_POOL_PREALLOC_NUM; idx++) {
+        topStack = OsMemAllocAlign((U32)OS_MID_TSK, (U8)OS_MEM_DEFAULT_FSC_PT, size, OS_TSK_STACK_SIZE_ALLOC_ALIGN);
+        if (topStack == NULL) {
+            return OS_ERRNO_TSK_NO_MEMORY;
+        }
+
+        OsTskStackInit(size, (uintptr_t)topStack);
+        if (!OsTskStackPoolPut((uintptr_t)topStack, size, TRUE)) {
+            OS_ERR_RECORD(PRT_MemFree((U32)OS_MID_TSK, topStack));
+            break;
+        }
+    }
+
+    return OS_OK;
+}
+#endif
@@ -0,0 +1,76 @@
+/*
+ * Copyright (c) 2023-2023 Huawei Technologies Co., Ltd. All rights reserved.
+ *
+ * UniProton is licensed under Mulan PSL v2.
+ * You can use this software according to the terms and conditions of the Mulan PSL v2.
+ * You may obtain a copy of Mulan PSL v2 at:
+ *          http://license.coscl.org.cn/MulanPSL2
+ * THIS SOFTWARE IS PROVIDED ON AN "AS IS" BASIS, WITHOUT WARRANTIES OF ANY KIND,
+ * EITHER EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO NON-INFRINGEMENT,
+ * MERCHANTABILITY OR FIT FOR A PARTICULAR PURPOSE.
+ * See the Mulan PSL v2 for more details.
+ * Create: 2023-06-01
+ * Description: 任务唤醒时延统计
+ */
+#include "securec.h"
+#include "prt_task_internal.h"
+
+#if defined(OS_OPTION_TASK_WAKEUP_STAT)
+/*
+ * 描述：获取任务的唤醒时延统计信息
+ */
+OS_SEC_L4_TEXT U32 PRT_TaskWakeupStatGet(TskHandle taskPid, struct TskWakeupStat *stat)
+{
+    uintptr_t intSave;
+    struct TagTskCb *taskCb = NULL;
+
+    if (CHECK_TSK_PID_OVERFLOW(taskPid)) {
+        return OS_ERRNO_TSK_ID_INVALID;
+    }
+
+    if (stat == NULL) {
+        return OS_ERRNO_TSK_PTR_NULL;
+    }
+
+    taskCb = GET_TCB_HANDLE(taskPid);
+
+    intSave = OsIntLock();
+    if (TSK_IS_UNUSED(taskCb)) {
+        OsIntRestore(intSave);
+        return OS_ERRNO_TSK_NOT_CREATED;
+    }
+
+    *stat = taskCb->wakeupStat;
+    OsIntRestore(intSave);
+
+    return OS_OK;
+}
+
+/*
+ * 描述：清除任务的唤醒时延统计信息
+ */
+OS_SEC_L4_TEXT U32 PRT_TaskWakeupStatClear(TskHandle taskPid)
+{
+    uintptr_t intSave;
+    struct TagTskCb *taskCb = NULL;
+
+    if (CHECK_TSK_PID_OVERFLOW(taskPid)) {
+        return OS_ERRNO_TSK_ID_INVALID;
+    }
+
+    taskCb = GET_TCB_HANDLE(taskPid);
+
+    intSave = OsIntLock();
+    if (TSK_IS_UNUSED(taskCb)) {
+        OsIntRestore(intSave);
+        return OS_ERRNO_TSK_NOT_CREATED;
+    }
+
+    if (memset_s(&taskCb->wakeupStat, sizeof(struct TskWakeupStat), 0, sizeof(struct TskWakeupStat)) != EOK) {
+        OS_GOTO_SYS_ERROR1();
+    }
+    OsIntRestore(intSave);
+
+    return OS_OK;
+}
+#endif
@@ -19,6 +19,33 @@ OS_SEC_BSS TskmonTickHook g_tskMonHook;
 /* 软件定时器扫描钩子 */
 OS_SEC_BSS SwitchScanFunc g_swtmrScanHook;
 OS_SEC_BSS TickHandleFunc g_tickUsrHook;
+/* 容差对齐统计 */
+OS_SEC_BSS struct SwTmrSlackStat g_tickSlackStat;
+OS_SEC_BSS U32 g_tickSlackExpireNum;
+OS_SEC_BSS U32 g_tickSlackMovedNum;
+
+/*
+ * 描述：当前Tick有超时到期时计一次唤醒。
+ * 移动过到期Tick的超时与未移动的超时在同一Tick到期时，每个移动过的超时节省一次唤醒；
+ * 同一Tick到期的全部是移动过的超时时，其中一个仍需唤醒。
+ */
+OS_SEC_ALW_INLINE INLINE void OsTickSlackStatUpdate(void)
+{
+    uintptr_t intSave;
+
+    if (g_tickSlackExpireNum == 0) {
+        return;
+    }
+
+    intSave = OsIntLock();
+    g_tickSlackStat.wakeupCount++;
+    g_tickSlackStat.expireCount += g_tickSlackExpireNum;
+    g_tickSlackStat.savedWakeup += (g_tickSlackMovedNum == g_tickSlackExpireNum) ?
+        (g_tickSlackMovedNum - 1) : g_tickSlackMovedNum;
+    g_tickSlackExpireNum = 0;
+    g_tickSlackMovedNum = 0;
+    OsIntRestore(intSave);
+}
 
 /*
  * 描述：Tick中断的处理函数。扫描任务超时链表、扫描超时软件定时器、扫描TSKMON等。
@@ -29,7 +56,10 @@ OS_SEC_TEXT void OsTickDispatcher(void)
 
     intSave = OsIntLock();
 
+    OsSeqWriteBegin(&g_timeKeeper.lock);
     g_uniTicks++;
+    g_timeKeeper.tickCycle = OsCurCycleGet64();
+    OsSeqWriteEnd(&g_timeKeeper.lock);
 
     OS_TICK_COUNT_UPDATE();
 
@@ -44,6 +74,7 @@ OS_SEC_TEXT void OsTickDispatcher(void)
     TICK_USER_HOOK_RUN();
 
     OS_SWTMR_SCAN();
+    OsTickSlackStatUpdate();
     TSKMON_TICK_RUN();
 }
 
@@ -25,6 +25,9 @@ OS_SEC_L4_TEXT U32 OsTickRegister(struct TickModInfo *modInfo)
 {
     g_tickModInfo.tickPerSecond = modInfo->tickPerSecond;
     g_tickModInfo.tickPriority = modInfo->tickPriority;
+    if (g_tickModInfo.tickPerSecond != 0) {
+        OsLibDivConstInit(&g_sysClkConv.tickPerSec, g_tickModInfo.tickPerSecond);
+    }
 
     return OS_OK;
 }
@@ -23,16 +23,17 @@ OS_SEC_ALW_INLINE INLINE void OsSwtmrProc(struct TagSwTmrCtrl *swtmr)
             if (swtmr->mode == (U8)OS_TIMER_LOOP) {
                 OsSwTmrStart(swtmr, swtmr->interval);
             } else {
-                swtmr->idxRollNum = 0;
+                swtmr->remain = 0;
                 swtmr->state = (U8)OS_TIMER_CREATED;
             }
             break;
         case OS_SWTMR_PRE_RUNNING:
-            OsSwTmrStart(swtmr, swtmr->interval);
+            /* 超时处理期间通过OsSwTmrArm重新设置了首次到期时间时，按remain启动 */
+            OsSwTmrStart(swtmr, (swtmr->remain != 0) ? swtmr->remain : swtmr->interval);
             break;
         case OS_SWTMR_PRE_CREATED:
             // ,定时器超时处理后，剩余时间置为0，启动定时器时再赋值swtmr->interval
-            swtmr->idxRollNum = 0;
+            swtmr->remain = 0;
             swtmr->overrun = 0;
             swtmr->state = (U8)OS_TIMER_CREATED;
             break;
@@ -46,47 +47,40 @@ OS_SEC_ALW_INLINE INLINE void OsSwtmrProc(struct TagSwTmrCtrl *swtmr)
 }
 
 /*
- * 描述：调用本函数需要先锁上timer, 调用osIntLock
+ * 描述：把链表上的节点整体转移到另一个链表头下，调用者需关中断
  */
-OS_SEC_ALW_INLINE INLINE void OsSwTmrScanProcess(struct TagListObject *object, struct TagListObject *listObject,
-                                                 struct TagSwTmrSortLinkAttr *tmrSort, struct TagSwTmrCtrl *outLink)
+OS_SEC_ALW_INLINE INLINE void OsSwTmrListMove(struct TagListObject *from, struct TagListObject *to)
 {
-    /*
-     * 处理3种情况
-     * [1] 如果第一个节点的rollNum就大于0，则outLink=NULL。
-     * [2] 如果是从中间跳出，则第一个rollNum非0节点为swtmr，前面的定时器为超时定时器。
-     * 最后一个超时定时器的next置为NULL，listObject->next指向swtmr。
-     * swtmr->prev指向listObject。
-     * [3] 如果全部节点都超时，则是从while条件语句跳出。swtmr为listObject。
-     * 最后一个定时器的next置为NULL，listObject->next指向swtmr即本身。
-     * swtmr->prev指向listObject即本身。
-     */
-    struct TagSwTmrCtrl *temp = NULL;
-    struct TagSwTmrCtrl *swtmr = (struct TagSwTmrCtrl *)object->next;
-    (void)tmrSort;
-    object->next = NULL;
-    /* 更新SortLink成员next指针 */
-    listObject->next = (struct TagListObject *)swtmr;
-    /* 第一个rollNum非0节点的prev指针指向SortLink成员 */
-    swtmr->prev = (struct TagSwTmrCtrl *)listObject;
-    (void)OsIntUnLock();
-
-    /* 处理超时链表中的定时器 */
-    swtmr = outLink;
-    while ((swtmr != NULL) && (swtmr != (struct TagSwTmrCtrl *)listObject)) {
-        temp = swtmr->next;
-        swtmr->handler(OS_SWTMR_INDEX_2_ID(swtmr->swtmrIndex), swtmr->arg1, swtmr->arg2, swtmr->arg3, swtmr->arg4);
-
-        (void)OsIntLock();
-
-        swtmr->prev = NULL;
-        swtmr->next = NULL;
-        OsSwtmrProc(swtmr);
+    if (ListEmpty(from)) {
+        INIT_LIST_OBJECT(to);
+        return;
+    }
 
-        (void)OsIntUnLock();
+    to->next = from->next;
+    to->prev = from->prev;
+    to->next->prev = to;
+    to->prev->next = to;
+    INIT_LIST_OBJECT(from);
+}
 
-        swtmr = temp;
+/*
+ * 描述：把第level级当前槽的定时器按到期时间重新挂入低级时间轮，返回该级当前槽下标
+ */
+OS_SEC_ALW_INLINE INLINE U32 OsSwTmrWheelCascade(U32 level)
+{
+    struct TagListObject list;
+    struct TagSwTmrCtrl *swtmr = NULL;
+    U32 idx = (U32)(g_tmrWheel.curTick >> (OS_SWTMR_WHEEL_BITS * level)) & OS_SWTMR_WHEEL_MASK;
+
+    /* 先摘下整个槽再重新挂入，超出时间轮范围的定时器重新挂回最高级时不会被重复处理 */
+    OsSwTmrListMove(OS_SWTMR_WHEEL_SLOT(level, idx), &list);
+    while (!ListEmpty(&list)) {
+        swtmr = (struct TagSwTmrCtrl *)LIST_FIRST(&list);
+        ListDelete((struct TagListObject *)swtmr);
+        OsSwTmrWheelAdd(swtmr);
     }
+
+    return idx;
 }
 
 /*
@@ -94,108 +88,125 @@ OS_SEC_ALW_INLINE INLINE void OsSwTmrScanProcess(struct TagListObject *object, s
  */
 OS_SEC_TEXT void OsSwTmrScan(void)
 {
-    struct TagSwTmrCtrl *swtmr = NULL;
-    struct TagSwTmrCtrl *outLink = NULL;
+    U32 idx;
+    U32 level;
+    struct TagListObject outLink;
     struct TagListObject *listObject = NULL;
-    struct TagListObject *object = NULL;
+    struct TagSwTmrCtrl *swtmr = NULL;
     uintptr_t intSave;
 
-    /*
-     * 扫描计时链表，把超时定时器从计时链表中删除，状态置为OUT状态
-     * 超时的定时器形成超时链表(从首节点到第一个rollNum非0节点)。
-     */
     intSave = OsIntLock();
 
-    g_tmrSortLink.cursor = (g_tmrSortLink.cursor + 1) % OS_SWTMR_SORTLINK_LEN;
-    /*
-     * 从计时链表中获取超时链表
-     */
-    listObject = g_tmrSortLink.sortLink + g_tmrSortLink.cursor;
-    if (listObject->next == listObject) { /* 没有计时定时器 */
+    g_tmrWheel.curTick++;
+    idx = (U32)g_tmrWheel.curTick & OS_SWTMR_WHEEL_MASK;
+
+    /* 低级时间轮转满一圈时，把高一级当前槽的定时器下移，逐级向上传递 */
+    for (level = 1; (idx == 0) && (level < OS_SWTMR_WHEEL_LEVEL_NUM); level++) {
+        idx = OsSwTmrWheelCascade(level);
+    }
+
+    listObject = OS_SWTMR_WHEEL_SLOT(0, (U32)g_tmrWheel.curTick & OS_SWTMR_WHEEL_MASK);
+    if (ListEmpty(listObject)) { /* 没有超时定时器 */
         OsIntRestore(intSave);
         return;
     }
 
-    outLink = (struct TagSwTmrCtrl *)listObject->next;
-    object = listObject;
-    while (object->next != listObject) {
-        swtmr = (struct TagSwTmrCtrl *)object->next;
-        if (UWROLLNUM(swtmr->idxRollNum) > 0) {
-            UWROLLNUMDEC(swtmr->idxRollNum);
-            if (swtmr->prev == (struct TagSwTmrCtrl *)listObject) {
-                /*
-                 * 如果第一个定时器rollNum>0，则表示没有超时链表为空
-                 */
-                outLink = NULL;
-            }
-            break;
-        } else {
-            if (swtmr->overrun < (U8)0xFF) {
-                swtmr->overrun++;
-            }
+    /* 第0级当前槽上的定时器全部在本Tick到期，整体摘下形成超时链表 */
+    OsSwTmrListMove(listObject, &outLink);
+    for (listObject = LIST_FIRST(&outLink); listObject != &outLink; listObject = listObject->next) {
+        swtmr = (struct TagSwTmrCtrl *)listObject;
+        if (swtmr->overrun < (U8)0xFF) {
+            swtmr->overrun++;
         }
         swtmr->state = (U8)OS_TIMER_EXPIRED;
-        object = object->next;
+        OsTickSlackExpire(swtmr->slackMoved != 0);
     }
 
-    OsSwTmrScanProcess(object, listObject, NULL, outLink);
+#if defined(OS_OPTION_SWTMR_TASK)
+    /* Tick中断只把超时定时器转交给定时器任务，处理时间与超时处理函数无关 */
+    while (!ListEmpty(&outLink)) {
+        swtmr = (struct TagSwTmrCtrl *)LIST_FIRST(&outLink);
+        ListDelete((struct TagListObject *)swtmr);
+        OsAtomicStackPush(&g_tmrExpireList, swtmr);
+    }
+    (void)PRT_EventWrite(g_swtmrTaskId, OS_SWTMR_TASK_EVENT);
 
-    return;
+    OsIntRestore(intSave);
+#else
+    (void)OsIntUnLock();
+
+    /* 处理超时链表中的定时器，超时处理函数执行期间对该定时器的操作只记录在state高位，不改动链表 */
+    while (!ListEmpty(&outLink)) {
+        swtmr = (struct TagSwTmrCtrl *)LIST_FIRST(&outLink);
+        OS_TRACE(OS_TRACE_EVENT_TIMER_EXPIRE, OS_SWTMR_INDEX_2_ID(swtmr->swtmrIndex), 0, 0);
+        swtmr->handler(OS_SWTMR_INDEX_2_ID(swtmr->swtmrIndex), swtmr->arg1, swtmr->arg2, swtmr->arg3, swtmr->arg4);
+
+        (void)OsIntLock();
+
+        ListDelete((struct TagListObject *)swtmr);
+        OsSwtmrProc(swtmr);
+
+        (void)OsIntUnLock();
+    }
+#endif
 }
 
-OS_SEC_ALW_INLINE INLINE struct TagListObject *OsSwTmrStartInner(struct TagSwTmrCtrl *swtmr, U32 interval)
+#if defined(OS_OPTION_SWTMR_TASK)
+/*
+ * 描述：软件定时器任务入口，取走Tick中断压入的超时定时器，按超时顺序执行超时处理函数
+ */
+OS_SEC_TEXT void OsSwTmrTaskEntry(uintptr_t param1, uintptr_t param2, uintptr_t param3, uintptr_t param4)
 {
-    U32 sortIndex;
-    U32 rollNum;
-
-    sortIndex = interval & OS_SWTMR_SORTLINK_MASK;
-    rollNum = (interval / OS_SWTMR_SORTLINK_LEN);
-    (sortIndex > 0) ? 0 : (rollNum--);
-    EVALUATE_L(swtmr->idxRollNum, rollNum);
-    sortIndex = (sortIndex + g_tmrSortLink.cursor);
-    /* sortIndex % 64; */
-    sortIndex = sortIndex & OS_SWTMR_SORTLINK_MASK;
-    EVALUATE_H(swtmr->idxRollNum, sortIndex);
+    uintptr_t intSave;
+    struct TagSwTmrCtrl *swtmr = NULL;
+    struct TagSwTmrCtrl *next = NULL;
+    struct TagSwTmrCtrl *fifo = NULL;
+
+    (void)param1;
+    (void)param2;
+    (void)param3;
+    (void)param4;
+
+    for (;;) {
+        (void)PRT_EventRead(OS_SWTMR_TASK_EVENT, OS_EVENT_ANY | OS_EVENT_WAIT, OS_EVENT_WAIT_FOREVER, NULL);
+
+        /* 栈上后压入的定时器在前，逆序后按超时先后处理 */
+        swtmr = (struct TagSwTmrCtrl *)OsAtomicStackTake(&g_tmrExpireList);
+        fifo = NULL;
+        while (swtmr != NULL) {
+            next = swtmr->prev;
+            swtmr->prev = fifo;
+            fifo = swtmr;
+            swtmr = next;
+        }
 
-    swtmr->overrun = 0;
-    swtmr->state = (U8)OS_TIMER_RUNNING;
+        while (fifo != NULL) {
+            swtmr = fifo;
+            fifo = swtmr->prev;
+            OS_TRACE(OS_TRACE_EVENT_TIMER_EXPIRE, OS_SWTMR_INDEX_2_ID(swtmr->swtmrIndex), 0, 0);
+            swtmr->handler(OS_SWTMR_INDEX_2_ID(swtmr->swtmrIndex), swtmr->arg1, swtmr->arg2, swtmr->arg3, swtmr->arg4);
 
-    return g_tmrSortLink.sortLink + sortIndex;
+            intSave = OsIntLock();
+            swtmr->prev = NULL;
+            OsSwtmrProc(swtmr);
+            OsIntRestore(intSave);
+        }
+    }
 }
+#endif
+
 /*
  * 描述：软件定时器的启动接口
  */
 OS_SEC_TEXT void OsSwTmrStart(struct TagSwTmrCtrl *swtmr, U32 interval)
 {
-    struct TagSwTmrCtrl *temp = NULL;
-    struct TagListObject *listObject = NULL;
+    /* 到期时间至少为下一个Tick */
+    U64 expire = g_tmrWheel.curTick + ((interval == 0) ? 1 : interval);
 
-    listObject = OsSwTmrStartInner(swtmr, interval);
-    if (listObject->next == listObject) { // 该SortLink成员上是空链
-        swtmr->next = (struct TagSwTmrCtrl *)listObject;
-        swtmr->prev = (struct TagSwTmrCtrl *)listObject;
-        listObject->next = (struct TagListObject *)swtmr;
-        listObject->prev = (struct TagListObject *)swtmr;
-    } else {
-        /*
-         * 从链表头开始查找，从小往大找
-         * 每个链表节点的成员idxRollNum 都是相对于前一个
-         * 节点的到期时间增量，这样就每次到期拿掉一个节点后，
-         * idxRollNum还都是相对时间，不用更新
-         */
-        /* The First Node */
-        temp = (struct TagSwTmrCtrl *)listObject->next;
-        while (temp != (struct TagSwTmrCtrl *)listObject) {
-            if (UWROLLNUM(temp->idxRollNum) > UWROLLNUM(swtmr->idxRollNum)) {
-                UWROLLNUMSUB(temp->idxRollNum, swtmr->idxRollNum);
-                break;
-            }
-            UWROLLNUMSUB(swtmr->idxRollNum, temp->idxRollNum);
-            temp = temp->next;
-        }
-        swtmr->next = temp;
-        swtmr->prev = temp->prev;
-        temp->prev->next = swtmr;
-        temp->prev = swtmr;
-    }
+    swtmr->expire = OsTickSlackAlign(expire, swtmr->slack);
+    swtmr->slackMoved = (U8)(swtmr->expire != expire);
+    swtmr->overrun = 0;
+    swtmr->state = (U8)OS_TIMER_RUNNING;
+
+    OsSwTmrWheelAdd(swtmr);
 }
@@ -49,7 +49,7 @@ OS_SEC_L4_TEXT U32 PRT_SwTmrInfoGet(TimerHandle tmrHandle, struct SwTmrInfo *inf
     info->mode = (enum TmrMode)swtmr->mode;
     info->state = (U8)((U32)swtmr->state & OS_SWTMR_STATUS_MASK);
     // Interval转化为毫秒一定为整数
-    info->interval = (U32)DIV64(((U64)swtmr->interval * OS_SYS_MS_PER_SECOND), g_tickModInfo.tickPerSecond);
+    info->interval = (U32)OsLibDiv(((U64)swtmr->interval * OS_SYS_MS_PER_SECOND), &g_sysClkConv.tickPerSec);
 
     /* 调用内部接口osSwTmrQuery获取剩余时间 */
     OsErrRecord(OsSwTmrQuery(tmrHandle, &expireTime));
@@ -59,3 +59,25 @@ OS_SEC_L4_TEXT U32 PRT_SwTmrInfoGet(TimerHandle tmrHandle, struct SwTmrInfo *inf
 
     return OS_OK;
 }
+
+/*
+ * 描述：获取软件定时器容差对齐的统计信息
+ */
+OS_SEC_L4_TEXT U32 PRT_SwTmrSlackStatGet(struct SwTmrSlackStat *stat)
+{
+    uintptr_t intSave;
+
+    if (g_timerApi[TIMER_TYPE_SWTMR].createTimer == NULL) {
+        return OS_ERRNO_TIMER_NOT_INIT_OR_GROUP_NOT_CREATED;
+    }
+
+    if (stat == NULL) {
+        return OS_ERRNO_SWTMR_RET_PTR_NULL;
+    }
+
+    intSave = OsIntLock();
+    *stat = g_tickSlackStat;
+    OsIntRestore(intSave);
+
+    return OS_OK;
+}
@@ -19,11 +19,46 @@ OS_SEC_BSS U32 g_swTmrMaxNum;
 OS_SEC_BSS struct TagSwTmrCtrl *g_swtmrCbArray;
 /* 软件定时器空闲链表 */
 OS_SEC_BSS struct TagSwTmrCtrl *g_tmrFreeList;
-/* 软件定时器Sortlink */
-OS_SEC_BSS struct TagSwTmrSortLinkAttr g_tmrSortLink;
+/* 软件定时器时间轮 */
+OS_SEC_BSS struct TagSwTmrWheel g_tmrWheel;
+#if defined(OS_OPTION_SWTMR_TASK)
+/* 软件定时器任务ID */
+OS_SEC_BSS TskHandle g_swtmrTaskId;
+/* 待定时器任务处理的超时定时器栈 */
+OS_SEC_BSS void *g_tmrExpireList;
+#endif
 
 /* 基于tick的软件定时器组ID，为支持独立升级，该变量需要在2022年之后版本才能删除 */
 OS_SEC_BSS TimerGroupId g_tickSwTmrGroupId;
+#if defined(OS_OPTION_SWTMR_TASK)
+/*
+ * 描述：创建软件定时器任务，超时处理函数在该任务中执行，可被更高优先级的任务抢占
+ */
+OS_SEC_L4_TEXT U32 OsSwTmrTaskCreate(void)
+{
+    U32 ret;
+    TskHandle taskHdl;
+    struct TskInitParam taskInitParam = {0};
+    char tskName[OS_TSK_NAME_LEN] = "SwTmrTask";
+
+    taskInitParam.taskEntry = (TskEntryFunc)OsSwTmrTaskEntry;
+    taskInitParam.stackSize = OS_SWTMR_TASK_STACK_SIZE;
+    taskInitParam.name = tskName;
+    taskInitParam.taskPrio = OS_SWTMR_TASK_PRIORITY;
+    taskInitParam.stackAddr = 0;
+
+    ret = PRT_TaskCreate(&taskHdl, &taskInitParam);
+    if (ret != OS_OK) {
+        return ret;
+    }
+
+    g_swtmrTaskId = taskHdl;
+    g_tmrExpireList = NULL;
+
+    return PRT_TaskResume(taskHdl);
+}
+#endif
+
 /*
  * 描述：创建普通软件定时器组
  */
@@ -60,6 +95,14 @@ OS_SEC_L4_TEXT U32 OsSwTimerGroupCreate(struct TmrGrpUserCfg *config, TimerGroup
         return ret;
     }
 
+#if defined(OS_OPTION_SWTMR_TASK)
+    ret = OsSwTmrTaskCreate();
+    if (ret != OS_OK) {
+        OsIntRestore(intSave);
+        return ret;
+    }
+#endif
+
     g_timerApi[TIMER_TYPE_SWTMR].createTimer = (TimerCreateFunc)OsSwTmrCreateTimer;
     g_timerApi[TIMER_TYPE_SWTMR].startTimer = (TimerStartFunc)OsSwTmrStartTimer;
     g_timerApi[TIMER_TYPE_SWTMR].stopTimer = (TimerStopFunc)OsSwTmrStopTimer;
@@ -85,13 +128,13 @@ OS_SEC_ALW_INLINE INLINE U32 OsSwTmrCreateTimerParaChk(struct TimerCreatePara *c
         return OS_ERRNO_TIMERGROUP_ID_INVALID;
     }
 
-    if ((DIV64_REMAIN((U64)g_tickModInfo.tickPerSecond * (createPara->interval), OS_SYS_MS_PER_SECOND)) !=
+    if ((OsLibDivRemain((U64)g_tickModInfo.tickPerSecond * (createPara->interval), &g_sysClkConv.msPerSec)) !=
         0) {  // ms转tick时，tick不为整数
         return OS_ERRNO_SWTMR_INTERVAL_NOT_SUITED;
     }
 
     if (createPara->interval >
-        DIV64(OS_SYS_MS_PER_SECOND * ((U64)OS_MAX_U32), g_tickModInfo.tickPerSecond)) {  // 溢出判断
+        OsLibDiv(OS_SYS_MS_PER_SECOND * ((U64)OS_MAX_U32), &g_sysClkConv.tickPerSec)) {  // 溢出判断
         return OS_ERRNO_SWTMR_INTERVAL_OVERFLOW;
     }
     return OS_OK;
@@ -104,9 +147,10 @@ OS_SEC_ALW_INLINE INLINE void OsSwTmrCreateTimerCbInit(struct TimerCreatePara *c
     swtmr->handler = createPara->callBackFunc;
     swtmr->mode = (U8)createPara->mode;
     swtmr->interval = interval;
+    swtmr->slack = createPara->slack;
     swtmr->next = NULL;
     swtmr->prev = NULL;
-    swtmr->idxRollNum = swtmr->interval;
+    swtmr->remain = swtmr->interval;
     swtmr->overrun = 0;
     swtmr->arg1 = createPara->arg1;
     swtmr->arg2 = createPara->arg2;
@@ -139,7 +183,7 @@ OS_SEC_L4_TEXT U32 OsSwTmrCreateTimer(struct TimerCreatePara *createPara, TimerH
         return ret;
     }
 
-    interval = (U32)DIV64(((U64)g_tickModInfo.tickPerSecond * (createPara->interval)), OS_SYS_MS_PER_SECOND);
+    interval = (U32)OsLibDiv(((U64)g_tickModInfo.tickPerSecond * (createPara->interval)), &g_sysClkConv.msPerSec);
 
     intSave = OsIntLock();
 
@@ -241,29 +285,26 @@ OS_SEC_L4_TEXT U32 OsSwTmrResInit(void)
         return OS_ERRNO_SWTMR_NO_MEMORY;
     }
 
-    /* 为SortLink分配内存，初始化g_tmrSortLink */
-    size = sizeof(struct TagListObject) * OS_SWTMR_SORTLINK_LEN;
+    /* 为各级时间轮分配内存，初始化g_tmrWheel */
+    size = sizeof(struct TagListObject) * OS_SWTMR_WHEEL_SIZE * OS_SWTMR_WHEEL_LEVEL_NUM;
     listObject =
         (struct TagListObject *)OsMemAllocAlign((U32)OS_MID_SWTMR, OS_MEM_DEFAULT_FSC_PT, size, MEM_ADDR_ALIGN_016);
     if (listObject == NULL) {
         return OS_ERRNO_SWTMR_NO_MEMORY;
     }
 
-    if (memset_s(listObject, size, 0, size) != EOK) {
-        OS_GOTO_SYS_ERROR1();
-    }
-    g_tmrSortLink.sortLink = listObject;
-    g_tmrSortLink.cursor = 0;
+    g_tmrWheel.slot = listObject;
+    /* 与系统Tick计数同步，软件定时器与任务延时的容差对齐到相同的Tick上 */
+    g_tmrWheel.curTick = g_uniTicks;
 
-    for (idx = 0; idx < OS_SWTMR_SORTLINK_LEN; idx++, listObject++) {
-        listObject->next = listObject;
-        listObject->prev = listObject;
+    for (idx = 0; idx < (OS_SWTMR_WHEEL_SIZE * OS_SWTMR_WHEEL_LEVEL_NUM); idx++, listObject++) {
+        INIT_LIST_OBJECT(listObject);
     }
 
     size = sizeof(struct TagSwTmrCtrl) * g_swTmrMaxNum;
     swtmr = (struct TagSwTmrCtrl *)OsMemAllocAlign((U32)OS_MID_SWTMR, OS_MEM_DEFAULT_FSC_PT, size, MEM_ADDR_ALIGN_016);
     if (swtmr == NULL) {
-        ret = PRT_MemFree((U32)OS_MID_SWTMR, (void *)g_tmrSortLink.sortLink);
+        ret = PRT_MemFree((U32)OS_MID_SWTMR, (void *)g_tmrWheel.slot);
         if (ret != OS_OK) {
             OS_REPORT_ERROR(ret);
         }
@@ -26,144 +26,52 @@
 #include "prt_tick_external.h"
 #include "prt_mem_external.h"
 #include "prt_list_external.h"
+#include "prt_trace_external.h"
 #include "prt_cpu_external.h"
+#if defined(OS_OPTION_SWTMR_TASK)
+#include "prt_task.h"
+#include "prt_event.h"
+#endif
 
 /*
  * 模块内宏定义
  */
-#define OS_SWTMR_SORTLINK_LEN   64 /* SortLink数组长度 */
-#define OS_SWTMR_SORTLINK_MASK  0x3FUL
+/*
+ * 多级时间轮，每级OS_SWTMR_WHEEL_SIZE个槽，第n级每个槽覆盖OS_SWTMR_WHEEL_SIZE^n个Tick。
+ * 定时器按绝对到期Tick挂入对应级的槽，启动、停止、查询均为常数时间，高级槽的定时器在低级轮转满一圈时下移。
+ */
+#define OS_SWTMR_WHEEL_BITS 6
+#define OS_SWTMR_WHEEL_SIZE (1U << OS_SWTMR_WHEEL_BITS)
+#define OS_SWTMR_WHEEL_MASK (OS_SWTMR_WHEEL_SIZE - 1)
+#define OS_SWTMR_WHEEL_LEVEL_NUM 4
+/* 时间轮能直接表示的最大Tick跨度，超出的定时器先挂在最高级，下移时重新计算位置 */
+#define OS_SWTMR_WHEEL_RANGE ((U64)1 << (OS_SWTMR_WHEEL_BITS * OS_SWTMR_WHEEL_LEVEL_NUM))
+#define OS_SWTMR_WHEEL_SLOT(level, idx) (g_tmrWheel.slot + ((level) << OS_SWTMR_WHEEL_BITS) + (idx))
 
 #define OS_TICK_SWTMR_GROUP_ID 0 /* 软件定时器组ID号 */
 
+#if defined(OS_OPTION_SWTMR_TASK)
+/* Tick中断通知定时器任务处理超时链表的事件 */
+#define OS_SWTMR_TASK_EVENT 0x1U
+#endif
+
 #define OS_SWTMR_STATUS_DEFAULT 0
 #define OS_SWTMR_STATUS_MASK 0xfU
 #define OS_SWTMR_PRE_STATUS_MASK 0xf0U
 
-/*
- * @brief 获取低位的值。
- *
- * @par 描述
- * 宏定义，定义完成从一个32位的数获取低26位的值
- *
- * @attention 无
- * @param  num [IN] 源数。
- *
- * @retval 无
- * @par 依赖
- * <li>prt_swtmr_external.h: 该宏定义所在的头文件。</li></ul>
- * @see UWROLLNUMSUB | UWROLLNUMADD | EVALUATE_L | EVALUATE_H | UWROLLNUM | UWSORTINDEX。
- */
-#define UWROLLNUM(num) ((num) & 0x03ffffffU)
-/*
- * @brief 获取高位的值。
- *
- * @par 描述
- * 宏定义，定义完成从一个32位的数获取高位的值
- *
- * @attention 无
- * @param  num [IN] 源数。
- *
- * @retval 无
- * @par 依赖
- * <li>prt_swtmr_external.h: 该宏定义所在的头文件。</li></ul>
- * @see UWROLLNUMSUB | UWROLLNUMADD | EVALUATE_L | EVALUATE_H | UWROLLNUM | UWSORTINDEX。
- */
-#define UWSORTINDEX(num) ((num) >> 26)
-/*
- * @brief 定义高位赋值。
- *
- * @par 描述
- * 宏定义，屏蔽高6位，把值与到高6位
- *
- * @attention 无
- * @param  num [IN] 被赋值的变量。
- * @param  value [IN] 待赋的值或变量。
- *
- * @retval 无
- * @par 依赖
- * <li>prt_swtmr_external.h: 该宏定义所在的头文件。</li></ul>
- * @see UWROLLNUMSUB | UWROLLNUMADD | EVALUATE_L | EVALUATE_H | UWROLLNUM | UWSORTINDEX。
- */
-#define EVALUATE_H(num, value) ((num) = (((num) & 0x03ffffffU) | ((value) << 26)))
-
-/*
- * @brief 定义低位赋值。
- *
- * @par 描述
- * 宏定义，定义完成一个32位的数低位赋值的功能，高位不变。
- *
- * @attention 无
- * @param  num [IN] 被赋值的变量。
- * @param  value [IN] 待赋的值或变量。
- *
- * @retval 无
- * @par 依赖
- * <li>prt_swtmr_external.h: 该宏定义所在的头文件。</li></ul>
- * @see UWROLLNUMSUB | UWROLLNUMADD | EVALUATE_L | EVALUATE_H | UWROLLNUM | UWSORTINDEX。
- */
-#define EVALUATE_L(num, value) ((num) = (((num) & 0xfc000000U) | (value)))
-
-/*
- * @brief 定义两个数低位相减的功能。
- *
- * @par 描述
- * 宏定义，定义完成一个32位的数低位相加，结果存放到第一个参数，H(num1) = H(num1) - H(num2)。
- * 如 两个定时器控制块中sortData低位的rollNum进行相加。
- *
- * @attention 无
- * @param  num1 [IN] 被加数。
- * @param  num2 [IN] 加数。
- *
- * @retval 无
- * @par 依赖
- * <li>prt_swtmr_external.h: 该宏定义所在的头文件。</li></ul>
- * @see UWROLLNUMSUB | UWROLLNUMADD | EVALUATE_L | EVALUATE_H | UWROLLNUM | UWSORTINDEX。
- */
-#define UWROLLNUMADD(num1, num2) ((num1) = (((num1) & 0xfc000000U) | (UWROLLNUM(num1) + UWROLLNUM(num2))))
-
-/*
- * @brief 定义两个数低位相减的功能。
- *
- * @par 描述
- * 宏定义，定义完成一个32位的数低位相减，结果存放到第一个参数，H(num1) = H(num1) - H(num2)。
- * 如 两个定时器控制块中sortData低位的rollNum进行相减。
- *
- * @attention 无
- * @param  num1 [IN] 被减数。
- * @param  num2 [IN] 减数。
- *
- * @retval 无
- * @par 依赖
- * <li>prt_swtmr_external.h: 该宏定义所在的头文件。</li></ul>
- * @see UWROLLNUMSUB | UWROLLNUMADD | EVALUATE_L | EVALUATE_H | UWROLLNUM | UWSORTINDEX。
- */
-#define UWROLLNUMSUB(num1, num2) ((num1) = (((num1) & 0xfc000000U) | (UWROLLNUM(num1) - UWROLLNUM(num2))))
-
-/*
- * @brief 定义低位减1的功能。
- *
- * @par 描述
- * 宏定义，定义完成一个32位的数低位自减1。
- * 如 定时器控制块中sortData低位的rollNum进行自减1操作
- *
- * @attention 无
- * @param  num [IN] 低为待自减1的数。
- *
- * @retval 无
- * @par 依赖
- * <li>prt_swtmr_external.h: 该宏定义所在的头文件。</li></ul>
- * @see UWROLLNUMSUB | UWROLLNUMADD | EVALUATE_L | EVALUATE_H | UWROLLNUM | UWSORTINDEX。
- */
-#define UWROLLNUMDEC(num) ((num) = ((num) - 1))
-
 /*
  * 模块内全局变量声明
  */
-/* 软件定时器Sortlink */
-extern struct TagSwTmrSortLinkAttr g_tmrSortLink;
+/* 软件定时器时间轮 */
+extern struct TagSwTmrWheel g_tmrWheel;
 /* 软件定时器空闲链表 */
 extern struct TagSwTmrCtrl *g_tmrFreeList;
+#if defined(OS_OPTION_SWTMR_TASK)
+/* 软件定时器任务ID */
+extern TskHandle g_swtmrTaskId;
+/* 待定时器任务处理的超时定时器栈，以控制块首个字(prev)为链接字 */
+extern void *g_tmrExpireList;
+#endif
 
 /*
  * 模块内函数声明
@@ -187,6 +95,17 @@ extern U32 OsSwTmrResInit(void);
  */
 extern void OsSwTmrScan(void);
 
+#if defined(OS_OPTION_SWTMR_TASK)
+/*
+ * Function   : OsSwTmrTaskEntry
+ * Description: 软件定时器任务入口，执行Tick中断转交的超时处理函数
+ * Input      : none
+ * Output     : none
+ * Return     : none
+ */
+extern void OsSwTmrTaskEntry(uintptr_t param1, uintptr_t param2, uintptr_t param3, uintptr_t param4);
+#endif
+
 /*
  * Function   : OsSwTmrGetRemainTick
  * Description: 获取软件定时器剩余Tick数的内部接口
@@ -291,6 +210,37 @@ extern void OsSwTmrDelete(struct TagSwTmrCtrl *swtmr);
  */
 extern U32 OsSwTmrGetOverrun(TimerHandle tmrHandle, U32 *overrun);
 
+/*
+ * 描述：按绝对到期Tick把定时器挂入时间轮，调用者需关中断
+ */
+OS_SEC_ALW_INLINE INLINE void OsSwTmrWheelAdd(struct TagSwTmrCtrl *swtmr)
+{
+    U32 level;
+    U32 idx;
+    U64 expire = swtmr->expire;
+    U64 delta;
+
+    /* 级联下移时可能遇到恰好在当前Tick到期的定时器，挂到当前槽随后处理 */
+    if (expire < g_tmrWheel.curTick) {
+        expire = g_tmrWheel.curTick;
+    }
+
+    delta = expire - g_tmrWheel.curTick;
+    if (delta >= OS_SWTMR_WHEEL_RANGE) {
+        expire = g_tmrWheel.curTick + OS_SWTMR_WHEEL_RANGE - 1;
+        delta = OS_SWTMR_WHEEL_RANGE - 1;
+    }
+
+    for (level = 0; level < (OS_SWTMR_WHEEL_LEVEL_NUM - 1); level++) {
+        if (delta < ((U64)1 << (OS_SWTMR_WHEEL_BITS * (level + 1)))) {
+            break;
+        }
+    }
+
+    idx = (U32)(expire >> (OS_SWTMR_WHEEL_BITS * level)) & OS_SWTMR_WHEEL_MASK;
+    ListTailAdd((struct TagListObject *)swtmr, OS_SWTMR_WHEEL_SLOT(level, idx));
+}
+
 #define OsSwtmrIqrSplLock(a) OsIntLock()
 #define OsSwtmrIqrSplUnlock(a, b) OsIntRestore(b)
 
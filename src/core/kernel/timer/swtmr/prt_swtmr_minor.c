@@ -14,31 +14,12 @@
  */
 #include "prt_swtmr_internal.h"
 
-OS_SEC_L4_TEXT U32 OsSwTmrGetRemain(struct TagSwTmrCtrl *swtmr)
+/*
+ * 描述：计时定时器的剩余Tick数，由绝对到期时间直接得到
+ */
+OS_SEC_ALW_INLINE INLINE U32 OsSwTmrGetRemain(struct TagSwTmrCtrl *swtmr)
 {
-    U32 retValue = 0;
-    U32 temp;
-    struct TagSwTmrCtrl *timer = NULL;
-    struct TagListObject *listObject = NULL;
-
-    temp = UWSORTINDEX(swtmr->idxRollNum);
-    if (temp <= g_tmrSortLink.cursor) {
-        temp = temp + OS_SWTMR_SORTLINK_LEN;
-    }
-    temp -= g_tmrSortLink.cursor;
-
-    listObject = g_tmrSortLink.sortLink + (uintptr_t)UWSORTINDEX(swtmr->idxRollNum);
-
-    timer = swtmr;
-
-    while (timer != (struct TagSwTmrCtrl *)listObject) {
-        retValue += UWROLLNUM(timer->idxRollNum);
-        timer = timer->prev;
-    }
-    retValue = retValue * OS_SWTMR_SORTLINK_LEN;
-    retValue = retValue + temp;
-
-    return retValue;
+    return (U32)(swtmr->expire - g_tmrWheel.curTick);
 }
 
 /*
@@ -53,7 +34,7 @@ OS_SEC_L4_TEXT U32 OsSwTmrGetRemainTick(struct TagSwTmrCtrl *swtmr)
     switch (swtmr->state & OS_SWTMR_STATUS_MASK) {
         case OS_TIMER_CREATED:
             OsIntRestore(intSave);
-            return (swtmr->idxRollNum);
+            return (swtmr->remain);
         case OS_TIMER_EXPIRED:
             OsIntRestore(intSave);
             return 0;
@@ -72,29 +53,17 @@ OS_SEC_L4_TEXT U32 OsSwTmrGetRemainTick(struct TagSwTmrCtrl *swtmr)
  */
 OS_SEC_L2_TEXT void OsSwTmrStop(struct TagSwTmrCtrl *swtmr, bool reckonOff)
 {
-    U32 idx;
-    struct TagListObject *listObject = NULL;
     uintptr_t intSave;
 
     intSave = OsIntLock();
-    /* if the stoping node have next node ,set its rollnum to the next node's */
-    idx = UWSORTINDEX(swtmr->idxRollNum);
-    listObject = (g_tmrSortLink.sortLink + idx);
-    if (swtmr->next != (struct TagSwTmrCtrl *)listObject) {
-        UWROLLNUMADD(swtmr->next->idxRollNum, swtmr->idxRollNum);
-    }
-
     if (!reckonOff) {
-        /* 调用获取定时器剩余Tick数内部接口 */
-        swtmr->idxRollNum = OsSwTmrGetRemainTick(swtmr);
+        /* 记录剩余Tick数，再次启动时从剩余时间开始计时 */
+        swtmr->remain = OsSwTmrGetRemain(swtmr);
     }
 
-    swtmr->next->prev = swtmr->prev;
-    swtmr->prev->next = swtmr->next;
+    ListDelete((struct TagListObject *)swtmr);
     /* 定时器被暂停，修改定时器状态 */
     swtmr->state = (U8)OS_TIMER_CREATED;
-    swtmr->next = NULL;
-    swtmr->prev = NULL;
 
     OsIntRestore(intSave);
 }
@@ -133,6 +102,7 @@ OS_SEC_L2_TEXT U32 OsSwTmrStartTimer(TimerHandle tmrHandle)
             OsSwtmrIqrSplUnlock(swtmr, intSave);
             return OS_ERRNO_SWTMR_NOT_CREATED;
         case OS_TIMER_EXPIRED:
+            swtmr->remain = 0;
             swtmr->state = OS_SWTMR_PRE_RUNNING | (U8)OS_TIMER_EXPIRED;
             OsSwtmrIqrSplUnlock(swtmr, intSave);
             return OS_OK;
@@ -143,12 +113,12 @@ OS_SEC_L2_TEXT U32 OsSwTmrStartTimer(TimerHandle tmrHandle)
             break;
     }
 
-    if (swtmr->idxRollNum == 0) {
+    if (swtmr->remain == 0) {
         // ,定时器超时处理后或者在超时处理函数中停止定时器，剩余时间置为0，启动定时器时再赋值swtmr->interval
-        swtmr->idxRollNum = swtmr->interval;
+        swtmr->remain = swtmr->interval;
     }
 
-    OsSwTmrStart(swtmr, swtmr->idxRollNum);
+    OsSwTmrStart(swtmr, swtmr->remain);
 
     OsSwtmrIqrSplUnlock(swtmr, intSave);
 
@@ -211,6 +181,7 @@ OS_SEC_L2_TEXT U32 OsSwTmrRestartTimer(TimerHandle tmrHandle)
             OsSwtmrIqrSplUnlock(swtmr, intSave);
             return OS_ERRNO_SWTMR_NOT_CREATED;
         case OS_TIMER_EXPIRED:
+            swtmr->remain = 0;
             swtmr->state = OS_SWTMR_PRE_RUNNING | (U8)OS_TIMER_EXPIRED;
             OsSwtmrIqrSplUnlock(swtmr, intSave);
             return OS_OK;
@@ -228,6 +199,75 @@ OS_SEC_L2_TEXT U32 OsSwTmrRestartTimer(TimerHandle tmrHandle)
     return OS_OK;
 }
 
+/*
+ * 描述：设置软件定时器的首次到期Tick数和周期Tick数并启动，一次关中断完成，用于需要频繁重设的场景。
+ * 周期为0时为单次定时器，首次到期Tick数为0时停止定时器。
+ */
+OS_SEC_L2_TEXT U32 OsSwTmrArm(TimerHandle tmrHandle, U32 expire, U32 interval)
+{
+    struct TagSwTmrCtrl *swtmr = NULL;
+    uintptr_t intSave;
+    U8 status;
+
+    if (OS_TIMER_GET_INDEX(tmrHandle) >= g_swTmrMaxNum) {
+        return OS_ERRNO_TIMER_HANDLE_INVALID;
+    }
+
+    swtmr = g_swtmrCbArray + OS_SWTMR_ID_2_INDEX(tmrHandle);
+    intSave = OsSwtmrIqrSplLock(swtmr);
+
+    status = swtmr->state & OS_SWTMR_STATUS_MASK;
+    if (status == (U8)OS_TIMER_FREE) {
+        OsSwtmrIqrSplUnlock(swtmr, intSave);
+        return OS_ERRNO_SWTMR_NOT_CREATED;
+    }
+
+    if (status == (U8)OS_TIMER_RUNNING) {
+        OsSwTmrStop(swtmr, TRUE);
+    }
+
+    swtmr->mode = (interval == 0) ? (U8)OS_TIMER_ONCE : (U8)OS_TIMER_LOOP;
+    swtmr->interval = (interval == 0) ? expire : interval;
+    swtmr->remain = expire;
+
+    if (status == (U8)OS_TIMER_EXPIRED) {
+        /* 超时处理函数执行中，处理完成后再按remain启动或停止 */
+        swtmr->state = ((expire == 0) ? OS_SWTMR_PRE_CREATED : OS_SWTMR_PRE_RUNNING) | (U8)OS_TIMER_EXPIRED;
+    } else if (expire != 0) {
+        OsSwTmrStart(swtmr, expire);
+    }
+
+    OsSwtmrIqrSplUnlock(swtmr, intSave);
+    return OS_OK;
+}
+
+/*
+ * 描述：查询软件定时器剩余Tick数及周期Tick数，单次定时器周期为0
+ */
+OS_SEC_L2_TEXT U32 OsSwTmrTickQuery(TimerHandle tmrHandle, U32 *remain, U32 *interval)
+{
+    struct TagSwTmrCtrl *swtmr = NULL;
+    uintptr_t intSave;
+
+    if (OS_TIMER_GET_INDEX(tmrHandle) >= g_swTmrMaxNum) {
+        return OS_ERRNO_TIMER_HANDLE_INVALID;
+    }
+
+    swtmr = g_swtmrCbArray + OS_SWTMR_ID_2_INDEX(tmrHandle);
+    intSave = OsSwtmrIqrSplLock(swtmr);
+
+    if (swtmr->state == (U8)OS_TIMER_FREE) {
+        OsSwtmrIqrSplUnlock(swtmr, intSave);
+        return OS_ERRNO_SWTMR_NOT_CREATED;
+    }
+
+    *remain = OsSwTmrGetRemainTick(swtmr);
+    *interval = (swtmr->mode == (U8)OS_TIMER_LOOP) ? swtmr->interval : 0;
+
+    OsSwtmrIqrSplUnlock(swtmr, intSave);
+    return OS_OK;
+}
+
 /*
  * 描述：查询软件定时器剩余超时时间
  */
@@ -237,6 +277,7 @@ OS_SEC_L2_TEXT U32 OsSwTmrQuery(TimerHandle tmrHandle, U32 *expireTime)
     uintptr_t intSave;
     U32 remainTick;
     U32 remainMs;
+    U64 tickMs;
 
     if (OS_TIMER_GET_INDEX(tmrHandle) >= g_swTmrMaxNum) {
         return OS_ERRNO_TIMER_HANDLE_INVALID;
@@ -253,8 +294,10 @@ OS_SEC_L2_TEXT U32 OsSwTmrQuery(TimerHandle tmrHandle, U32 *expireTime)
 
     /* 调用获取定时器剩余Tick数内部接口 */
     remainTick = OsSwTmrGetRemainTick(swtmr);
-    remainMs = (U32)DIV64(((U64)remainTick * OS_SYS_MS_PER_SECOND), g_tickModInfo.tickPerSecond);
-    if (DIV64_REMAIN((U64)remainTick * OS_SYS_MS_PER_SECOND, g_tickModInfo.tickPerSecond) != 0) {  // 若不整除，则+1
+    /* 按预先计算的倒数因子换算，不做64位除法 */
+    tickMs = (U64)remainTick * OS_SYS_MS_PER_SECOND;
+    remainMs = (U32)OsLibDiv(tickMs, &g_sysClkConv.tickPerSec);
+    if (OsLibDivRemain(tickMs, &g_sysClkConv.tickPerSec) != 0) {  // 若不整除，则+1
         remainMs++;
     }
 
@@ -105,6 +105,71 @@ OS_SEC_ALW_INLINE INLINE U32 PRT_GetCoreID(void)
     return OsGetCoreID();
 }
 
+/*
+ * @brief 按地址范围写回DCache。
+ *
+ * @par 描述
+ * 将[addr, addr + size)所在cache行的脏数据写回内存，用于CPU写缓冲区后启动DMA读取。
+ *
+ * @param addr [IN]  类型#const void *，起始地址。
+ * @param size [IN]  类型#uintptr_t，长度。
+ *
+ * @retval 无
+ * @par 依赖
+ * <ul><li>os_cpu_armv8.h：该接口声明所在的头文件。</li></ul>
+ * @see PRT_DCacheInv
+ */
+extern void PRT_DCacheFlush(const void *addr, uintptr_t size);
+
+/*
+ * @brief 按地址范围无效DCache。
+ *
+ * @par 描述
+ * 无效[addr, addr + size)所在的cache行，用于DMA写入内存后CPU读取。
+ * @attention
+ * <ul>
+ * <li>首尾不完整的cache行先写回再无效，缓冲区应按cache行对齐及补齐，否则DMA写入的数据可能被相邻数据的写回覆盖。</li>
+ * </ul>
+ *
+ * @param addr [IN]  类型#void *，起始地址。
+ * @param size [IN]  类型#uintptr_t，长度。
+ *
+ * @retval 无
+ * @par 依赖
+ * <ul><li>os_cpu_armv8.h：该接口声明所在的头文件。</li></ul>
+ * @see PRT_DCacheFlush
+ */
+extern void PRT_DCacheInv(void *addr, uintptr_t size);
+
+/*
+ * @brief 按地址范围写回并无效DCache。
+ *
+ * @param addr [IN]  类型#void *，起始地址。
+ * @param size [IN]  类型#uintptr_t，长度。
+ *
+ * @retval 无
+ * @par 依赖
+ * <ul><li>os_cpu_armv8.h：该接口声明所在的头文件。</li></ul>
+ * @see PRT_DCacheFlush | PRT_DCacheInv
+ */
+extern void PRT_DCacheFlushInv(void *addr, uintptr_t size);
+
+/*
+ * @brief 按地址范围无效ICache。
+ *
+ * @par 描述
+ * 写入代码后调用，调用前需先用PRT_DCacheFlush写回对应范围。
+ *
+ * @param addr [IN]  类型#const void *，起始地址。
+ * @param size [IN]  类型#uintptr_t，长度。
+ *
+ * @retval 无
+ * @par 依赖
+ * <ul><li>os_cpu_armv8.h：该接口声明所在的头文件。</li></ul>
+ * @see PRT_DCacheFlush
+ */
+extern void PRT_ICacheInv(const void *addr, uintptr_t size);
+
 #define PRT_DSB() OS_EMBED_ASM("DSB sy" : : : "memory")
 #define PRT_DMB() OS_EMBED_ASM("DMB sy" : : : "memory")
 #define PRT_ISB() OS_EMBED_ASM("ISB" : : : "memory")
@@ -246,6 +246,15 @@ enum OsHwiIpiType {
  */
 #define OS_ERROR_HWI_BASE_ADDR_INVALID OS_ERRNO_BUILD_ERROR(OS_MID_HWI, 0x12)
 
+/*
+ * 硬中断错误码：关中断时间统计接口的指针参数为NULL。
+ *
+ * 值: 0x02000813
+ *
+ * 解决方案: 检查传入的指针参数是否为NULL
+ */
+#define OS_ERRNO_HWI_IRQSOFF_PTR_NULL OS_ERRNO_BUILD_ERROR(OS_MID_HWI, 0x13)
+
 /*
  * 硬中断优先级的类型定义。
  */
@@ -640,6 +649,114 @@ extern uintptr_t PRT_HwiLock(void);
  */
 extern void PRT_HwiRestore(uintptr_t intSave);
 
+#if defined(OS_OPTION_IRQSOFF_TRACE)
+/*
+ * 关中断时间直方图的区间个数，第0个区间为[0, 1)us，第i个区间为[2^(i-1), 2^i)us，最后一个区间不设上限。
+ */
+#define OS_HWI_IRQSOFF_HIST_NUM 16
+
+/*
+ * 关中断调用点统计信息的结构体定义，只统计超过门限的关中断区间。
+ */
+struct HwiIrqsOffSite {
+    /* 关中断调用点，即调用PRT_HwiLock处的返回地址 */
+    uintptr_t lockAddr;
+    /* 关中断时间最长一次对应的恢复中断调用点返回地址 */
+    uintptr_t unlockAddr;
+    /* 超过门限的次数 */
+    U32 count;
+    /* 最长关中断时间，单位us */
+    U32 maxUs;
+    /* 关中断时间直方图 */
+    U32 hist[OS_HWI_IRQSOFF_HIST_NUM];
+};
+
+/*
+ * 关中断统计信息输出函数类型定义，与printf兼容。
+ */
+typedef int (*HwiIrqsOffPrintFunc)(const char *format, ...);
+
+/*
+ * @brief 开始统计关中断时间。
+ *
+ * @par 描述
+ * 清除已有统计信息后开始统计。PRT_HwiLock从开中断状态关中断时记录cycle数及调用点，
+ * 恢复开中断时关中断时间超过门限则按关中断调用点累计次数、最大值及直方图。
+ *
+ * @attention
+ * <ul>
+ * <li>调用点个数超过OS_IRQSOFF_TRACE_SITE_NUM后，新调用点的记录被丢弃，丢弃次数在#PRT_HwiIrqsOffDump中输出。</li>
+ * <li>只统计通过PRT_HwiLock/PRT_HwiUnLock/PRT_HwiRestore开关中断的区间，中断处理本身的时间不计入。</li>
+ * </ul>
+ *
+ * @param thresholdUs [IN]  类型#U32，统计门限，单位us，关中断时间不小于门限的区间才被记录。
+ *
+ * @retval 无
+ * @par 依赖
+ * <ul><li>prt_hwi.h：该接口声明所在的头文件。</li></ul>
+ * @see PRT_HwiIrqsOffTraceStop
+ */
+extern void PRT_HwiIrqsOffTraceStart(U32 thresholdUs);
+
+/*
+ * @brief 停止统计关中断时间。
+ *
+ * @par 描述
+ * 停止统计，已有统计信息保留，可以继续查询。
+ *
+ * @attention 无
+ *
+ * @param 无。
+ *
+ * @retval 无
+ * @par 依赖
+ * <ul><li>prt_hwi.h：该接口声明所在的头文件。</li></ul>
+ * @see PRT_HwiIrqsOffTraceStart
+ */
+extern void PRT_HwiIrqsOffTraceStop(void);
+
+/*
+ * @brief 获取关中断调用点统计信息。
+ *
+ * @par 描述
+ * 获取最多inNum个调用点的统计信息。
+ *
+ * @attention 无
+ *
+ * @param inNum  [IN]  类型#U32，site数组的元素个数。
+ * @param site   [OUT] 类型#struct HwiIrqsOffSite *，存放调用点统计信息的数组。
+ * @param outNum [OUT] 类型#U32 *，实际获取的调用点个数。
+ *
+ * @retval #OS_OK  0x00000000，获取统计信息成功。
+ * @retval #OS_ERRNO_HWI_IRQSOFF_PTR_NULL  0x02000813，指针参数为NULL。
+ * @par 依赖
+ * <ul><li>prt_hwi.h：该接口声明所在的头文件。</li></ul>
+ * @see PRT_HwiIrqsOffDump
+ */
+extern U32 PRT_HwiIrqsOffSiteGet(U32 inNum, struct HwiIrqsOffSite *site, U32 *outNum);
+
+/*
+ * @brief 输出关中断调用点统计信息。
+ *
+ * @par 描述
+ * 通过print逐行输出统计门限、调用点个数、丢弃次数及各调用点的统计信息，可以直接传入printf或shell的输出函数。
+ *
+ * @attention
+ * <ul>
+ * <li>输出期间不关中断，各调用点的信息分别在关中断下读取。</li>
+ * </ul>
+ *
+ * @param print [IN]  类型#HwiIrqsOffPrintFunc，输出函数。
+ *
+ * @retval #OS_OK  0x00000000，输出成功。
+ * @retval #OS_ERRNO_HWI_IRQSOFF_PTR_NULL  0x02000813，输出函数为NULL。
+ * @par 依赖
+ * <ul><li>prt_hwi.h：该接口声明所在的头文件。</li></ul>
+ * @see PRT_HwiIrqsOffSiteGet
+ */
+extern U32 PRT_HwiIrqsOffDump(HwiIrqsOffPrintFunc print);
+#endif
+
 #ifdef __cplusplus
 #if __cplusplus
 }
@@ -15,6 +15,7 @@
 #ifndef PRT_MEM_H
 #define PRT_MEM_H
 
+#include "prt_buildef.h"
 #include "prt_module.h"
 #include "prt_errno.h"
 
@@ -132,6 +133,150 @@ extern "C" {
  */
 #define OS_ERRNO_FSCMEM_ALLOC_NO_MEMORY OS_ERRNO_BUILD_ERROR(OS_MID_MEM, 0x0c)
 
+/*
+ * 内存错误码：分区号非法。
+ *
+ * 值: 0x0200010d
+ *
+ * 解决方案：分区号范围[0,255)。
+ */
+#define OS_ERRNO_MEM_PTNO_INVALID OS_ERRNO_BUILD_ERROR(OS_MID_MEM, 0x0d)
+
+/*
+ * 内存错误码：创建分区时分区号已被使用。
+ *
+ * 值: 0x0200010e
+ *
+ * 解决方案：请使用未创建的分区号。
+ */
+#define OS_ERRNO_MEM_PT_ALREADY_CREATED OS_ERRNO_BUILD_ERROR(OS_MID_MEM, 0x0e)
+
+/*
+ * 内存错误码：创建分区时分区地址范围与已创建的分区重叠。
+ *
+ * 值: 0x0200010f
+ *
+ * 解决方案：请检查分区起始地址及大小。
+ */
+#define OS_ERRNO_MEM_PT_OVERLAP OS_ERRNO_BUILD_ERROR(OS_MID_MEM, 0x0f)
+
+/*
+ * 内存错误码：创建分区时指定的内存算法与编译选择的算法不一致。
+ *
+ * 值: 0x02000110
+ *
+ * 解决方案：FSC算法配置为#MEM_ARITH_FSC，打开OS_OPTION_MEM_TLSF时配置为#MEM_ARITH_TLSF。
+ */
+#define OS_ERRNO_MEM_PT_ARITH_INVALID OS_ERRNO_BUILD_ERROR(OS_MID_MEM, 0x10)
+
+/*
+ * 内存错误码：创建分区时入参为空指针。
+ *
+ * 值: 0x02000111
+ *
+ * 解决方案：请检查入参。
+ */
+#define OS_ERRNO_MEM_PTCREATE_PARA_NULL OS_ERRNO_BUILD_ERROR(OS_MID_MEM, 0x11)
+
+/*
+ * 内存错误码：从未创建的分区中申请内存。
+ *
+ * 值: 0x02000112
+ *
+ * 解决方案：请先调用PRT_MemPtCreate创建分区。
+ */
+#define OS_ERRNO_MEM_PT_NOT_CREATED OS_ERRNO_BUILD_ERROR(OS_MID_MEM, 0x12)
+
+/*
+ * 内存池错误码：创建内存池或获取内存池信息时入参为空指针。
+ *
+ * 值: 0x02000113
+ *
+ * 解决方案：请检查入参。
+ */
+#define OS_ERRNO_MEM_POOL_PARA_NULL OS_ERRNO_BUILD_ERROR(OS_MID_MEM, 0x13)
+
+/*
+ * 内存池错误码：创建内存池时块大小或块个数为0，或内存池总大小超出地址空间。
+ *
+ * 值: 0x02000114
+ *
+ * 解决方案：请检查块大小及块个数。
+ */
+#define OS_ERRNO_MEM_POOL_PARA_INVALID OS_ERRNO_BUILD_ERROR(OS_MID_MEM, 0x14)
+
+/*
+ * 内存池错误码：创建内存池时从分区申请内存失败。
+ *
+ * 值: 0x02000115
+ *
+ * 解决方案：增大分区大小或减少块个数。
+ */
+#define OS_ERRNO_MEM_POOL_NO_MEMORY OS_ERRNO_BUILD_ERROR(OS_MID_MEM, 0x15)
+
+/*
+ * 内存池错误码：内存池句柄非法或内存池已删除。
+ *
+ * 值: 0x02000116
+ *
+ * 解决方案：请使用PRT_MemPoolCreate返回的句柄。
+ */
+#define OS_ERRNO_MEM_POOL_HANDLE_INVALID OS_ERRNO_BUILD_ERROR(OS_MID_MEM, 0x16)
+
+/*
+ * 内存池错误码：释放的地址不是该内存池中的块首地址。
+ *
+ * 值: 0x02000117
+ *
+ * 解决方案：请检查释放的地址及内存池句柄。
+ */
+#define OS_ERRNO_MEM_POOL_ADDR_INVALID OS_ERRNO_BUILD_ERROR(OS_MID_MEM, 0x17)
+
+/*
+ * 内存池错误码：删除内存池时仍有块未释放。
+ *
+ * 值: 0x02000118
+ *
+ * 解决方案：释放所有块后再删除内存池。
+ */
+#define OS_ERRNO_MEM_POOL_BUSY OS_ERRNO_BUILD_ERROR(OS_MID_MEM, 0x18)
+
+/*
+ * 内存错误码：获取内存统计信息时入参为空指针。
+ *
+ * 值: 0x02000119
+ *
+ * 解决方案：请检查入参。
+ */
+#define OS_ERRNO_MEM_INFO_PTR_NULL OS_ERRNO_BUILD_ERROR(OS_MID_MEM, 0x19)
+
+/*
+ * 内存错误码：获取模块内存统计信息时模块号非法。
+ *
+ * 值: 0x0200011a
+ *
+ * 解决方案：模块号范围[0,#OS_MID_BUTT)。
+ */
+#define OS_ERRNO_MEM_MID_INVALID OS_ERRNO_BUILD_ERROR(OS_MID_MEM, 0x1a)
+
+/*
+ * 内存错误码：申请内存的标志非法。
+ *
+ * 值: 0x0200011b
+ *
+ * 解决方案：标志只能为OS_MEM_FLAG_CACHE_ALIGN、OS_MEM_FLAG_NONCACHE的组合。
+ */
+#define OS_ERRNO_MEM_ALLOC_FLAGS_INVALID OS_ERRNO_BUILD_ERROR(OS_MID_MEM, 0x1b)
+
+/*
+ * 内存错误码：分区属性非法，或按OS_MEM_FLAG_NONCACHE申请时分区不是非cache分区。
+ *
+ * 值: 0x0200011c
+ *
+ * 解决方案：分区属性范围[0,#MEM_PT_ATTR_BUTT)；OS_MEM_FLAG_NONCACHE只能用于以#MEM_PT_ATTR_NONCACHE创建的分区。
+ */
+#define OS_ERRNO_MEM_PT_ATTR_INVALID OS_ERRNO_BUILD_ERROR(OS_MID_MEM, 0x1c)
+
 /*
  * 系统缺省的内存分区数量。
  */
@@ -154,9 +299,89 @@ extern "C" {
  */
 enum MemArith {
     MEM_ARITH_FSC,          // 私有FSC算法
+    MEM_ARITH_TLSF,         // TLSF算法，申请和释放均为常数时间
     MEM_ARITH_BUTT          // 内存算法非法
 };
 
+/*
+ * 内存分区属性。
+ */
+enum MemPtAttr {
+    MEM_PT_ATTR_CACHEABLE,  // 可cache的内存
+    MEM_PT_ATTR_NONCACHE,   // MMU中映射为非cache的内存，与DMA及其他核共享时无需cache维护
+    MEM_PT_ATTR_BUTT        // 分区属性非法
+};
+
+/*
+ * 内存分区创建参数。
+ */
+struct MemPtCreate {
+    enum MemArith arith; /* 分区使用的内存算法，须与编译选择的算法一致 */
+    void *ptAddr;        /* 分区起始地址，4字节对齐 */
+    uintptr_t ptSize;    /* 分区大小，4字节对齐，包含分区控制块 */
+    enum MemPtAttr attr; /* 分区属性，只用于申请时校验，由用户保证与MMU映射一致 */
+};
+
+/*
+ * 按cache行对齐申请时使用的cache行大小，由OS_MEM_CACHE_LINE_SIZE配置，
+ * 须为2的幂且不小于CPU的数据cache行大小(armv8为CTR_EL0.DminLine指示的大小)。
+ */
+#if !defined(OS_MEM_CACHE_LINE_SIZE)
+#define OS_MEM_CACHE_LINE_SIZE 64U
+#endif
+
+/*
+ * 申请内存的标志。
+ * OS_MEM_FLAG_CACHE_ALIGN：起始地址按cache行对齐，大小补齐到cache行的整数倍，缓冲区独占所在的cache行。
+ * OS_MEM_FLAG_NONCACHE：从非cache分区申请，分区不是以#MEM_PT_ATTR_NONCACHE创建时申请失败。
+ */
+#define OS_MEM_FLAG_CACHE_ALIGN 0x1U
+#define OS_MEM_FLAG_NONCACHE 0x2U
+#define OS_MEM_FLAG_MASK (OS_MEM_FLAG_CACHE_ALIGN | OS_MEM_FLAG_NONCACHE)
+
+/*
+ * 空闲块按块大小最高有效位划分的级别个数。
+ */
+#define OS_MEM_FREE_CLASS_NUM ((U32)(sizeof(uintptr_t) * 8))
+
+/*
+ * 分区使用统计，大小均包含块控制头。
+ */
+struct MemPtInfo {
+    uintptr_t totalSize; /* 分区中算法管理的内存大小 */
+    uintptr_t usedSize;  /* 已分配块的总大小 */
+    uintptr_t peakSize;  /* usedSize的峰值 */
+    uintptr_t freeSize;  /* 空闲块的总大小 */
+    U32 allocCnt;        /* 已分配块数 */
+    U32 maxFreeClass;    /* 最大空闲块所在的级别，最大空闲块不小于2^maxFreeClass字节 */
+    U32 freeBlkNum[OS_MEM_FREE_CLASS_NUM]; /* freeBlkNum[k]为大小在[2^k, 2^(k+1))内的空闲块数 */
+};
+
+/*
+ * 模块内存使用统计，大小均包含块控制头。
+ */
+struct MemModInfo {
+    uintptr_t usedSize; /* 已分配块的总大小 */
+    uintptr_t peakSize; /* usedSize的峰值 */
+    U32 allocCnt;       /* 已分配块数 */
+};
+
+/*
+ * 定长内存池句柄。
+ */
+typedef uintptr_t MemPoolHandle;
+
+/*
+ * 定长内存池信息。
+ */
+struct MemPoolInfo {
+    U32 blkSize;  /* 块大小 */
+    U32 blkNum;   /* 块个数 */
+    U32 usedNum;  /* 当前已分配的块数 */
+    U32 peakNum;  /* 已分配块数的峰值，块个数减去该值即为空闲块的低水线 */
+    U32 failNum;  /* 池空导致的申请失败次数 */
+};
+
 /*
  * 内存对齐方式。
  */
@@ -177,6 +402,30 @@ enum MemAlign {
     MEM_ADDR_BUTT /* 字节对齐非法 */
 };
 
+/*
+ * @brief 创建内存分区。
+ *
+ * @par 描述
+ * <li>使用para指定的内存创建分区号为ptNo的分区，分区创建后可通过#PRT_MemAlloc指定分区号申请内存。</li>
+ * @attention
+ * <ul>
+ * <li>每个分区有独立的空闲链表及位图，不同分区的申请释放互不影响，可用于区分片上SRAM、DDR及非cache内存。</li>
+ * <li>分区控制块放在分区起始处，分区可用大小小于ptSize。</li>
+ * <li>分区号#OS_MEM_DEFAULT_FSC_PT为系统缺省分区，由系统初始化时创建。</li>
+ * <li>分区创建后不能删除。</li>
+ * </ul>
+ *
+ * @param para [IN]  类型#struct MemPtCreate *，分区创建参数。
+ * @param ptNo [IN]  类型#U8，分区号，范围[0,255)。
+ *
+ * @retval #OS_OK  0x00000000，分区创建成功。
+ * @retval #其它值，创建失败。
+ * @par 依赖
+ * <ul><li>prt_mem.h：该接口声明所在的头文件。</li></ul>
+ * @see PRT_MemAlloc
+ */
+extern U32 PRT_MemPtCreate(struct MemPtCreate *para, U8 ptNo);
+
 /*
  * @brief 向已创建的指定分区申请内存。
  *
@@ -191,8 +440,8 @@ enum MemAlign {
  * </ul>
  *
  * @param mid  [IN]  类型#U32，申请的模块号。
- * @param ptNo [IN]  类型#U8，分区号，范围[0,#OS_MEM_MAX_PT_NUM+2)。
- * @param size [IN]  类型#U32，申请的大小。
+ * @param ptNo [IN]  类型#U8，分区号，须为已创建的分区。
+ * @param size [IN]  类型#uintptr_t，申请的大小，64位平台可超过4G。
  *
  * @retval #NULL  0，申请失败。
  * @retval #!NULL 内存首地址值。
@@ -200,7 +449,7 @@ enum MemAlign {
  * <ul><li>prt_mem.h：该接口声明所在的头文件。</li></ul>
  * @see PRT_MemFree
  */
-extern void *PRT_MemAlloc(U32 mid, U8 ptNo, U32 size);
+extern void *PRT_MemAlloc(U32 mid, U8 ptNo, uintptr_t size);
 
 /*
  * @brief 向已创建的指定分区申请指定大小且指定对齐方式的内存块。
@@ -215,8 +464,8 @@ extern void *PRT_MemAlloc(U32 mid, U8 ptNo, U32 size);
  * </ul>
  *
  * @param mid      [IN]  类型#U32，申请的模块号。
- * @param ptNo     [IN]  类型#U8，分区号，范围[0,#OS_MEM_MAX_PT_NUM+2)。
- * @param size     [IN]  类型#U32，申请的大小。
+ * @param ptNo     [IN]  类型#U8，分区号，须为已创建的分区。
+ * @param size     [IN]  类型#uintptr_t，申请的大小，64位平台可超过4G。
  * @param alignPow [IN]  类型#enum MemAlign，动态对齐。
  *
  * @retval #NULL  0，申请失败。
@@ -225,7 +474,7 @@ extern void *PRT_MemAlloc(U32 mid, U8 ptNo, U32 size);
  * <ul><li>prt_mem.h：该接口声明所在的头文件。</li></ul>
  * @see PRT_MemFree
  */
-extern void *PRT_MemAllocAlign(U32 mid, U8 ptNo, U32 size, enum MemAlign alignPow);
+extern void *PRT_MemAllocAlign(U32 mid, U8 ptNo, uintptr_t size, enum MemAlign alignPow);
 
 /*
  * @brief 释放申请的内存。
@@ -250,6 +499,225 @@ extern void *PRT_MemAllocAlign(U32 mid, U8 ptNo, U32 size, enum MemAlign alignPo
  */
 extern U32 PRT_MemFree(U32 mid, void *addr);
 
+/*
+ * @brief 申请内存并清零。
+ *
+ * @par 描述
+ * 在分区号为ptNo的分区中申请大小为size的内存，并将申请到的内存清零。
+ * @attention
+ * <ul>
+ * <li>FSC算法在分区初始化时清零整个分区，从未分配过的内存不再重复清零。</li>
+ * <li>清零在关中断之外进行。</li>
+ * </ul>
+ *
+ * @param mid  [IN]  类型#U32，申请的模块号。
+ * @param ptNo [IN]  类型#U8，分区号。
+ * @param size [IN]  类型#uintptr_t，申请的大小。
+ *
+ * @retval #NULL  申请失败。
+ * @retval #!NULL 内存首地址值。
+ * @par 依赖
+ * <ul><li>prt_mem.h：该接口声明所在的头文件。</li></ul>
+ * @see PRT_MemAlloc
+ */
+extern void *PRT_MemAllocZero(U32 mid, U8 ptNo, uintptr_t size);
+
+/*
+ * @brief 按标志申请用于DMA或多核共享的内存。
+ *
+ * @par 描述
+ * 在分区号为ptNo的分区中申请大小为size的内存，flags为OS_MEM_FLAG_*的组合。
+ * @attention
+ * <ul>
+ * <li>OS_MEM_FLAG_CACHE_ALIGN申请的缓冲区不与其他内存块共享cache行，可直接对整个缓冲区调用
+ * PRT_DCacheFlush/PRT_DCacheInv，不会影响相邻数据。</li>
+ * <li>非cache分区中的内存无需cache维护，可与DMA零拷贝共享。</li>
+ * <li>用PRT_MemFree释放，PRT_MemRealloc重新申请时不保持cache行对齐。</li>
+ * </ul>
+ *
+ * @param mid   [IN]  类型#U32，申请的模块号。
+ * @param ptNo  [IN]  类型#U8，分区号。
+ * @param size  [IN]  类型#uintptr_t，申请的大小。
+ * @param flags [IN]  类型#U32，申请标志。
+ *
+ * @retval #NULL  申请失败。
+ * @retval #!NULL 内存首地址值。
+ * @par 依赖
+ * <ul><li>prt_mem.h：该接口声明所在的头文件。</li></ul>
+ * @see PRT_MemFree
+ */
+extern void *PRT_MemAllocFlags(U32 mid, U8 ptNo, uintptr_t size, U32 flags);
+
+/*
+ * @brief 调整已申请内存的大小。
+ *
+ * @par 描述
+ * 后一相邻块空闲且空间足够或缩小时原地调整，返回原地址；否则在addr所属分区中重新申请，
+ * 拷贝原有数据后释放原内存。
+ * @attention
+ * <ul>
+ * <li>返回NULL时原内存不变，仍需由调用者释放。</li>
+ * <li>重新申请时按缺省对齐，PRT_MemAllocAlign申请的内存调整后可能不再满足原对齐要求。</li>
+ * </ul>
+ *
+ * @param mid  [IN]  类型#U32，申请的模块号。
+ * @param addr [IN]  类型#void *，已申请内存的首地址。
+ * @param size [IN]  类型#uintptr_t，新的大小，不能为0。
+ *
+ * @retval #NULL  调整失败。
+ * @retval #!NULL 调整后的内存首地址值。
+ * @par 依赖
+ * <ul><li>prt_mem.h：该接口声明所在的头文件。</li></ul>
+ * @see PRT_MemAlloc | PRT_MemFree
+ */
+extern void *PRT_MemRealloc(U32 mid, void *addr, uintptr_t size);
+
+/*
+ * @brief 获取分区的内存使用统计。
+ *
+ * @par 描述
+ * <li>获取分区的已分配大小及峰值、空闲大小，以及按大小级别统计的空闲块个数。</li>
+ * @attention
+ * <ul>
+ * <li>空闲块统计在申请释放时增量更新，获取时只复制各级别的计数，耗时与空闲块个数无关。</li>
+ * <li>空闲大小远大于最大空闲块时说明碎片严重。</li>
+ * </ul>
+ *
+ * @param ptNo [IN]  类型#U8，分区号。
+ * @param info [OUT] 类型#struct MemPtInfo *，分区使用统计。
+ *
+ * @retval #OS_OK  0x00000000，获取成功。
+ * @retval #其它值，获取失败。
+ * @par 依赖
+ * <ul><li>prt_mem.h：该接口声明所在的头文件。</li></ul>
+ * @see PRT_MemGetModInfo
+ */
+extern U32 PRT_MemPtGetInfo(U8 ptNo, struct MemPtInfo *info);
+
+/*
+ * @brief 获取模块的内存使用统计。
+ *
+ * @par 描述
+ * <li>获取模块号为mid的模块在所有分区中已分配的内存大小、峰值及块数。</li>
+ * @attention
+ * <ul>
+ * <li>按申请时传入的模块号统计，模块号不小于#OS_MID_BUTT的申请统计到#OS_MID_APP。</li>
+ * </ul>
+ *
+ * @param mid  [IN]  类型#U32，模块号。
+ * @param info [OUT] 类型#struct MemModInfo *，模块内存使用统计。
+ *
+ * @retval #OS_OK  0x00000000，获取成功。
+ * @retval #其它值，获取失败。
+ * @par 依赖
+ * <ul><li>prt_mem.h：该接口声明所在的头文件。</li></ul>
+ * @see PRT_MemPtGetInfo
+ */
+extern U32 PRT_MemGetModInfo(U32 mid, struct MemModInfo *info);
+
+/*
+ * @brief 创建定长内存池。
+ *
+ * @par 描述
+ * <li>从分区ptNo中申请blkNum个大小为blkSize的内存块组成内存池。</li>
+ * @attention
+ * <ul>
+ * <li>内存池中的块没有块控制头及越界检查魔术字，块地址按#OS_MEM_ADDR_ALIGN对齐。</li>
+ * <li>块大小小于指针大小时按指针大小分配。</li>
+ * </ul>
+ *
+ * @param ptNo       [IN]  类型#U8，内存池所在的分区号。
+ * @param blkSize    [IN]  类型#U32，块大小。
+ * @param blkNum     [IN]  类型#U32，块个数。
+ * @param poolHandle [OUT] 类型#MemPoolHandle *，内存池句柄。
+ *
+ * @retval #OS_OK  0x00000000，创建成功。
+ * @retval #其它值，创建失败。
+ * @par 依赖
+ * <ul><li>prt_mem.h：该接口声明所在的头文件。</li></ul>
+ * @see PRT_MemPoolDelete
+ */
+extern U32 PRT_MemPoolCreate(U8 ptNo, U32 blkSize, U32 blkNum, MemPoolHandle *poolHandle);
+
+/*
+ * @brief 删除定长内存池。
+ *
+ * @par 描述
+ * <li>删除内存池，内存池占用的内存归还到所在分区。</li>
+ * @attention
+ * <ul>
+ * <li>内存池中所有块释放后才能删除。</li>
+ * <li>删除过程中不能有其他任务或中断访问该内存池。</li>
+ * </ul>
+ *
+ * @param poolHandle [IN]  类型#MemPoolHandle，内存池句柄。
+ *
+ * @retval #OS_OK  0x00000000，删除成功。
+ * @retval #其它值，删除失败。
+ * @par 依赖
+ * <ul><li>prt_mem.h：该接口声明所在的头文件。</li></ul>
+ * @see PRT_MemPoolCreate
+ */
+extern U32 PRT_MemPoolDelete(MemPoolHandle poolHandle);
+
+/*
+ * @brief 从定长内存池申请一个块。
+ *
+ * @par 描述
+ * <li>从内存池的空闲链表头取出一个块，使用独占访问指令无锁实现，申请时间为常数，可在中断中调用。</li>
+ * @attention
+ * <ul>
+ * <li>内存池为空时返回NULL，不记录错误，失败次数可通过#PRT_MemPoolGetInfo查询。</li>
+ * </ul>
+ *
+ * @param poolHandle [IN]  类型#MemPoolHandle，内存池句柄。
+ *
+ * @retval #NULL  0，申请失败。
+ * @retval #!NULL 块首地址。
+ * @par 依赖
+ * <ul><li>prt_mem.h：该接口声明所在的头文件。</li></ul>
+ * @see PRT_MemPoolFree
+ */
+extern void *PRT_MemPoolAlloc(MemPoolHandle poolHandle);
+
+/*
+ * @brief 释放定长内存池的块。
+ *
+ * @par 描述
+ * <li>将块放回内存池的空闲链表头，使用独占访问指令无锁实现，释放时间为常数，可在中断中调用。</li>
+ * @attention
+ * <ul>
+ * <li>只校验地址是否为该内存池的块首地址，不能检测重复释放。</li>
+ * </ul>
+ *
+ * @param poolHandle [IN]  类型#MemPoolHandle，内存池句柄。
+ * @param addr       [IN]  类型#void *，块首地址。
+ *
+ * @retval #OS_OK  0x00000000，释放成功。
+ * @retval #其它值，释放失败。
+ * @par 依赖
+ * <ul><li>prt_mem.h：该接口声明所在的头文件。</li></ul>
+ * @see PRT_MemPoolAlloc
+ */
+extern U32 PRT_MemPoolFree(MemPoolHandle poolHandle, void *addr);
+
+/*
+ * @brief 获取定长内存池的使用信息。
+ *
+ * @par 描述
+ * <li>获取内存池的块大小、块个数、已分配块数、峰值及申请失败次数。</li>
+ *
+ * @param poolHandle [IN]  类型#MemPoolHandle，内存池句柄。
+ * @param info       [OUT] 类型#struct MemPoolInfo *，内存池信息。
+ *
+ * @retval #OS_OK  0x00000000，获取成功。
+ * @retval #其它值，获取失败。
+ * @par 依赖
+ * <ul><li>prt_mem.h：该接口声明所在的头文件。</li></ul>
+ * @see PRT_MemPoolCreate
+ */
+extern U32 PRT_MemPoolGetInfo(MemPoolHandle poolHandle, struct MemPoolInfo *info);
+
 #ifdef __cplusplus
 #if __cplusplus
 }
@@ -195,6 +195,34 @@ extern "C" {
  */
 #define OS_ERRNO_QUEUE_NSIZE_INVALID OS_ERRNO_BUILD_ERROR(OS_MID_QUEUE, 0x13)
 
+/*
+ * 队列错误码：变长消息队列缓冲区大小非法
+ *
+ * 值: 0x02000c14
+ *
+ * 解决方案: 缓冲区大小需能容纳一条最大长度的消息(消息长度加4字节记录头)，且不能大于OS_QUEUE_VARLEN_BUF_MAX；
+ * 字节流缓冲区大小需为2的幂，且不能大于OS_QUEUE_VARLEN_BUF_MAX
+ */
+#define OS_ERRNO_QUEUE_BUF_SIZE_INVALID OS_ERRNO_BUILD_ERROR(OS_MID_QUEUE, 0x14)
+
+/*
+ * 队列错误码：队列类型与操作接口不匹配
+ *
+ * 值: 0x02000c15
+ *
+ * 解决方案: 字节流缓冲区只能使用PRT_QueueStream*接口读写，其他队列不能使用字节流接口
+ */
+#define OS_ERRNO_QUEUE_ATTR_INVALID OS_ERRNO_BUILD_ERROR(OS_MID_QUEUE, 0x15)
+
+/*
+ * 队列错误码：字节流缓冲区触发水位非法
+ *
+ * 值: 0x02000c16
+ *
+ * 解决方案: 触发水位不能为0，且不能大于缓冲区大小
+ */
+#define OS_ERRNO_QUEUE_TRIGGER_INVALID OS_ERRNO_BUILD_ERROR(OS_MID_QUEUE, 0x16)
+
 /*
  * 队列优先级类型
  */
@@ -219,6 +247,11 @@ enum QueuePrio {
  */
 #define OS_QUEUE_PID_ALL 0xFFFFFFFF
 
+/*
+ * 变长消息队列缓冲区的最大字节数。
+ */
+#define OS_QUEUE_VARLEN_BUF_MAX 0x40000U
+
 /*
  * @brief 创建队列。
  *
@@ -242,6 +275,146 @@ enum QueuePrio {
  */
 extern U32 PRT_QueueCreate(U16 nodeNum, U16 maxNodeSize, U32 *queueId);
 
+/*
+ * @brief 创建覆盖写队列。
+ *
+ * @par 描述
+ * 创建一个覆盖写队列，队列满时写操作丢弃最早的一条消息并写入新消息，队列中始终保留最新的nodeNum条消息。
+ * @attention
+ * <ul>
+ * <li>创建后使用#PRT_QueueRead、#PRT_QueueWrite读写，读操作的阻塞及超时语义与普通队列一致。</li>
+ * <li>写操作不阻塞，队列满时原地覆盖，不唤醒任务也不触发调度，timeOut参数不生效。</li>
+ * <li>队列满时写入紧急消息会替换最早的消息并位于队列头。</li>
+ * <li>nodeNum为1时可作为只保留最新值的邮箱使用。</li>
+ * <li>被覆盖的消息个数可通过#PRT_QueueGetOverwriteCnt获取。</li>
+ * </ul>
+ * @param nodeNum     [IN]  类型#U16，队列节点个数，不能为0。
+ * @param maxNodeSize [IN]  类型#U16，每个队列结点的大小。
+ * @param queueId     [OUT] 类型#U32 *，存储队列ID，ID从1开始。
+ *
+ * @retval #OS_OK  0x00000000，操作成功。
+ * @retval #其它值，操作失败。
+ * @par 依赖
+ * @li prt_queue.h：该接口声明所在的头文件。
+ * @see PRT_QueueCreate | PRT_QueueGetOverwriteCnt
+ */
+extern U32 PRT_QueueCreateOverwrite(U16 nodeNum, U16 maxNodeSize, U32 *queueId);
+
+/*
+ * @brief 创建变长消息队列。
+ *
+ * @par 描述
+ * 创建一个变长消息队列，消息按实际长度存放在bufSize字节的环形缓冲区中，不按最大消息长度预留节点。
+ * @attention
+ * <ul>
+ * <li>创建后使用#PRT_QueueRead、#PRT_QueueWrite读写，阻塞及超时语义与普通队列一致。</li>
+ * <li>每条消息额外占用4字节记录头，缓冲区剩余空间不足时写操作按timeOut阻塞。</li>
+ * <li>bufSize需不小于maxNodeSize加4字节，且不能大于#OS_QUEUE_VARLEN_BUF_MAX。</li>
+ * <li>适用于消息长度差异较大的场景，可避免每个节点按最大消息长度分配造成的内存浪费。</li>
+ * </ul>
+ * @param bufSize     [IN]  类型#U32，环形缓冲区大小，单位BYTE。
+ * @param maxNodeSize [IN]  类型#U16，单条消息的最大长度，单位BYTE，不能大于0xFFFA。
+ * @param queueId     [OUT] 类型#U32 *，存储队列ID，ID从1开始。
+ *
+ * @retval #OS_OK  0x00000000，操作成功。
+ * @retval #其它值，操作失败。
+ * @par 依赖
+ * @li prt_queue.h：该接口声明所在的头文件。
+ * @see PRT_QueueCreate | PRT_QueueDelete
+ */
+extern U32 PRT_QueueCreateVarLen(U32 bufSize, U16 maxNodeSize, U32 *queueId);
+
+/*
+ * @brief 创建字节流缓冲区。
+ *
+ * @par 描述
+ * 创建一个单生产者单消费者的字节流缓冲区，用于中断向任务批量传递字节数据，不保留消息边界。
+ * @attention
+ * <ul>
+ * <li>只能使用#PRT_QueueStreamWrite、#PRT_QueueStreamRead读写，使用#PRT_QueueDelete删除。</li>
+ * <li>同一时刻只允许一个写者和一个读任务，多个写者需由用户自行互斥。</li>
+ * <li>bufSize需为2的幂，且不能大于#OS_QUEUE_VARLEN_BUF_MAX。</li>
+ * <li>triggerLevel为触发水位，读任务阻塞时缓冲区数据达到该字节数才被唤醒，取值范围[1, bufSize]。</li>
+ * </ul>
+ * @param bufSize      [IN]  类型#U32，环形缓冲区大小，单位BYTE。
+ * @param triggerLevel [IN]  类型#U32，触发水位，单位BYTE。
+ * @param queueId      [OUT] 类型#U32 *，存储队列ID，ID从1开始。
+ *
+ * @retval #OS_OK  0x00000000，操作成功。
+ * @retval #其它值，操作失败。
+ * @par 依赖
+ * @li prt_queue.h：该接口声明所在的头文件。
+ * @see PRT_QueueStreamWrite | PRT_QueueStreamRead | PRT_QueueDelete
+ */
+extern U32 PRT_QueueCreateStream(U32 bufSize, U32 triggerLevel, U32 *queueId);
+
+/*
+ * @brief 写字节流缓冲区。
+ *
+ * @par 描述
+ * 将bufferAddr地址中最多bufferSize字节的数据写入字节流缓冲区，*written输出实际写入的字节数。
+ * @attention
+ * <ul>
+ * <li>接口不阻塞，缓冲区空闲空间不足时只写入能容纳的部分，可在中断中调用。</li>
+ * <li>写数据路径不关中断，仅在读任务阻塞且数据达到其等待字节数时短暂关中断唤醒读任务。</li>
+ * </ul>
+ * @param queueId    [IN]  类型#U32，队列ID。
+ * @param bufferAddr [IN]  类型#const void *，待写入数据的起始地址。
+ * @param bufferSize [IN]  类型#U32，待写入数据的大小，单位BYTE。
+ * @param written    [OUT] 类型#U32 *，实际写入的字节数。
+ *
+ * @retval #OS_OK  0x00000000，操作成功。
+ * @retval #其它值，操作失败。
+ * @par 依赖
+ * @li prt_queue.h：该接口声明所在的头文件。
+ * @see PRT_QueueStreamRead
+ */
+extern U32 PRT_QueueStreamWrite(U32 queueId, const void *bufferAddr, U32 bufferSize, U32 *written);
+
+/*
+ * @brief 读字节流缓冲区。
+ *
+ * @par 描述
+ * 从字节流缓冲区读取最多*len字节的数据，*len输出实际读取的字节数。
+ * @attention
+ * <ul>
+ * <li>缓冲区数据不足触发水位(读缓冲区更小时为读缓冲区大小)时按timeOut阻塞。</li>
+ * <li>被唤醒或超时后缓冲区中有数据即返回成功，并读出已有的数据；仍无数据时返回超时或无资源错误码。</li>
+ * <li>只允许一个任务读，阻塞模式不能在中断中使用。</li>
+ * </ul>
+ * @param queueId    [IN]  类型#U32，队列ID。
+ * @param bufferAddr [OUT] 类型#void *，存放读出数据的起始地址。
+ * @param len        [I/O] 类型#U32 *，传入BUF的大小，输出实际读取的字节数。
+ * @param timeOut    [IN]  类型#U32，超时时间。
+ *
+ * @retval #OS_OK  0x00000000，操作成功。
+ * @retval #其它值，操作失败。
+ * @par 依赖
+ * @li prt_queue.h：该接口声明所在的头文件。
+ * @see PRT_QueueStreamWrite
+ */
+extern U32 PRT_QueueStreamRead(U32 queueId, void *bufferAddr, U32 *len, U32 timeOut);
+
+/*
+ * @brief 设置字节流缓冲区的触发水位。
+ *
+ * @par 描述
+ * 修改字节流缓冲区的触发水位，对之后的读操作生效。
+ * @attention
+ * <ul>
+ * <li>triggerLevel取值范围[1, bufSize]。</li>
+ * </ul>
+ * @param queueId      [IN]  类型#U32，队列ID。
+ * @param triggerLevel [IN]  类型#U32，触发水位，单位BYTE。
+ *
+ * @retval #OS_OK  0x00000000，操作成功。
+ * @retval #其它值，操作失败。
+ * @par 依赖
+ * @li prt_queue.h：该接口声明所在的头文件。
+ * @see PRT_QueueCreateStream
+ */
+extern U32 PRT_QueueStreamTriggerSet(U32 queueId, U32 triggerLevel);
+
 /*
  * @brief 读队列。
  *
@@ -338,6 +511,28 @@ extern U32 PRT_QueueDelete(U32 queueId);
  */
 extern U32 PRT_QueueGetUsedPeak(U32 queueId, U32 *queueUsedNum);
 
+/*
+ * @brief 获取覆盖写队列被覆盖的消息个数。
+ *
+ * @par 描述
+ * 获取从队列创建到删除前，队列满时被新消息覆盖丢弃的消息个数。
+ * @attention
+ * <ul>
+ * <li>计数在队列删除前不会被清零，达到0xFFFFFFFF后不再增加。</li>
+ * <li>非覆盖写队列的计数始终为0。</li>
+ * </ul>
+ * @param queueId      [IN]  类型#U32，队列ID
+ * @param overwriteCnt [OUT] 类型#U32 *，被覆盖的消息个数
+ *
+ * @retval #OS_OK  0x00000000，操作成功。
+ * @retval #其它值，操作失败。
+ *
+ * @par 依赖
+ * @li prt_queue.h：该接口声明所在的头文件。
+ * @see PRT_QueueCreateOverwrite | PRT_QueueGetUsedPeak
+ */
+extern U32 PRT_QueueGetOverwriteCnt(U32 queueId, U32 *overwriteCnt);
+
 /*
  * @brief 获取指定源PID的待处理消息个数。
  *
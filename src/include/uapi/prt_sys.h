@@ -80,6 +80,15 @@ extern "C" {
  */
 #define OS_ERRNO_SYS_HWI_MAX_NUM_CONFIG_INVALID OS_ERRNO_BUILD_ERROR(OS_MID_HWI, 0x06)
 
+/*
+ * 系统基本功能错误码：获取启动耗时时传入的启动阶段或模块号非法
+ *
+ * 值: 0x02000007
+ *
+ * 解决方案: 启动阶段范围[0,#OS_SYS_BOOT_BUTT)，模块号范围[0,#OS_MID_BUTT)。
+ */
+#define OS_ERRNO_SYS_BOOT_PARA_INVALID OS_ERRNO_BUILD_ERROR(OS_MID_SYS, 0x07)
+
 /*
  * 系统初始化阶段状态
  */
@@ -168,6 +177,18 @@ enum SysThreadType {
     SYS_BUTT
 };
 
+/*
+ * 系统启动阶段枚举结构定义
+ *
+ * 启动耗时统计记录各阶段结束时的cycle数，cycle由系统时间钩子获取，OS_MID_SYS注册之前的阶段不记录。
+ */
+enum SysBootPhase {
+    OS_SYS_BOOT_REGISTER,    /* OS模块注册完成 */
+    OS_SYS_BOOT_INITIALIZE,  /* OS模块初始化完成，包括PRT_AppInit */
+    OS_SYS_BOOT_START,       /* 进入OS启动阶段，tick启动及首次调度之前 */
+    OS_SYS_BOOT_BUTT
+};
+
 /*
  * @brief 计算系统绝对时间钩子函数的类型定义。
  *
@@ -266,6 +287,53 @@ extern U32 PRT_SysSetRndNum(enum SysRndNumType type, U32 rndNum);
  */
 extern void PRT_SysReboot(void);
 
+/*
+ * @brief 获取系统启动阶段结束时的cycle数。
+ *
+ * @par 描述
+ * 获取系统启动过程中phase阶段结束时的cycle数，用于分析启动耗时。
+ *
+ * @attention
+ * <ul>
+ * <li>cycle数由系统时间钩子获取，为从计数器清零时刻开始的绝对值。</li>
+ * <li>尚未到达的阶段获取到的值为0。</li>
+ * </ul>
+ *
+ * @param phase [IN]  类型#enum SysBootPhase，启动阶段。
+ * @param cycle [OUT] 类型#U64 *，该阶段结束时的cycle数。
+ *
+ * @retval #OS_OK  0x00000000，操作成功。
+ * @retval #OS_ERRNO_SYS_PTR_NULL  0x02000001，指针参数为NULL。
+ * @retval #OS_ERRNO_SYS_BOOT_PARA_INVALID  0x02000007，启动阶段非法。
+ * @par 依赖
+ * <ul><li>prt_sys.h：该接口声明所在的头文件。</li></ul>
+ * @see PRT_SysGetModInitCycle
+ */
+extern U32 PRT_SysGetBootCycle(enum SysBootPhase phase, U64 *cycle);
+
+/*
+ * @brief 获取OS模块初始化耗费的cycle数。
+ *
+ * @par 描述
+ * 获取系统初始化阶段模块mid的初始化函数耗费的cycle数，用于定位启动耗时集中的模块。
+ *
+ * @attention
+ * <ul>
+ * <li>未配置或没有初始化函数的模块获取到的值为0。</li>
+ * </ul>
+ *
+ * @param mid   [IN]  类型#U32，模块号，取值范围[0,#OS_MID_BUTT)。
+ * @param cycle [OUT] 类型#U64 *，模块初始化耗费的cycle数。
+ *
+ * @retval #OS_OK  0x00000000，操作成功。
+ * @retval #OS_ERRNO_SYS_PTR_NULL  0x02000001，指针参数为NULL。
+ * @retval #OS_ERRNO_SYS_BOOT_PARA_INVALID  0x02000007，模块号非法。
+ * @par 依赖
+ * <ul><li>prt_sys.h：该接口声明所在的头文件。</li></ul>
+ * @see PRT_SysGetBootCycle
+ */
+extern U32 PRT_SysGetModInitCycle(U32 mid, U64 *cycle);
+
 /*
  * @brief 获取当前核ID。
  *
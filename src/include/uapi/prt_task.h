@@ -787,6 +787,24 @@ extern "C" {
  */
 #define OS_ERRNO_TSK_STACKADDR_TOO_BIG OS_ERRNO_BUILD_ERROR(OS_MID_TSK, 0x1b)
 
+/*
+ * 任务错误码：周期任务调用#PRT_TaskDelayUntil时下一次释放时间已过，任务未延时直接返回。
+ *
+ * 值: 0x0200031c
+ *
+ * 解决方案: 缩短任务每个周期的执行时间，或增大任务周期。
+ */
+#define OS_ERRNO_TSK_PERIOD_MISSED OS_ERRNO_BUILD_ERROR(OS_MID_TSK, 0x1c)
+
+/*
+ * 任务错误码：周期任务的周期为0。
+ *
+ * 值: 0x0200031d
+ *
+ * 解决方案: 周期任务的周期必须大于0。
+ */
+#define OS_ERRNO_TSK_PERIOD_INVALID OS_ERRNO_BUILD_ERROR(OS_MID_TSK, 0x1d)
+
 /*
  * 任务ID的类型定义。
  */
@@ -1098,6 +1116,210 @@ extern U32 PRT_TaskDelete(TskHandle taskPid);
  */
 extern U32 PRT_TaskDelay(U32 tick);
 
+/*
+ * @brief 按容差延迟正在运行的任务。
+ *
+ * @par 描述
+ * 延迟当前运行任务的执行，任务在延时tick个Tick之后、tick + slack个Tick之内重新参与调度。
+ *
+ * @attention
+ * <ul>
+ * <li>同#PRT_TaskDelay。</li>
+ * <li>OS在容差窗口内选取低位0最多的Tick作为到期Tick，窗口重叠的延时及软件定时器对齐到同一个Tick，
+ * 减少Tick中断中的唤醒处理次数。slack为0时与#PRT_TaskDelay相同。</li>
+ * <li>对齐及节省的唤醒次数计入#PRT_SwTmrSlackStatGet的统计。</li>
+ * </ul>
+ *
+ * @param tick  [IN]  类型#U32，延迟的Tick数。
+ * @param slack [IN]  类型#U32，允许额外延后的Tick数，单位与软件定时器的容差相同。
+ *
+ * @retval #OS_OK  0x00000000，任务延时成功。
+ * @retval #其它值，延时任务失败。
+ * @par 依赖
+ * <ul><li>prt_task.h：该接口声明所在的头文件。</li></ul>
+ * @see PRT_TaskDelay
+ */
+extern U32 PRT_TaskDelaySlack(U32 tick, U32 slack);
+
+/*
+ * @brief 延迟正在运行的任务到绝对时间点。
+ *
+ * @par 描述
+ * 任务延时到*prevWakeTick + period对应的Tick后重新参与调度，并将*prevWakeTick更新为该Tick。
+ * 释放时间只由上一次释放时间和周期决定，与本接口的调用时刻无关，周期任务不会累积漂移。
+ *
+ * @attention
+ * <ul>
+ * <li>同#PRT_TaskDelay。</li>
+ * <li>首次调用前*prevWakeTick应初始化为当前Tick数，可通过#PRT_TickGetCount获取。</li>
+ * <li>下一次释放时间已过时不延时，返回#OS_ERRNO_TSK_PERIOD_MISSED，*prevWakeTick仍按周期推进，后续周期会追赶错过的释放点。</li>
+ * <li>打开OS_OPTION_TASK_PERIOD_STAT时记录任务的释放抖动及截止期错失次数，可通过#PRT_TaskPeriodStatGet查询。</li>
+ * </ul>
+ *
+ * @param prevWakeTick [IN/OUT] 类型#U64 *，上一次释放的Tick数，返回时更新为本次释放的Tick数。
+ * @param period       [IN]     类型#U32，任务周期，单位Tick。
+ *
+ * @retval #OS_OK  0x00000000，任务延时成功。
+ * @retval #OS_ERRNO_TSK_PERIOD_MISSED  0x0200031c，下一次释放时间已过。
+ * @retval #其它值，延时任务失败。
+ * @par 依赖
+ * <ul><li>prt_task.h：该接口声明所在的头文件。</li></ul>
+ * @see PRT_TaskDelay | PRT_TaskPeriodRun
+ */
+extern U32 PRT_TaskDelayUntil(U64 *prevWakeTick, U32 period);
+
+/*
+ * 周期任务处理函数类型定义，返回FALSE时结束周期执行。
+ */
+typedef bool (*TskPeriodFunc)(uintptr_t param);
+
+/*
+ * @brief 在当前任务中周期执行处理函数。
+ *
+ * @par 描述
+ * 以调用时刻为起点，每隔period个Tick调用一次func，直到func返回FALSE。
+ *
+ * @attention
+ * <ul>
+ * <li>同#PRT_TaskDelayUntil。</li>
+ * <li>截止期错失不会结束周期执行，错失次数通过#PRT_TaskPeriodStatGet查询。</li>
+ * </ul>
+ *
+ * @param period [IN]  类型#U32，任务周期，单位Tick。
+ * @param func   [IN]  类型#TskPeriodFunc，周期处理函数。
+ * @param param  [IN]  类型#uintptr_t，传给周期处理函数的参数。
+ *
+ * @retval #OS_OK  0x00000000，处理函数返回FALSE，周期执行正常结束。
+ * @retval #其它值，周期执行失败。
+ * @par 依赖
+ * <ul><li>prt_task.h：该接口声明所在的头文件。</li></ul>
+ * @see PRT_TaskDelayUntil
+ */
+extern U32 PRT_TaskPeriodRun(U32 period, TskPeriodFunc func, uintptr_t param);
+
+#if defined(OS_OPTION_TASK_PERIOD_STAT)
+/*
+ * 释放抖动直方图的区间个数，第0个区间为[0, 1)us，第i个区间为[2^(i-1), 2^i)us，最后一个区间不设上限。
+ */
+#define OS_TSK_JITTER_HIST_NUM 16
+
+/*
+ * 周期任务释放抖动统计信息的结构体定义。
+ */
+struct TskPeriodStat {
+    /* 释放次数 */
+    U32 releaseCount;
+    /* 截止期错失次数 */
+    U32 missCount;
+    /* 最小释放抖动，单位us */
+    U32 minJitter;
+    /* 最大释放抖动，单位us */
+    U32 maxJitter;
+    /* 释放抖动直方图 */
+    U32 hist[OS_TSK_JITTER_HIST_NUM];
+};
+
+/*
+ * @brief 获取周期任务的释放抖动统计信息。
+ *
+ * @par 描述
+ * 获取任务通过#PRT_TaskDelayUntil释放的次数、截止期错失次数及释放抖动的最小值、最大值和直方图。
+ * 释放抖动为任务应释放的Tick中断到任务实际恢复运行的时间。
+ *
+ * @attention
+ * <ul>
+ * <li>截止期错失时释放抖动包含错过的Tick数。</li>
+ * </ul>
+ *
+ * @param taskPid [IN]  类型#TskHandle，任务PID。
+ * @param stat    [OUT] 类型#struct TskPeriodStat *，存放统计信息的结构体指针。
+ *
+ * @retval #OS_OK  0x00000000，获取统计信息成功。
+ * @retval #其它值，获取失败。
+ * @par 依赖
+ * <ul><li>prt_task.h：该接口声明所在的头文件。</li></ul>
+ * @see PRT_TaskPeriodStatClear
+ */
+extern U32 PRT_TaskPeriodStatGet(TskHandle taskPid, struct TskPeriodStat *stat);
+
+/*
+ * @brief 清除周期任务的释放抖动统计信息。
+ *
+ * @par 描述
+ * 清除任务的释放抖动统计信息，重新开始统计。
+ *
+ * @attention 无
+ *
+ * @param taskPid [IN]  类型#TskHandle，任务PID。
+ *
+ * @retval #OS_OK  0x00000000，清除统计信息成功。
+ * @retval #其它值，清除失败。
+ * @par 依赖
+ * <ul><li>prt_task.h：该接口声明所在的头文件。</li></ul>
+ * @see PRT_TaskPeriodStatGet
+ */
+extern U32 PRT_TaskPeriodStatClear(TskHandle taskPid);
+#endif
+
+#if defined(OS_OPTION_TASK_WAKEUP_STAT)
+/*
+ * 唤醒时延直方图的区间个数，第0个区间为[0, 1)us，第i个区间为[2^(i-1), 2^i)us，最后一个区间不设上限。
+ */
+#define OS_TSK_WAKEUP_HIST_NUM 16
+
+/*
+ * 任务唤醒时延统计信息的结构体定义。
+ */
+struct TskWakeupStat {
+    /* 唤醒后被调度运行的次数 */
+    U32 wakeupCount;
+    /* 最大唤醒时延，单位us */
+    U32 maxLatency;
+    /* 唤醒时延直方图 */
+    U32 hist[OS_TSK_WAKEUP_HIST_NUM];
+};
+
+/*
+ * @brief 获取任务的唤醒时延统计信息。
+ *
+ * @par 描述
+ * 获取任务从进入就绪态(信号量、队列、事件唤醒、延时或超时到期、恢复等)到被调度运行的时延的最大值和直方图。
+ *
+ * @attention
+ * <ul>
+ * <li>任务被抢占后重新运行不计入统计，只统计从阻塞、挂起或新创建进入就绪态后的首次运行。</li>
+ * </ul>
+ *
+ * @param taskPid [IN]  类型#TskHandle，任务PID。
+ * @param stat    [OUT] 类型#struct TskWakeupStat *，存放统计信息的结构体指针。
+ *
+ * @retval #OS_OK  0x00000000，获取统计信息成功。
+ * @retval #其它值，获取失败。
+ * @par 依赖
+ * <ul><li>prt_task.h：该接口声明所在的头文件。</li></ul>
+ * @see PRT_TaskWakeupStatClear
+ */
+extern U32 PRT_TaskWakeupStatGet(TskHandle taskPid, struct TskWakeupStat *stat);
+
+/*
+ * @brief 清除任务的唤醒时延统计信息。
+ *
+ * @par 描述
+ * 清除任务的唤醒时延统计信息，重新开始统计。
+ *
+ * @attention 无
+ *
+ * @param taskPid [IN]  类型#TskHandle，任务PID。
+ *
+ * @retval #OS_OK  0x00000000，清除统计信息成功。
+ * @retval #其它值，清除失败。
+ * @par 依赖
+ * <ul><li>prt_task.h：该接口声明所在的头文件。</li></ul>
+ * @see PRT_TaskWakeupStatGet
+ */
+extern U32 PRT_TaskWakeupStatClear(TskHandle taskPid);
+#endif
+
 /*
  * @brief 锁任务调度。
  *
@@ -283,7 +283,11 @@ struct TimerCreatePara {
     U32 timerGroupId;
     /* 定时器硬中断优先级 */
     U16 hwiPrio;
-    U16 resv;
+    /*
+     * 软件定时器到期时间允许延后的容差，单位是Tick，与#PRT_TaskDelaySlack的slack相同，为0时不对齐。
+     * 容差窗口重叠的定时器会对齐到同一个Tick到期，减少唤醒次数，硬件定时器不使用
+     */
+    U16 slack;
     /*
      * 定时器回调函数
      */
@@ -316,6 +320,20 @@ struct SwTmrInfo {
     TmrProcFunc handler;
 };
 
+/*
+ * 容差对齐统计信息的结构体类型定义，软件定时器与#PRT_TaskDelaySlack任务延时共同统计
+ */
+struct SwTmrSlackStat {
+    /* 软件定时器启动及任务延时按容差调整了到期Tick的次数 */
+    U32 alignCount;
+    /* 软件定时器及任务延时超时总次数 */
+    U32 expireCount;
+    /* 有超时到期的Tick数，即超时处理的唤醒次数 */
+    U32 wakeupCount;
+    /* 容差节省的唤醒次数，即调整过到期Tick、且与其他超时落在同一Tick处理的超时个数 */
+    U32 savedWakeup;
+};
+
 /*
  * @brief 创建定时器。
  *
@@ -511,6 +529,27 @@ extern U32 PRT_SwTmrInfoGet(TimerHandle tmrHandle, struct SwTmrInfo *info);
  */
 extern U32 PRT_TimerGetOverrun(U32 mid, TimerHandle tmrHandle, U32 *overrun);
 
+/*
+ * @brief 获取容差对齐的统计信息。
+ *
+ * @par 描述
+ * 获取软件定时器及任务延时按容差对齐的次数、超时次数及合并处理节省的唤醒次数。
+ *
+ * @attention
+ * <ul>
+ * <li>统计从系统启动开始累计，计数溢出后回绕。</li>
+ * <li>容差单位为Tick。</li>
+ * </ul>
+ *
+ * @param stat [OUT] 类型#struct SwTmrSlackStat *，存放统计信息的结构体指针。
+ *
+ * @retval #OS_OK  0x00000000，获取统计信息成功。
+ * @retval #其他值  获取失败。
+ * <ul><li>prt_timer.h：该接口声明所在的头文件。</li></ul>
+ * @see 无
+ */
+extern U32 PRT_SwTmrSlackStatGet(struct SwTmrSlackStat *stat);
+
 #ifdef __cplusplus
 #if __cplusplus
 }
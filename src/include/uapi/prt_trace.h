@@ -0,0 +1,200 @@
+/*
+ * Copyright (c) 2023-2023 Huawei Technologies Co., Ltd. All rights reserved.
+ *
+ * UniProton is licensed under Mulan PSL v2.
+ * You can use this software according to the terms and conditions of the Mulan PSL v2.
+ * You may obtain a copy of Mulan PSL v2 at:
+ *          http://license.coscl.org.cn/MulanPSL2
+ * THIS SOFTWARE IS PROVIDED ON AN "AS IS" BASIS, WITHOUT WARRANTIES OF ANY KIND,
+ * EITHER EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO NON-INFRINGEMENT,
+ * MERCHANTABILITY OR FIT FOR A PARTICULAR PURPOSE.
+ * See the Mulan PSL v2 for more details.
+ * Create: 2023-06-01
+ * Description: 内核事件跟踪模块的对外头文件。
+ */
+#ifndef PRT_TRACE_H
+#define PRT_TRACE_H
+
+#include "prt_buildef.h"
+#include "prt_module.h"
+#include "prt_errno.h"
+
+#ifdef __cplusplus
+#if __cplusplus
+extern "C" {
+#endif /* __cpluscplus */
+#endif /* __cpluscplus */
+
+/*
+ * 跟踪模块错误码：指针参数为NULL。
+ *
+ * 值: 0x02001001
+ *
+ * 解决方案: 传入非0的有效地址。
+ */
+#define OS_ERRNO_TRACE_PTR_NULL OS_ERRNO_BUILD_ERROR(OS_MID_TRACE, 0x01)
+
+/*
+ * 跟踪模块错误码：跟踪模式非法。
+ *
+ * 值: 0x02001002
+ *
+ * 解决方案: 跟踪模式只能为#OS_TRACE_MODE_OVERWRITE或#OS_TRACE_MODE_STOP。
+ */
+#define OS_ERRNO_TRACE_MODE_INVALID OS_ERRNO_BUILD_ERROR(OS_MID_TRACE, 0x02)
+
+/*
+ * 跟踪模块错误码：跟踪已经开始，不能重复开始。
+ *
+ * 值: 0x02001003
+ *
+ * 解决方案: 先调用#PRT_TraceStop停止跟踪。
+ */
+#define OS_ERRNO_TRACE_ALREADY_STARTED OS_ERRNO_BUILD_ERROR(OS_MID_TRACE, 0x03)
+
+#if defined(OS_OPTION_TRACE)
+/* 跟踪缓冲区头部的魔术字，"TRCE" */
+#define OS_TRACE_MAGIC 0x45435254U
+/* 跟踪缓冲区格式版本号，缓冲区头部或记录格式变化时递增 */
+#define OS_TRACE_VERSION 1U
+
+/* 跟踪模式：记录区满后覆盖最早的记录，保留最近的事件 */
+#define OS_TRACE_MODE_OVERWRITE 0U
+/* 跟踪模式：记录区满后停止记录，保留最早的事件 */
+#define OS_TRACE_MODE_STOP 1U
+
+/* 记录中与上一条记录的cycle差所占的位数，超出时先写入一条#OS_TRACE_EVENT_TIME记录 */
+#define OS_TRACE_DELTA_BITS 24U
+#define OS_TRACE_DELTA_MAX ((1U << OS_TRACE_DELTA_BITS) - 1U)
+#define OS_TRACE_INFO_EVENT(info) ((info) >> OS_TRACE_DELTA_BITS)
+#define OS_TRACE_INFO_DELTA(info) ((info) & OS_TRACE_DELTA_MAX)
+
+/*
+ * 跟踪事件号，取值及参数含义是记录格式的一部分，只能在末尾新增。
+ * 地址类参数拆成低32位和高32位两个参数记录。
+ */
+enum TraceEventId {
+    OS_TRACE_EVENT_TIME = 0,     /* 与上一条记录的cycle差，arg0/arg1为差值的低/高32位 */
+    OS_TRACE_EVENT_TASK_SWITCH,  /* 任务切换，arg0为切出任务PID，arg1为切入任务PID */
+    OS_TRACE_EVENT_TASK_READY,   /* 任务进入就绪态，arg0为任务PID */
+    OS_TRACE_EVENT_TASK_BLOCK,   /* 任务因等待资源、延时或周期等待阻塞，arg0为任务PID */
+    OS_TRACE_EVENT_HWI_ENTRY,    /* 硬中断处理开始，arg0为中断号 */
+    OS_TRACE_EVENT_HWI_EXIT,     /* 硬中断处理结束，arg0为中断号 */
+    OS_TRACE_EVENT_SEM_PEND,     /* 计数信号量P操作，arg0为句柄，arg1为超时时间，arg2为1表示阻塞 */
+    OS_TRACE_EVENT_SEM_POST,     /* 计数信号量V操作，arg0为句柄，arg1为1表示唤醒了等待任务 */
+    OS_TRACE_EVENT_MUTEX_PEND,   /* 互斥信号量P操作，参数同#OS_TRACE_EVENT_SEM_PEND */
+    OS_TRACE_EVENT_MUTEX_POST,   /* 互斥信号量V操作，参数同#OS_TRACE_EVENT_SEM_POST */
+    OS_TRACE_EVENT_QUEUE_READ,   /* 读队列，arg0为队列ID，arg1为超时时间，arg2为缓冲区长度 */
+    OS_TRACE_EVENT_QUEUE_WRITE,  /* 写队列，arg0为队列ID，arg1为超时时间，arg2为消息长度 */
+    OS_TRACE_EVENT_MEM_ALLOC,    /* 内存申请，arg0为申请大小，arg1/arg2为返回地址的低/高32位 */
+    OS_TRACE_EVENT_MEM_FREE,     /* 内存释放，arg1/arg2为释放地址的低/高32位 */
+    OS_TRACE_EVENT_TIMER_EXPIRE, /* 软件定时器超时处理函数执行，arg0为定时器句柄 */
+    OS_TRACE_EVENT_BUTT
+};
+
+/*
+ * 跟踪记录，固定16字节，覆盖模式下解析工具可从任意记录边界开始解析。
+ */
+struct TraceRecord {
+    /* bit[31:24]为事件号，bit[23:0]为与上一条记录的cycle差 */
+    U32 info;
+    U32 arg[3];
+};
+
+/*
+ * 跟踪缓冲区头部，记录区紧随其后。
+ * 解析时从最后一条记录的cycle数lastCycle开始按cycle差倒推每条记录的时间。
+ */
+struct TraceBufHead {
+    /* 魔术字#OS_TRACE_MAGIC */
+    U32 magic;
+    /* 格式版本号#OS_TRACE_VERSION */
+    U16 version;
+    /* 记录该缓冲区的核号 */
+    U16 coreId;
+    /* 记录区可容纳的记录条数 */
+    U32 recordNum;
+    /* 跟踪模式 */
+    U32 mode;
+    /* 下一条记录的写入位置 */
+    U32 writeIdx;
+    /* 停止模式下记录区满后丢弃的事件个数 */
+    U32 lost;
+    /* 开始跟踪后写入的记录总数 */
+    U64 writeCount;
+    /* 最后一条记录的cycle数，尚无记录时为开始跟踪时的cycle数 */
+    U64 lastCycle;
+    /* 每秒cycle数 */
+    U64 cyclePerSec;
+};
+
+/*
+ * @brief 开始跟踪内核事件。
+ *
+ * @par 描述
+ * 清空本核跟踪缓冲区后开始记录任务切换、中断、信号量、队列、内存及软件定时器事件。
+ *
+ * @attention
+ * <ul>
+ * <li>缓冲区大小由OS_TRACE_BUF_SIZE配置，每个核只写自己的缓冲区。</li>
+ * <li>跟踪过程中可以随时停止，停止后通过#PRT_TraceBufGet获取缓冲区导出到主机解析。</li>
+ * </ul>
+ *
+ * @param mode [IN]  类型#U32，跟踪模式，#OS_TRACE_MODE_OVERWRITE或#OS_TRACE_MODE_STOP。
+ *
+ * @retval #OS_OK                          0x00000000，操作成功。
+ * @retval #OS_ERRNO_TRACE_MODE_INVALID    0x02001002，跟踪模式非法。
+ * @retval #OS_ERRNO_TRACE_ALREADY_STARTED 0x02001003，跟踪已经开始。
+ * @par 依赖
+ * <ul><li>prt_trace.h：该接口声明所在的头文件。</li></ul>
+ * @see PRT_TraceStop
+ */
+extern U32 PRT_TraceStart(U32 mode);
+
+/*
+ * @brief 停止跟踪内核事件。
+ *
+ * @par 描述
+ * 停止记录，缓冲区内容保留到下一次开始跟踪。
+ *
+ * @attention 无
+ *
+ * @param 无。
+ *
+ * @retval 无
+ * @par 依赖
+ * <ul><li>prt_trace.h：该接口声明所在的头文件。</li></ul>
+ * @see PRT_TraceStart
+ */
+extern void PRT_TraceStop(void);
+
+/*
+ * @brief 获取本核跟踪缓冲区。
+ *
+ * @par 描述
+ * 输出缓冲区首地址及长度，缓冲区以#TraceBufHead开头，可原样导出给主机侧解析工具。
+ *
+ * @attention
+ * <ul>
+ * <li>跟踪过程中缓冲区仍在写入，导出前应先调用#PRT_TraceStop。</li>
+ * </ul>
+ *
+ * @param addr [OUT] 类型#void **，缓冲区首地址。
+ * @param size [OUT] 类型#U32 *，缓冲区有效长度，单位字节。
+ *
+ * @retval #OS_OK                   0x00000000，操作成功。
+ * @retval #OS_ERRNO_TRACE_PTR_NULL 0x02001001，指针参数为NULL。
+ * @par 依赖
+ * <ul><li>prt_trace.h：该接口声明所在的头文件。</li></ul>
+ * @see PRT_TraceStop
+ */
+extern U32 PRT_TraceBufGet(void **addr, U32 *size);
+#endif
+
+#ifdef __cplusplus
+#if __cplusplus
+}
+#endif /* __cpluscplus */
+#endif /* __cpluscplus */
+
+#endif /* PRT_TRACE_H */
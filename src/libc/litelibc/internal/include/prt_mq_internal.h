@@ -0,0 +1,70 @@
+/*
+ * Copyright (c) 2022-2023 Huawei Technologies Co., Ltd. All rights reserved.
+ *
+ * UniProton is licensed under Mulan PSL v2.
+ * You can use this software according to the terms and conditions of the Mulan PSL v2.
+ * You may obtain a copy of Mulan PSL v2 at:
+ *          http://license.coscl.org.cn/MulanPSL2
+ * THIS SOFTWARE IS PROVIDED ON AN "AS IS" BASIS, WITHOUT WARRANTIES OF ANY KIND,
+ * EITHER EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO NON-INFRINGEMENT,
+ * MERCHANTABILITY OR FIT FOR A PARTICULAR PURPOSE.
+ * See the Mulan PSL v2 for more details.
+ * Create: 2023-05-29
+ * Description: POSIX消息队列内部数据结构及函数声明
+ */
+#ifndef PRT_MQ_INTERNAL_H
+#define PRT_MQ_INTERNAL_H
+
+#include <pthread.h>
+#include <fcntl.h>
+#include <mqueue.h>
+#include <signal.h>
+#include "prt_posix_internal.h"
+#include "prt_queue_external.h"
+
+/* 系统支持的最大POSIX消息队列个数 */
+#define OS_MQ_MAX_NUM           16
+/* 系统支持同时打开的最大消息队列描述符个数 */
+#define OS_MQ_OPEN_MAX          32
+#define MAX_POSIX_MQ_NAME_LEN   31
+
+/* mq_open未指定属性时的默认消息个数及消息长度 */
+#define OS_MQ_DEFAULT_MAXMSG    10
+#define OS_MQ_DEFAULT_MSGSIZE   64
+
+/* 消息优先级上限，受内核优先级队列的消息优先级范围限制 */
+#define OS_MQ_PRIO_MAX          (OS_QUEUE_MSG_PRIO_MAX + 1)
+
+struct TagMqCb {
+    /* 消息队列名字，为空表示已被unlink或未使用 */
+    char name[MAX_POSIX_MQ_NAME_LEN + 1];
+    /* 内核优先级队列ID */
+    U32 queueId;
+    /* 引用该消息队列的描述符个数 */
+    U32 refCount;
+    /* 控制块是否被使用 */
+    bool used;
+    /* 是否已注册通知 */
+    bool notifyReg;
+    /* 删除时仍有任务在使用队列，由这些任务返回时完成删除 */
+    bool delPending;
+    U16 maxMsg;
+    U16 msgSize;
+    /* mq_notify注册的通知 */
+    struct sigevent notify;
+};
+
+struct TagMqDes {
+    struct TagMqCb *mqCb;
+    int oflag;
+};
+
+extern struct TagMqCb g_mqCb[OS_MQ_MAX_NUM];
+extern struct TagMqDes g_mqDes[OS_MQ_OPEN_MAX];
+
+extern struct TagMqDes *OsMqDesGet(mqd_t mqd);
+extern void OsMqDelete(struct TagMqCb *mqCb);
+extern int OsMqSend(mqd_t mqd, const char *msg, size_t len, unsigned prio, const struct timespec *at);
+extern ssize_t OsMqReceive(mqd_t mqd, char *msg, size_t len, unsigned *prio, const struct timespec *at);
+
+#endif
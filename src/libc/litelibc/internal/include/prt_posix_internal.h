@@ -39,9 +39,6 @@ typedef pthread_mutex_t prt_pthread_mutex_t;
 
 extern void (*g_pthread_keys_destor[PTHREAD_KEYS_MAX])(void *);
 
-#define PTHREAD_TERMINATED  2
-#define PTHREAD_EXITED      3
-
 extern void PRT_PthreadExit(void *retval);
 extern U32 OsTimeSpec2Tick(const struct timespec *tp);
 extern U32 OsTimeOut2Ticks(const struct timespec *time, U32 *ticks);
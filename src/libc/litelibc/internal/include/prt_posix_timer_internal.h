@@ -0,0 +1,62 @@
+/*
+ * Copyright (c) 2022-2023 Huawei Technologies Co., Ltd. All rights reserved.
+ *
+ * UniProton is licensed under Mulan PSL v2.
+ * You can use this software according to the terms and conditions of the Mulan PSL v2.
+ * You may obtain a copy of Mulan PSL v2 at:
+ *          http://license.coscl.org.cn/MulanPSL2
+ * THIS SOFTWARE IS PROVIDED ON AN "AS IS" BASIS, WITHOUT WARRANTIES OF ANY KIND,
+ * EITHER EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO NON-INFRINGEMENT,
+ * MERCHANTABILITY OR FIT FOR A PARTICULAR PURPOSE.
+ * See the Mulan PSL v2 for more details.
+ * Create: 2023-05-29
+ * Description: POSIX定时器内部数据结构及函数声明
+ */
+#ifndef PRT_POSIX_TIMER_INTERNAL_H
+#define PRT_POSIX_TIMER_INTERNAL_H
+
+#include <time.h>
+#include <signal.h>
+#include "prt_posix_internal.h"
+#include "prt_timer.h"
+
+/* 系统支持的最大POSIX定时器个数，每个POSIX定时器占用一个软件定时器 */
+#define OS_POSIX_TIMER_MAX_NUM      32
+/* SIGEV_THREAD回调线程池的线程个数，第一次创建SIGEV_THREAD定时器时创建 */
+#define OS_POSIX_TIMER_THREAD_NUM   2
+
+/* timer_t为指向该结构的指针，定时器参数保存在结构中，不经过软件定时器的U32用户参数传递指针 */
+struct TagPosixTimer {
+    /* 等待回调线程处理的链表 */
+    struct TagPosixTimer *next;
+    /* 内核软件定时器句柄 */
+    TimerHandle swtmrId;
+    clockid_t clockId;
+    /* 通知方式，支持SIGEV_THREAD及SIGEV_NONE */
+    int notify;
+    void (*notifyFunc)(union sigval);
+    union sigval value;
+    /* 通知挂在等待链表上期间新增的超时次数 */
+    U32 overrun;
+    /* 最近一次送达通知时的超时次数，由timer_getoverrun返回 */
+    U32 lastOverrun;
+    /* 以CLOCK_REALTIME绝对时间设置且尚未首次到期时的到期时间及周期Tick数，clock_settime后据此重新设置 */
+    struct timespec absValue;
+    U32 absInterval;
+    bool absArmed;
+    /* 控制块是否被使用 */
+    bool used;
+    /* 是否已挂在等待链表上 */
+    bool queued;
+};
+
+extern struct TagPosixTimer g_posixTimer[OS_POSIX_TIMER_MAX_NUM];
+
+extern struct TagPosixTimer *OsPosixTimerGet(timer_t timerId);
+extern int OsPosixTimerCreate(clockid_t clockId, const struct sigevent *evp, timer_t *timerId);
+extern int OsPosixTimerDelete(struct TagPosixTimer *timer);
+extern U32 OsPosixTimerAbs2Tick(clockid_t clockId, const struct timespec *abs);
+extern void OsPosixTimerRealTimeChanged(void);
+extern void OsTimeNs2Spec(U64 ns, struct timespec *tp);
+
+#endif
@@ -0,0 +1,254 @@
+/*
+ * Copyright (c) 2022-2023 Huawei Technologies Co., Ltd. All rights reserved.
+ *
+ * UniProton is licensed under Mulan PSL v2.
+ * You can use this software according to the terms and conditions of the Mulan PSL v2.
+ * You may obtain a copy of Mulan PSL v2 at:
+ *          http://license.coscl.org.cn/MulanPSL2
+ * THIS SOFTWARE IS PROVIDED ON AN "AS IS" BASIS, WITHOUT WARRANTIES OF ANY KIND,
+ * EITHER EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO NON-INFRINGEMENT,
+ * MERCHANTABILITY OR FIT FOR A PARTICULAR PURPOSE.
+ * See the Mulan PSL v2 for more details.
+ * Create: 2023-05-29
+ * Description: POSIX消息队列内部功能实现
+ */
+#include <stdlib.h>
+#include "prt_mq_internal.h"
+#include "prt_hwi.h"
+
+struct TagMqCb g_mqCb[OS_MQ_MAX_NUM];
+struct TagMqDes g_mqDes[OS_MQ_OPEN_MAX];
+
+struct TagMqNotifyArg {
+    void (*func)(union sigval);
+    union sigval value;
+};
+
+struct TagMqDes *OsMqDesGet(mqd_t mqd)
+{
+    if ((mqd < 0) || (mqd >= OS_MQ_OPEN_MAX)) {
+        return NULL;
+    }
+
+    if (g_mqDes[mqd].mqCb == NULL) {
+        return NULL;
+    }
+
+    return &g_mqDes[mqd];
+}
+
+/*
+ * 描述：删除消息队列，调用前需关中断
+ */
+void OsMqDelete(struct TagMqCb *mqCb)
+{
+    if (PRT_QueueDelete(mqCb->queueId) != OS_OK) {
+        /* 仍有任务阻塞在该队列上或被唤醒后还未完成读写，保留控制块，由这些任务返回时重新删除 */
+        mqCb->delPending = TRUE;
+        return;
+    }
+
+    (void)memset_s(mqCb, sizeof(struct TagMqCb), 0, sizeof(struct TagMqCb));
+}
+
+/*
+ * 描述：收发返回时完成被推迟的删除，调用前需关中断
+ */
+static void OsMqDeletePendingProc(struct TagMqCb *mqCb)
+{
+    if (mqCb->delPending == TRUE) {
+        OsMqDelete(mqCb);
+    }
+}
+
+static void *OsMqNotifyThread(void *arg)
+{
+    struct TagMqNotifyArg notifyArg = *(struct TagMqNotifyArg *)arg;
+
+    free(arg);
+    notifyArg.func(notifyArg.value);
+    return NULL;
+}
+
+/*
+ * 描述：消息队列由空变为非空时，触发mq_notify注册的通知，通知只生效一次
+ */
+static void OsMqNotify(const struct sigevent *notify)
+{
+    pthread_t thread;
+    pthread_attr_t attr;
+    struct TagMqNotifyArg *notifyArg;
+
+    if (notify->sigev_notify != SIGEV_THREAD) {
+        return;
+    }
+
+    notifyArg = malloc(sizeof(struct TagMqNotifyArg));
+    if (notifyArg == NULL) {
+        return;
+    }
+    notifyArg->func = notify->sigev_notify_function;
+    notifyArg->value = notify->sigev_value;
+
+    if (notify->sigev_notify_attributes != NULL) {
+        attr = *notify->sigev_notify_attributes;
+    } else {
+        (void)pthread_attr_init(&attr);
+    }
+    (void)pthread_attr_setdetachstate(&attr, PTHREAD_CREATE_DETACHED);
+
+    if (pthread_create(&thread, &attr, OsMqNotifyThread, notifyArg) != 0) {
+        free(notifyArg);
+    }
+}
+
+static U32 OsMqTimeOut(const struct TagMqDes *mqDes, const struct timespec *at, U32 *timeOut)
+{
+    if (((U32)mqDes->oflag & O_NONBLOCK) != 0) {
+        *timeOut = OS_QUEUE_NO_WAIT;
+        return OS_OK;
+    }
+
+    if (at == NULL) {
+        *timeOut = OS_QUEUE_WAIT_FOREVER;
+        return OS_OK;
+    }
+
+    /* 超时时间非法返回EINVAL，已超时返回ETIMEDOUT */
+    return OsTimeOut2Ticks(at, timeOut);
+}
+
+static int OsMqErrno(U32 ret, const struct TagMqDes *mqDes)
+{
+    if (ret == OS_ERRNO_QUEUE_NO_SOURCE) {
+        return (((U32)mqDes->oflag & O_NONBLOCK) != 0) ? EAGAIN : ETIMEDOUT;
+    }
+
+    if (ret == OS_ERRNO_QUEUE_TIMEOUT) {
+        return ETIMEDOUT;
+    }
+
+    if ((ret == OS_ERRNO_QUEUE_INVALID) || (ret == OS_ERRNO_QUEUE_NOT_CREATE)) {
+        return EBADF;
+    }
+
+    return EINVAL;
+}
+
+int OsMqSend(mqd_t mqd, const char *msg, size_t len, unsigned prio, const struct timespec *at)
+{
+    U32 ret;
+    U32 timeOut;
+    uintptr_t intSave;
+    bool firstMsg = FALSE;
+    bool notify = FALSE;
+    struct sigevent notifyEvent;
+    struct TagMqDes *mqDes;
+    struct TagMqCb *mqCb;
+
+    mqDes = OsMqDesGet(mqd);
+    if ((mqDes == NULL) || (((U32)mqDes->oflag & O_ACCMODE) == O_RDONLY)) {
+        errno = EBADF;
+        return PTHREAD_OP_FAIL;
+    }
+
+    mqCb = mqDes->mqCb;
+    if (len > mqCb->msgSize) {
+        errno = EMSGSIZE;
+        return PTHREAD_OP_FAIL;
+    }
+
+    if ((msg == NULL) || (prio >= OS_MQ_PRIO_MAX)) {
+        errno = EINVAL;
+        return PTHREAD_OP_FAIL;
+    }
+
+    /* 队列未满时直接写入，不检查超时时间 */
+    ret = OsQueueWrite(mqCb->queueId, (void *)msg, (U32)len, OS_QUEUE_NO_WAIT, (U32)prio, &firstMsg);
+    if (ret == OS_ERRNO_QUEUE_NO_SOURCE) {
+        ret = OsMqTimeOut(mqDes, at, &timeOut);
+        if (ret != OS_OK) {
+            errno = (int)ret;
+            return PTHREAD_OP_FAIL;
+        }
+        ret = OsQueueWrite(mqCb->queueId, (void *)msg, (U32)len, timeOut, (U32)prio, &firstMsg);
+    }
+
+    intSave = PRT_HwiLock();
+    /* 队列是否由空变为非空在入队时判断，不受阻塞唤醒后其他任务读写的影响；消息直接交给阻塞的读任务时不通知 */
+    if ((ret == OS_OK) && (firstMsg == TRUE) && (mqCb->notifyReg == TRUE)) {
+        notifyEvent = mqCb->notify;
+        mqCb->notifyReg = FALSE;
+        notify = TRUE;
+    }
+    OsMqDeletePendingProc(mqCb);
+    PRT_HwiRestore(intSave);
+
+    if (ret != OS_OK) {
+        errno = OsMqErrno(ret, mqDes);
+        return PTHREAD_OP_FAIL;
+    }
+
+    if (notify == TRUE) {
+        OsMqNotify(&notifyEvent);
+    }
+
+    return OS_OK;
+}
+
+ssize_t OsMqReceive(mqd_t mqd, char *msg, size_t len, unsigned *prio, const struct timespec *at)
+{
+    U32 ret;
+    U32 timeOut;
+    U32 msgPrio;
+    U32 msgLen;
+    uintptr_t intSave;
+    struct TagMqDes *mqDes;
+    struct TagMqCb *mqCb;
+
+    mqDes = OsMqDesGet(mqd);
+    if ((mqDes == NULL) || (((U32)mqDes->oflag & O_ACCMODE) == O_WRONLY)) {
+        errno = EBADF;
+        return PTHREAD_OP_FAIL;
+    }
+
+    mqCb = mqDes->mqCb;
+    if (len < mqCb->msgSize) {
+        errno = EMSGSIZE;
+        return PTHREAD_OP_FAIL;
+    }
+
+    if (msg == NULL) {
+        errno = EINVAL;
+        return PTHREAD_OP_FAIL;
+    }
+
+    /* 消息长度不超过msgSize，只需按msgSize接收 */
+    msgLen = mqCb->msgSize;
+    /* 队列非空时直接读取，不检查超时时间 */
+    ret = OsQueueRead(mqCb->queueId, msg, &msgLen, &msgPrio, OS_QUEUE_NO_WAIT);
+    if (ret == OS_ERRNO_QUEUE_NO_SOURCE) {
+        ret = OsMqTimeOut(mqDes, at, &timeOut);
+        if (ret != OS_OK) {
+            errno = (int)ret;
+            return PTHREAD_OP_FAIL;
+        }
+        msgLen = mqCb->msgSize;
+        ret = OsQueueRead(mqCb->queueId, msg, &msgLen, &msgPrio, timeOut);
+    }
+
+    intSave = PRT_HwiLock();
+    OsMqDeletePendingProc(mqCb);
+    PRT_HwiRestore(intSave);
+
+    if (ret != OS_OK) {
+        errno = OsMqErrno(ret, mqDes);
+        return PTHREAD_OP_FAIL;
+    }
+
+    if (prio != NULL) {
+        *prio = msgPrio;
+    }
+
+    return (ssize_t)msgLen;
+}
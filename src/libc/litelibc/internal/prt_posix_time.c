@@ -19,43 +19,44 @@
 #include "prt_timer.h"
 #include "prt_swtmr_external.h"
 
-static struct timespec g_accDeltaFromSet;
+/*
+ * 描述：纳秒数拆分为秒和纳秒，不做64位除法
+ */
+void OsTimeNs2Spec(U64 ns, struct timespec *tp)
+{
+    U64 sec = OsLibMulShift(ns, &g_sysClkConv.ns2Sec);
+    U64 nsec = ns - sec * OS_SYS_NS_PER_SECOND;
+
+    /* 换算因子向上取整，秒数最多多算1，此时余数回绕为很大的值 */
+    if (nsec >= OS_SYS_NS_PER_SECOND) {
+        sec--;
+        nsec += OS_SYS_NS_PER_SECOND;
+    }
+
+    tp->tv_sec = (time_t)sec;
+    tp->tv_nsec = (long)nsec;
+}
 
 void OsTimeGetHwTime(struct timespec *hwTime)
 {
-    U64 cycle = OsCurCycleGet64();
-    U64 nowNsec = (cycle / g_systemClock) * OS_SYS_NS_PER_SECOND +
-        (cycle % g_systemClock) * OS_SYS_NS_PER_SECOND / g_systemClock;
-
-    hwTime->tv_sec = nowNsec / OS_SYS_NS_PER_SECOND;
-    hwTime->tv_nsec = nowNsec % OS_SYS_NS_PER_SECOND;
+    OsTimeNs2Spec(OsCycle2Ns(OsCurCycleGet64()), hwTime);
 }
 
 void OsTimeSetRealTime(const struct timespec *realTime)
 {
-    U32 intSave;
-    struct timespec hwTime = {0};
-
-    OsTimeGetHwTime(&hwTime);
-    intSave = PRT_HwiLock();
-    g_accDeltaFromSet.tv_nsec = realTime->tv_nsec - hwTime.tv_nsec;
-    g_accDeltaFromSet.tv_sec = (realTime->tv_sec - hwTime.tv_sec) - (time_t)(g_accDeltaFromSet.tv_nsec < 0);
-    g_accDeltaFromSet.tv_nsec = (g_accDeltaFromSet.tv_nsec + OS_SYS_NS_PER_SECOND) % OS_SYS_NS_PER_SECOND;
-    PRT_HwiRestore(intSave);
+    U64 realNs = (U64)realTime->tv_sec * OS_SYS_NS_PER_SECOND + (U64)realTime->tv_nsec;
+
+    OsTimeKeeperRealOffsetSet((S64)(realNs - OsCycle2Ns(OsCurCycleGet64())));
 }
 
+/*
+ * 描述：读取实时时间，偏移通过顺序锁读取，不关中断
+ */
 void OsTimeGetRealTime(struct timespec *realTime)
 {
-    U32 intSave;
-    struct timespec hwTime = {0};
-
-    OsTimeGetHwTime(&hwTime);
+    U64 hwNs = OsCycle2Ns(OsCurCycleGet64());
 
-    intSave = PRT_HwiLock();
-    realTime->tv_nsec = hwTime.tv_nsec + g_accDeltaFromSet.tv_nsec;
-    realTime->tv_sec = hwTime.tv_sec + g_accDeltaFromSet.tv_sec + (time_t)(realTime->tv_nsec >= OS_SYS_NS_PER_SECOND);
-    realTime->tv_nsec %= OS_SYS_NS_PER_SECOND;
-    PRT_HwiRestore(intSave);
+    OsTimeNs2Spec(hwNs + (U64)OsTimeKeeperRealOffsetGet(), realTime);
 }
 
 bool OsTimeCheckSpec(const struct timespec *tp)
@@ -0,0 +1,328 @@
+/*
+ * Copyright (c) 2022-2023 Huawei Technologies Co., Ltd. All rights reserved.
+ *
+ * UniProton is licensed under Mulan PSL v2.
+ * You can use this software according to the terms and conditions of the Mulan PSL v2.
+ * You may obtain a copy of Mulan PSL v2 at:
+ *          http://license.coscl.org.cn/MulanPSL2
+ * THIS SOFTWARE IS PROVIDED ON AN "AS IS" BASIS, WITHOUT WARRANTIES OF ANY KIND,
+ * EITHER EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO NON-INFRINGEMENT,
+ * MERCHANTABILITY OR FIT FOR A PARTICULAR PURPOSE.
+ * See the Mulan PSL v2 for more details.
+ * Create: 2023-05-29
+ * Description: POSIX定时器内部功能实现
+ */
+#include <pthread.h>
+#include <limits.h>
+#include "prt_posix_timer_internal.h"
+#include "prt_hwi.h"
+#include "prt_sem.h"
+#include "prt_swtmr_external.h"
+
+struct TagPosixTimer g_posixTimer[OS_POSIX_TIMER_MAX_NUM];
+
+/* 等待回调线程处理的定时器链表，按超时顺序排列 */
+static struct TagPosixTimer *g_posixTimerHead;
+static struct TagPosixTimer *g_posixTimerTail;
+/* 等待链表非空时释放，回调线程在该信号量上等待 */
+static SemHandle g_posixTimerSem;
+static bool g_posixTimerPoolInit;
+
+struct TagPosixTimer *OsPosixTimerGet(timer_t timerId)
+{
+    uintptr_t addr = (uintptr_t)timerId;
+    uintptr_t base = (uintptr_t)&g_posixTimer[0];
+
+    if ((addr < base) || (addr >= (uintptr_t)&g_posixTimer[OS_POSIX_TIMER_MAX_NUM]) ||
+        (((addr - base) % sizeof(struct TagPosixTimer)) != 0)) {
+        return NULL;
+    }
+
+    if (((struct TagPosixTimer *)timerId)->used == FALSE) {
+        return NULL;
+    }
+
+    return (struct TagPosixTimer *)timerId;
+}
+
+/*
+ * 描述：回调线程，从等待链表取出定时器执行SIGEV_THREAD回调
+ */
+static void *OsPosixTimerThread(void *arg)
+{
+    uintptr_t intSave;
+    struct TagPosixTimer *timer;
+    void (*notifyFunc)(union sigval);
+    union sigval value;
+
+    (void)arg;
+    for (;;) {
+        if (PRT_SemPend(g_posixTimerSem, OS_WAIT_FOREVER) != OS_OK) {
+            continue;
+        }
+
+        intSave = PRT_HwiLock();
+        timer = g_posixTimerHead;
+        if (timer == NULL) {
+            /* 定时器在等待期间被删除 */
+            PRT_HwiRestore(intSave);
+            continue;
+        }
+
+        g_posixTimerHead = timer->next;
+        if (g_posixTimerHead == NULL) {
+            g_posixTimerTail = NULL;
+        }
+        timer->next = NULL;
+        timer->queued = FALSE;
+        timer->lastOverrun = timer->overrun;
+        timer->overrun = 0;
+        notifyFunc = timer->notifyFunc;
+        value = timer->value;
+        PRT_HwiRestore(intSave);
+
+        notifyFunc(value);
+    }
+
+    return NULL;
+}
+
+/*
+ * 描述：第一次创建SIGEV_THREAD定时器时创建回调线程池
+ */
+static int OsPosixTimerPoolInit(void)
+{
+    U32 i;
+    int ret = OS_OK;
+    pthread_t thread;
+    pthread_attr_t attr;
+
+    PRT_TaskLock();
+    if (g_posixTimerPoolInit) {
+        PRT_TaskUnlock();
+        return OS_OK;
+    }
+
+    if (PRT_SemCreate(0, &g_posixTimerSem) != OS_OK) {
+        PRT_TaskUnlock();
+        return EAGAIN;
+    }
+
+    (void)pthread_attr_init(&attr);
+    (void)pthread_attr_setdetachstate(&attr, PTHREAD_CREATE_DETACHED);
+    for (i = 0; i < OS_POSIX_TIMER_THREAD_NUM; i++) {
+        if (pthread_create(&thread, &attr, OsPosixTimerThread, NULL) != 0) {
+            /* 已创建的线程继续服务，至少有一个线程时认为成功 */
+            ret = (i == 0) ? EAGAIN : OS_OK;
+            break;
+        }
+    }
+
+    if (ret == OS_OK) {
+        g_posixTimerPoolInit = TRUE;
+    } else {
+        (void)PRT_SemDelete(g_posixTimerSem);
+    }
+    PRT_TaskUnlock();
+
+    return ret;
+}
+
+/*
+ * 描述：软件定时器超时处理函数，在Tick中断或软件定时器任务中执行，只把定时器挂到等待链表上
+ */
+static void OsPosixTimerExpire(TimerHandle tmrHandle, U32 arg1, U32 arg2, U32 arg3, U32 arg4)
+{
+    uintptr_t intSave;
+    struct TagPosixTimer *timer = &g_posixTimer[arg1];
+
+    (void)arg2;
+    (void)arg3;
+    (void)arg4;
+
+    intSave = PRT_HwiLock();
+    if ((timer->used == FALSE) || (timer->swtmrId != tmrHandle)) {
+        PRT_HwiRestore(intSave);
+        return;
+    }
+
+    /* 首次到期后不再受clock_settime影响 */
+    timer->absArmed = FALSE;
+    if (timer->notify != SIGEV_THREAD) {
+        PRT_HwiRestore(intSave);
+        return;
+    }
+
+    /* 上一次通知尚未处理，只累计超时次数 */
+    if (timer->queued) {
+        if (timer->overrun < DELAYTIMER_MAX) {
+            timer->overrun++;
+        }
+        PRT_HwiRestore(intSave);
+        return;
+    }
+
+    timer->queued = TRUE;
+    if (g_posixTimerTail == NULL) {
+        g_posixTimerHead = timer;
+    } else {
+        g_posixTimerTail->next = timer;
+    }
+    g_posixTimerTail = timer;
+    PRT_HwiRestore(intSave);
+
+    (void)PRT_SemPost(g_posixTimerSem);
+}
+
+static struct TagPosixTimer *OsPosixTimerAlloc(void)
+{
+    U32 i;
+    uintptr_t intSave;
+
+    intSave = PRT_HwiLock();
+    for (i = 0; i < OS_POSIX_TIMER_MAX_NUM; i++) {
+        if (g_posixTimer[i].used == FALSE) {
+            g_posixTimer[i].used = TRUE;
+            PRT_HwiRestore(intSave);
+            return &g_posixTimer[i];
+        }
+    }
+    PRT_HwiRestore(intSave);
+
+    return NULL;
+}
+
+int OsPosixTimerCreate(clockid_t clockId, const struct sigevent *evp, timer_t *timerId)
+{
+    int ret;
+    struct TagPosixTimer *timer;
+    struct TimerCreatePara para = {0};
+
+    if (evp->sigev_notify == SIGEV_THREAD) {
+        ret = OsPosixTimerPoolInit();
+        if (ret != OS_OK) {
+            return ret;
+        }
+    }
+
+    timer = OsPosixTimerAlloc();
+    if (timer == NULL) {
+        return EAGAIN;
+    }
+
+    timer->next = NULL;
+    timer->clockId = clockId;
+    timer->notify = evp->sigev_notify;
+    timer->notifyFunc = evp->sigev_notify_function;
+    timer->value = evp->sigev_value;
+    timer->overrun = 0;
+    timer->lastOverrun = 0;
+    timer->queued = FALSE;
+    timer->absArmed = FALSE;
+
+    /* 用户参数只传递控制块下标，64位平台上不会截断指针 */
+    para.type = OS_TIMER_SOFTWARE;
+    para.mode = OS_TIMER_ONCE;
+    /* PRT_TimerCreate不接受0周期，实际到期时间及周期由timer_settime通过OsSwTmrArm设置 */
+    para.interval = 1;
+    para.timerGroupId = 0;
+    para.callBackFunc = OsPosixTimerExpire;
+    para.arg1 = (U32)(timer - g_posixTimer);
+    if (PRT_TimerCreate(&para, &timer->swtmrId) != OS_OK) {
+        timer->used = FALSE;
+        return EAGAIN;
+    }
+
+    /* 创建后未设置超时时间，timer_gettime应返回0 */
+    (void)OsSwTmrArm(timer->swtmrId, 0, 0);
+
+    *timerId = (timer_t)timer;
+    return OS_OK;
+}
+
+int OsPosixTimerDelete(struct TagPosixTimer *timer)
+{
+    uintptr_t intSave;
+    struct TagPosixTimer *prev = NULL;
+    struct TagPosixTimer *cur;
+
+    if (PRT_TimerDelete(0, timer->swtmrId) != OS_OK) {
+        return EINVAL;
+    }
+
+    /* 从等待链表中摘除尚未处理的通知 */
+    intSave = PRT_HwiLock();
+    if (timer->queued) {
+        for (cur = g_posixTimerHead; cur != timer; cur = cur->next) {
+            prev = cur;
+        }
+        if (prev == NULL) {
+            g_posixTimerHead = timer->next;
+        } else {
+            prev->next = timer->next;
+        }
+        if (g_posixTimerTail == timer) {
+            g_posixTimerTail = prev;
+        }
+        timer->next = NULL;
+        timer->queued = FALSE;
+    }
+    timer->used = FALSE;
+    PRT_HwiRestore(intSave);
+
+    return OS_OK;
+}
+
+/*
+ * 描述：绝对时间转换为相对当前时间的Tick数，已经过去的时间在下一个Tick到期
+ */
+U32 OsPosixTimerAbs2Tick(clockid_t clockId, const struct timespec *abs)
+{
+    struct timespec now;
+    struct timespec rel;
+
+    if (clockId == CLOCK_MONOTONIC) {
+        OsTimeGetHwTime(&now);
+    } else {
+        OsTimeGetRealTime(&now);
+    }
+
+    rel.tv_sec = abs->tv_sec - now.tv_sec;
+    rel.tv_nsec = abs->tv_nsec - now.tv_nsec;
+    if (rel.tv_nsec < 0) {
+        rel.tv_sec--;
+        rel.tv_nsec += OS_SYS_NS_PER_SECOND;
+    }
+
+    if ((rel.tv_sec < 0) || ((rel.tv_sec == 0) && (rel.tv_nsec == 0))) {
+        return 1;
+    }
+
+    return OsTimeSpec2Tick(&rel);
+}
+
+/*
+ * 描述：实时时间被修改后，按新的实时时间重新设置尚未首次到期的CLOCK_REALTIME绝对时间定时器
+ */
+void OsPosixTimerRealTimeChanged(void)
+{
+    U32 i;
+    U32 expiry;
+    uintptr_t intSave;
+    struct TagPosixTimer *timer;
+
+    for (i = 0; i < OS_POSIX_TIMER_MAX_NUM; i++) {
+        timer = &g_posixTimer[i];
+        if (!timer->absArmed) {
+            continue;
+        }
+
+        expiry = OsPosixTimerAbs2Tick(CLOCK_REALTIME, &timer->absValue);
+        /* 计算期间定时器可能已到期、被删除或重新设置 */
+        intSave = PRT_HwiLock();
+        if (timer->used && timer->absArmed) {
+            (void)OsSwTmrArm(timer->swtmrId, expiry, timer->absInterval);
+        }
+        PRT_HwiRestore(intSave);
+    }
+}
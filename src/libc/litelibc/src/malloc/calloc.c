@@ -0,0 +1,27 @@
+/*
+ * Copyright (c) 2022-2022 Huawei Technologies Co., Ltd. All rights reserved.
+ *
+ * UniProton is licensed under Mulan PSL v2.
+ * You can use this software according to the terms and conditions of the Mulan PSL v2.
+ * You may obtain a copy of Mulan PSL v2 at:
+ *          http://license.coscl.org.cn/MulanPSL2
+ * THIS SOFTWARE IS PROVIDED ON AN "AS IS" BASIS, WITHOUT WARRANTIES OF ANY KIND,
+ * EITHER EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO NON-INFRINGEMENT,
+ * MERCHANTABILITY OR FIT FOR A PARTICULAR PURPOSE.
+ * See the Mulan PSL v2 for more details.
+ * Create: 2022-11-15
+ * Description: calloc功能实现
+ */
+#include "stdlib.h"
+#include "stdint.h"
+#include "prt_mem.h"
+
+void *calloc(size_t m, size_t n)
+{
+    if ((n != 0) && (m > (SIZE_MAX / n))) {
+        return NULL;
+    }
+
+    /* 从未分配过的内存已在分区初始化时清零，由内存模块判断是否需要再清零 */
+    return PRT_MemAllocZero(0, OS_MEM_DEFAULT_FSC_PT, m * n);
+}
@@ -0,0 +1,40 @@
+/*
+ * Copyright (c) 2022-2022 Huawei Technologies Co., Ltd. All rights reserved.
+ *
+ * UniProton is licensed under Mulan PSL v2.
+ * You can use this software according to the terms and conditions of the Mulan PSL v2.
+ * You may obtain a copy of Mulan PSL v2 at:
+ *          http://license.coscl.org.cn/MulanPSL2
+ * THIS SOFTWARE IS PROVIDED ON AN "AS IS" BASIS, WITHOUT WARRANTIES OF ANY KIND,
+ * EITHER EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO NON-INFRINGEMENT,
+ * MERCHANTABILITY OR FIT FOR A PARTICULAR PURPOSE.
+ * See the Mulan PSL v2 for more details.
+ * Create: 2022-11-15
+ * Description: memalign功能实现
+ */
+#include "stdlib.h"
+#include "errno.h"
+#include "prt_mem.h"
+
+void *memalign(size_t align, size_t n)
+{
+    U32 alignPow;
+
+    if ((align == 0) || ((align & (align - 1)) != 0)) {
+        errno = EINVAL;
+        return NULL;
+    }
+
+    /* 更小的对齐要求按最小对齐处理 */
+    alignPow = (U32)__builtin_ctzl((unsigned long)align);
+    if (alignPow < (U32)MEM_ADDR_ALIGN_004) {
+        alignPow = (U32)MEM_ADDR_ALIGN_004;
+    }
+
+    if (alignPow >= (U32)MEM_ADDR_BUTT) {
+        errno = EINVAL;
+        return NULL;
+    }
+
+    return PRT_MemAllocAlign(0, OS_MEM_DEFAULT_FSC_PT, n, (enum MemAlign)alignPow);
+}
@@ -0,0 +1,37 @@
+/*
+ * Copyright (c) 2022-2022 Huawei Technologies Co., Ltd. All rights reserved.
+ *
+ * UniProton is licensed under Mulan PSL v2.
+ * You can use this software according to the terms and conditions of the Mulan PSL v2.
+ * You may obtain a copy of Mulan PSL v2 at:
+ *          http://license.coscl.org.cn/MulanPSL2
+ * THIS SOFTWARE IS PROVIDED ON AN "AS IS" BASIS, WITHOUT WARRANTIES OF ANY KIND,
+ * EITHER EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO NON-INFRINGEMENT,
+ * MERCHANTABILITY OR FIT FOR A PARTICULAR PURPOSE.
+ * See the Mulan PSL v2 for more details.
+ * Create: 2022-11-15
+ * Description: posix_memalign功能实现
+ */
+#include "stdlib.h"
+#include "errno.h"
+#include "malloc.h"
+#include "prt_mem.h"
+
+int posix_memalign(void **res, size_t align, size_t len)
+{
+    void *mem;
+
+    /* 对齐要求超出内存模块支持的范围时同样返回EINVAL */
+    if ((align < sizeof(void *)) || ((align & (align - 1)) != 0) ||
+        (align > ((size_t)1 << ((U32)MEM_ADDR_BUTT - 1)))) {
+        return EINVAL;
+    }
+
+    mem = memalign(align, len);
+    if (mem == NULL) {
+        return ENOMEM;
+    }
+
+    *res = mem;
+    return 0;
+}
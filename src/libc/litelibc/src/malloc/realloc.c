@@ -0,0 +1,31 @@
+/*
+ * Copyright (c) 2022-2022 Huawei Technologies Co., Ltd. All rights reserved.
+ *
+ * UniProton is licensed under Mulan PSL v2.
+ * You can use this software according to the terms and conditions of the Mulan PSL v2.
+ * You may obtain a copy of Mulan PSL v2 at:
+ *          http://license.coscl.org.cn/MulanPSL2
+ * THIS SOFTWARE IS PROVIDED ON AN "AS IS" BASIS, WITHOUT WARRANTIES OF ANY KIND,
+ * EITHER EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO NON-INFRINGEMENT,
+ * MERCHANTABILITY OR FIT FOR A PARTICULAR PURPOSE.
+ * See the Mulan PSL v2 for more details.
+ * Create: 2022-11-15
+ * Description: realloc功能实现
+ */
+#include "stdlib.h"
+#include "prt_mem.h"
+
+void *realloc(void *p, size_t n)
+{
+    if (p == NULL) {
+        return malloc(n);
+    }
+
+    if (n == 0) {
+        free(p);
+        return NULL;
+    }
+
+    /* 后一相邻块空闲时原地扩大，不拷贝数据 */
+    return PRT_MemRealloc(0, p, n);
+}
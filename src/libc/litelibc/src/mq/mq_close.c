@@ -0,0 +1,44 @@
+/*
+ * Copyright (c) 2022-2023 Huawei Technologies Co., Ltd. All rights reserved.
+ *
+ * UniProton is licensed under Mulan PSL v2.
+ * You can use this software according to the terms and conditions of the Mulan PSL v2.
+ * You may obtain a copy of Mulan PSL v2 at:
+ *          http://license.coscl.org.cn/MulanPSL2
+ * THIS SOFTWARE IS PROVIDED ON AN "AS IS" BASIS, WITHOUT WARRANTIES OF ANY KIND,
+ * EITHER EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO NON-INFRINGEMENT,
+ * MERCHANTABILITY OR FIT FOR A PARTICULAR PURPOSE.
+ * See the Mulan PSL v2 for more details.
+ * Create: 2023-05-29
+ * Description: mq_close 相关接口实现
+ */
+#include "prt_mq_internal.h"
+#include "prt_hwi.h"
+
+int mq_close(mqd_t mqd)
+{
+    uintptr_t intSave;
+    struct TagMqDes *mqDes;
+    struct TagMqCb *mqCb;
+
+    intSave = PRT_HwiLock();
+    mqDes = OsMqDesGet(mqd);
+    if (mqDes == NULL) {
+        PRT_HwiRestore(intSave);
+        errno = EBADF;
+        return PTHREAD_OP_FAIL;
+    }
+
+    mqCb = mqDes->mqCb;
+    mqDes->mqCb = NULL;
+    mqDes->oflag = 0;
+
+    mqCb->refCount--;
+    /* 已被unlink的消息队列在最后一个描述符关闭时删除 */
+    if ((mqCb->refCount == 0) && (mqCb->name[0] == '\0')) {
+        OsMqDelete(mqCb);
+    }
+    PRT_HwiRestore(intSave);
+
+    return OS_OK;
+}
@@ -0,0 +1,45 @@
+/*
+ * Copyright (c) 2022-2023 Huawei Technologies Co., Ltd. All rights reserved.
+ *
+ * UniProton is licensed under Mulan PSL v2.
+ * You can use this software according to the terms and conditions of the Mulan PSL v2.
+ * You may obtain a copy of Mulan PSL v2 at:
+ *          http://license.coscl.org.cn/MulanPSL2
+ * THIS SOFTWARE IS PROVIDED ON AN "AS IS" BASIS, WITHOUT WARRANTIES OF ANY KIND,
+ * EITHER EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO NON-INFRINGEMENT,
+ * MERCHANTABILITY OR FIT FOR A PARTICULAR PURPOSE.
+ * See the Mulan PSL v2 for more details.
+ * Create: 2023-05-29
+ * Description: mq_getattr 相关接口实现
+ */
+#include "prt_mq_internal.h"
+#include "prt_hwi.h"
+
+int mq_getattr(mqd_t mqd, struct mq_attr *attr)
+{
+    uintptr_t intSave;
+    struct TagMqDes *mqDes;
+    struct TagQueCb *queueCb;
+
+    if (attr == NULL) {
+        errno = EINVAL;
+        return PTHREAD_OP_FAIL;
+    }
+
+    intSave = PRT_HwiLock();
+    mqDes = OsMqDesGet(mqd);
+    if (mqDes == NULL) {
+        PRT_HwiRestore(intSave);
+        errno = EBADF;
+        return PTHREAD_OP_FAIL;
+    }
+
+    queueCb = GET_QUEUE_HANDLE(OS_QUEUE_INNER_ID(mqDes->mqCb->queueId));
+    attr->mq_flags = (long)((U32)mqDes->oflag & O_NONBLOCK);
+    attr->mq_maxmsg = mqDes->mqCb->maxMsg;
+    attr->mq_msgsize = mqDes->mqCb->msgSize;
+    attr->mq_curmsgs = queueCb->readableCnt;
+    PRT_HwiRestore(intSave);
+
+    return OS_OK;
+}
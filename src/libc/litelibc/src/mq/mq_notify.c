@@ -0,0 +1,62 @@
+/*
+ * Copyright (c) 2022-2023 Huawei Technologies Co., Ltd. All rights reserved.
+ *
+ * UniProton is licensed under Mulan PSL v2.
+ * You can use this software according to the terms and conditions of the Mulan PSL v2.
+ * You may obtain a copy of Mulan PSL v2 at:
+ *          http://license.coscl.org.cn/MulanPSL2
+ * THIS SOFTWARE IS PROVIDED ON AN "AS IS" BASIS, WITHOUT WARRANTIES OF ANY KIND,
+ * EITHER EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO NON-INFRINGEMENT,
+ * MERCHANTABILITY OR FIT FOR A PARTICULAR PURPOSE.
+ * See the Mulan PSL v2 for more details.
+ * Create: 2023-05-29
+ * Description: mq_notify 相关接口实现
+ */
+#include "prt_mq_internal.h"
+#include "prt_hwi.h"
+
+int mq_notify(mqd_t mqd, const struct sigevent *sev)
+{
+    uintptr_t intSave;
+    struct TagMqDes *mqDes;
+    struct TagMqCb *mqCb;
+
+    if ((sev != NULL) && (sev->sigev_notify != SIGEV_NONE) && (sev->sigev_notify != SIGEV_THREAD)) {
+        /* 当前不支持信号通知 */
+        errno = EINVAL;
+        return PTHREAD_OP_FAIL;
+    }
+
+    if ((sev != NULL) && (sev->sigev_notify == SIGEV_THREAD) && (sev->sigev_notify_function == NULL)) {
+        errno = EINVAL;
+        return PTHREAD_OP_FAIL;
+    }
+
+    intSave = PRT_HwiLock();
+    mqDes = OsMqDesGet(mqd);
+    if (mqDes == NULL) {
+        PRT_HwiRestore(intSave);
+        errno = EBADF;
+        return PTHREAD_OP_FAIL;
+    }
+
+    mqCb = mqDes->mqCb;
+    /* 入参为NULL时注销已注册的通知 */
+    if (sev == NULL) {
+        mqCb->notifyReg = FALSE;
+        PRT_HwiRestore(intSave);
+        return OS_OK;
+    }
+
+    if (mqCb->notifyReg == TRUE) {
+        PRT_HwiRestore(intSave);
+        errno = EBUSY;
+        return PTHREAD_OP_FAIL;
+    }
+
+    mqCb->notify = *sev;
+    mqCb->notifyReg = TRUE;
+    PRT_HwiRestore(intSave);
+
+    return OS_OK;
+}
@@ -0,0 +1,163 @@
+/*
+ * Copyright (c) 2022-2023 Huawei Technologies Co., Ltd. All rights reserved.
+ *
+ * UniProton is licensed under Mulan PSL v2.
+ * You can use this software according to the terms and conditions of the Mulan PSL v2.
+ * You may obtain a copy of Mulan PSL v2 at:
+ *          http://license.coscl.org.cn/MulanPSL2
+ * THIS SOFTWARE IS PROVIDED ON AN "AS IS" BASIS, WITHOUT WARRANTIES OF ANY KIND,
+ * EITHER EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO NON-INFRINGEMENT,
+ * MERCHANTABILITY OR FIT FOR A PARTICULAR PURPOSE.
+ * See the Mulan PSL v2 for more details.
+ * Create: 2023-05-29
+ * Description: mq_open 相关接口实现
+ */
+#include <string.h>
+#include "prt_mq_internal.h"
+#include "prt_hwi.h"
+
+static struct TagMqCb *OsMqFind(const char *name)
+{
+    U32 i;
+
+    for (i = 0; i < OS_MQ_MAX_NUM; i++) {
+        if ((g_mqCb[i].used == TRUE) && (strcmp(g_mqCb[i].name, name) == 0)) {
+            return &g_mqCb[i];
+        }
+    }
+
+    return NULL;
+}
+
+static int OsMqDesAlloc(void)
+{
+    int i;
+
+    for (i = 0; i < OS_MQ_OPEN_MAX; i++) {
+        if (g_mqDes[i].mqCb == NULL) {
+            return i;
+        }
+    }
+
+    return PTHREAD_OP_FAIL;
+}
+
+static int OsMqCreate(const char *name, const struct mq_attr *attr, struct TagMqCb **mqCbOut)
+{
+    U32 i;
+    U32 ret;
+    U32 queueId;
+    long maxMsg = OS_MQ_DEFAULT_MAXMSG;
+    long msgSize = OS_MQ_DEFAULT_MSGSIZE;
+    struct TagMqCb *mqCb = NULL;
+
+    if (attr != NULL) {
+        if ((attr->mq_maxmsg <= 0) || (attr->mq_maxmsg >= OS_QUEUE_LINK_INVALID) ||
+            (attr->mq_msgsize <= 0) || (attr->mq_msgsize > OS_MAX_U16)) {
+            return EINVAL;
+        }
+        maxMsg = attr->mq_maxmsg;
+        msgSize = attr->mq_msgsize;
+    }
+
+    for (i = 0; i < OS_MQ_MAX_NUM; i++) {
+        if (g_mqCb[i].used == FALSE) {
+            mqCb = &g_mqCb[i];
+            break;
+        }
+    }
+    if (mqCb == NULL) {
+        return ENFILE;
+    }
+
+    ret = OsQueueCreateWithAttr((U16)maxMsg, (U16)msgSize, OS_QUEUE_ATTR_PRIO, &queueId);
+    if (ret == OS_ERRNO_QUEUE_CB_UNAVAILABLE) {
+        return ENFILE;
+    } else if (ret == OS_ERRNO_QUEUE_CREATE_NO_MEMORY) {
+        return ENOSPC;
+    } else if (ret != OS_OK) {
+        return EINVAL;
+    }
+
+    if (strncpy_s(mqCb->name, MAX_POSIX_MQ_NAME_LEN + 1, name, strlen(name) + 1) != EOK) {
+        OS_GOTO_SYS_ERROR1();
+    }
+    mqCb->queueId = queueId;
+    mqCb->refCount = 0;
+    mqCb->used = TRUE;
+    mqCb->notifyReg = FALSE;
+    mqCb->maxMsg = (U16)maxMsg;
+    mqCb->msgSize = (U16)msgSize;
+    *mqCbOut = mqCb;
+
+    return OS_OK;
+}
+
+mqd_t mq_open(const char *name, int flags, ...)
+{
+    int ret;
+    int mqd;
+    va_list arg;
+    uintptr_t intSave;
+    struct mq_attr *attr = NULL;
+    struct TagMqCb *mqCb;
+
+    if (name == NULL) {
+        errno = EINVAL;
+        return (mqd_t)PTHREAD_OP_FAIL;
+    }
+
+    if (strlen(name) == 0) {
+        errno = EINVAL;
+        return (mqd_t)PTHREAD_OP_FAIL;
+    }
+
+    if (strlen(name) > MAX_POSIX_MQ_NAME_LEN) {
+        errno = ENAMETOOLONG;
+        return (mqd_t)PTHREAD_OP_FAIL;
+    }
+
+    if (((U32)flags & O_CREAT) != 0) {
+        va_start(arg, flags);
+        (void)va_arg(arg, unsigned int);
+        attr = va_arg(arg, struct mq_attr *);
+        va_end(arg);
+    }
+
+    intSave = PRT_HwiLock();
+    mqd = OsMqDesAlloc();
+    if (mqd == PTHREAD_OP_FAIL) {
+        PRT_HwiRestore(intSave);
+        errno = EMFILE;
+        return (mqd_t)PTHREAD_OP_FAIL;
+    }
+
+    mqCb = OsMqFind(name);
+    if (mqCb != NULL) {
+        if (((U32)flags & (O_EXCL | O_CREAT)) == (O_EXCL | O_CREAT)) {
+            PRT_HwiRestore(intSave);
+            errno = EEXIST;
+            return (mqd_t)PTHREAD_OP_FAIL;
+        }
+    } else {
+        if (((U32)flags & O_CREAT) == 0) {
+            PRT_HwiRestore(intSave);
+            errno = ENOENT;
+            return (mqd_t)PTHREAD_OP_FAIL;
+        }
+
+        ret = OsMqCreate(name, attr, &mqCb);
+        if (ret != OS_OK) {
+            PRT_HwiRestore(intSave);
+            errno = ret;
+            return (mqd_t)PTHREAD_OP_FAIL;
+        }
+    }
+
+    mqCb->refCount++;
+    g_mqDes[mqd].mqCb = mqCb;
+    g_mqDes[mqd].oflag = flags;
+    PRT_HwiRestore(intSave);
+
+    return (mqd_t)mqd;
+}
@@ -0,0 +1,45 @@
+/*
+ * Copyright (c) 2022-2023 Huawei Technologies Co., Ltd. All rights reserved.
+ *
+ * UniProton is licensed under Mulan PSL v2.
+ * You can use this software according to the terms and conditions of the Mulan PSL v2.
+ * You may obtain a copy of Mulan PSL v2 at:
+ *          http://license.coscl.org.cn/MulanPSL2
+ * THIS SOFTWARE IS PROVIDED ON AN "AS IS" BASIS, WITHOUT WARRANTIES OF ANY KIND,
+ * EITHER EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO NON-INFRINGEMENT,
+ * MERCHANTABILITY OR FIT FOR A PARTICULAR PURPOSE.
+ * See the Mulan PSL v2 for more details.
+ * Create: 2023-05-29
+ * Description: mq_setattr 相关接口实现
+ */
+#include "prt_mq_internal.h"
+#include "prt_hwi.h"
+
+int mq_setattr(mqd_t mqd, const struct mq_attr *__restrict new, struct mq_attr *__restrict old)
+{
+    uintptr_t intSave;
+    struct TagMqDes *mqDes;
+
+    if (new == NULL) {
+        errno = EINVAL;
+        return PTHREAD_OP_FAIL;
+    }
+
+    if (old != NULL && mq_getattr(mqd, old) != OS_OK) {
+        return PTHREAD_OP_FAIL;
+    }
+
+    intSave = PRT_HwiLock();
+    mqDes = OsMqDesGet(mqd);
+    if (mqDes == NULL) {
+        PRT_HwiRestore(intSave);
+        errno = EBADF;
+        return PTHREAD_OP_FAIL;
+    }
+
+    /* 只有O_NONBLOCK可以修改，其余属性在创建后固定 */
+    mqDes->oflag = (int)(((U32)mqDes->oflag & ~(U32)O_NONBLOCK) | ((U32)new->mq_flags & O_NONBLOCK));
+    PRT_HwiRestore(intSave);
+
+    return OS_OK;
+}
@@ -0,0 +1,26 @@
+/*
+ * Copyright (c) 2022-2023 Huawei Technologies Co., Ltd. All rights reserved.
+ *
+ * UniProton is licensed under Mulan PSL v2.
+ * You can use this software according to the terms and conditions of the Mulan PSL v2.
+ * You may obtain a copy of Mulan PSL v2 at:
+ *          http://license.coscl.org.cn/MulanPSL2
+ * THIS SOFTWARE IS PROVIDED ON AN "AS IS" BASIS, WITHOUT WARRANTIES OF ANY KIND,
+ * EITHER EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO NON-INFRINGEMENT,
+ * MERCHANTABILITY OR FIT FOR A PARTICULAR PURPOSE.
+ * See the Mulan PSL v2 for more details.
+ * Create: 2023-05-29
+ * Description: mq_timedreceive 相关接口实现
+ */
+#include "prt_mq_internal.h"
+
+ssize_t mq_timedreceive(mqd_t mqd, char *__restrict msg, size_t len, unsigned *__restrict prio,
+    const struct timespec *__restrict at)
+{
+    if (at == NULL) {
+        errno = EINVAL;
+        return PTHREAD_OP_FAIL;
+    }
+
+    return OsMqReceive(mqd, msg, len, prio, at);
+}
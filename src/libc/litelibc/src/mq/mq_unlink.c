@@ -0,0 +1,56 @@
+/*
+ * Copyright (c) 2022-2023 Huawei Technologies Co., Ltd. All rights reserved.
+ *
+ * UniProton is licensed under Mulan PSL v2.
+ * You can use this software according to the terms and conditions of the Mulan PSL v2.
+ * You may obtain a copy of Mulan PSL v2 at:
+ *          http://license.coscl.org.cn/MulanPSL2
+ * THIS SOFTWARE IS PROVIDED ON AN "AS IS" BASIS, WITHOUT WARRANTIES OF ANY KIND,
+ * EITHER EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO NON-INFRINGEMENT,
+ * MERCHANTABILITY OR FIT FOR A PARTICULAR PURPOSE.
+ * See the Mulan PSL v2 for more details.
+ * Create: 2023-05-29
+ * Description: mq_unlink 相关接口实现
+ */
+#include <string.h>
+#include "prt_mq_internal.h"
+#include "prt_hwi.h"
+
+int mq_unlink(const char *name)
+{
+    U32 i;
+    uintptr_t intSave;
+    struct TagMqCb *mqCb = NULL;
+
+    if (name == NULL) {
+        errno = EINVAL;
+        return PTHREAD_OP_FAIL;
+    }
+
+    if (strlen(name) > MAX_POSIX_MQ_NAME_LEN) {
+        errno = ENAMETOOLONG;
+        return PTHREAD_OP_FAIL;
+    }
+
+    intSave = PRT_HwiLock();
+    for (i = 0; i < OS_MQ_MAX_NUM; i++) {
+        if ((g_mqCb[i].used == TRUE) && (strcmp(g_mqCb[i].name, name) == 0)) {
+            mqCb = &g_mqCb[i];
+            break;
+        }
+    }
+    if (mqCb == NULL) {
+        PRT_HwiRestore(intSave);
+        errno = ENOENT;
+        return PTHREAD_OP_FAIL;
+    }
+
+    /* 清除名字后该消息队列不能再被打开，仍被打开时延迟到最后一次mq_close删除 */
+    (void)memset_s(mqCb->name, MAX_POSIX_MQ_NAME_LEN + 1, 0, MAX_POSIX_MQ_NAME_LEN + 1);
+    if (mqCb->refCount == 0) {
+        OsMqDelete(mqCb);
+    }
+    PRT_HwiRestore(intSave);
+
+    return OS_OK;
+}
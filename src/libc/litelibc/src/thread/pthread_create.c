@@ -42,7 +42,7 @@ static U32 OsPthreadCreatParaCheck(TskHandle *newthread, const pthread_attr_t *a
 }
 
 OS_SEC_ALW_INLINE INLINE U32 OsPthreadCreateRsrcInit(U32 taskId, pthread_attr_t *attr,
-    struct TagTskCb *tskCb, uintptr_t **topStackOut, uintptr_t *curStackSize)
+    struct TagTskCb *tskCb, uintptr_t **topStackOut, uintptr_t *curStackSize, bool *painted)
 {
     U32 ret = OS_OK;
     uintptr_t *topStack = NULL;
@@ -55,18 +55,8 @@ OS_SEC_ALW_INLINE INLINE U32 OsPthreadCreateRsrcInit(U32 taskId, pthread_attr_t
         }
     }
 
-    /* 查看用户是否配置了任务栈，如没有，则进行内存申请，并标记为系统配置，如有，则标记为用户配置。 */
-    if (attr->stackaddr != 0) {
-        topStack = (void *)(attr->stackaddr);
-        tskCb->stackCfgFlg = OS_TSK_STACK_CFG_BY_USER;
-    } else {
-        topStack = OsTskMemAlloc(attr->stacksize);
-        if (topStack == NULL) {
-            ret = OS_ERRNO_TSK_NO_MEMORY;
-        } else {
-            tskCb->stackCfgFlg = OS_TSK_STACK_CFG_BY_SYS;
-        }
-    }
+    /* 查看用户是否配置了任务栈，如没有，则复用或申请系统任务栈，并标记为系统配置，如有，则标记为用户配置。 */
+    ret = OsTskStackGet(tskCb, (uintptr_t)attr->stackaddr, attr->stacksize, &topStack, painted);
     *curStackSize = attr->stacksize;
     if (ret != OS_OK) {
         return ret;
@@ -131,6 +121,7 @@ int __pthread_create(pthread_t *newthread, const pthread_attr_t *attr, void *(*t
     uintptr_t curStackSize = 0;
     struct TagTskCb *tskCb = NULL;
     pthread_attr_t attrp = {0};
+    bool painted = FALSE;
 
     ret = OsPthreadCreatParaCheck(thread, attr, threadroutine, &attrp);
     if (ret != OS_OK) {
@@ -146,13 +137,19 @@ int __pthread_create(pthread_t *newthread, const pthread_attr_t *attr, void *(*t
 
     taskId = tskCb->taskPid;
 
-    ret = OsPthreadCreateRsrcInit(taskId, &attrp, tskCb, &topStack, &curStackSize);
+    ret = OsPthreadCreateRsrcInit(taskId, &attrp, tskCb, &topStack, &curStackSize, &painted);
     if (ret != OS_OK) {
         ListAdd(&tskCb->pendList, &g_tskCbFreeList);
         OsIntRestore(intSave);
         return ENOMEM;
     }
-    OsTskStackInit(curStackSize, (uintptr_t)topStack);
+
+    if (!painted) {
+        OsIntRestore(intSave);
+        /* 控制块已从空闲链表摘除且处于未使用状态，填充栈魔术字不需要关中断 */
+        OsTskStackInit(curStackSize, (uintptr_t)topStack);
+        intSave = OsIntLock();
+    }
 
     stackPtr = OsTskContextInit(taskId, curStackSize, topStack, (uintptr_t)OsTskEntry);
 
@@ -14,7 +14,7 @@
  */
 #include <time.h>
 #include <errno.h>
-#include "prt_posix_internal.h"
+#include "prt_posix_timer_internal.h"
 
 int clock_settime(clockid_t clockId, const struct timespec *tp)
 {
@@ -26,6 +26,7 @@ int clock_settime(clockid_t clockId, const struct timespec *tp)
     switch (clockId) {
         case CLOCK_REALTIME:
             OsTimeSetRealTime(tp);
+            OsPosixTimerRealTimeChanged();
             return OS_OK;
         case CLOCK_MONOTONIC_COARSE:
         case CLOCK_REALTIME_COARSE:
@@ -14,54 +14,33 @@
  */
 #include "time.h"
 #include "signal.h"
-#include "prt_posix_internal.h"
-#include "prt_sys_external.h"
-#include "prt_timer.h"
-
-/* 封装超时处理函数 */
-static void OsTimerWrapper(TimerHandle tmrHandle, U32 arg1, U32 arg2, U32 arg3, U32 arg4)
-{
-    (void)tmrHandle;
-    (void)arg3;
-    (void)arg4;
-    void *(*sigevNotifyFunction)(union sigval) = (void *)arg1;
-
-    union sigval val = {
-        .sival_int = arg2
-    };
-
-    sigevNotifyFunction(val);
-}
+#include "prt_posix_timer_internal.h"
 
 int timer_create(clockid_t clockId, struct sigevent * restrict evp, timer_t * restrict timerId)
 {
-    U32 ret;
-    TimerHandle swtmrId;
-    struct TimerCreatePara timer = {0};
+    int ret;
 
-    if ((timerId == NULL) || (evp == NULL) || (clockId != CLOCK_REALTIME)) {
+    if ((timerId == NULL) || (evp == NULL) || ((clockId != CLOCK_REALTIME) && (clockId != CLOCK_MONOTONIC))) {
         errno = EINVAL;
         return PTHREAD_OP_FAIL;
     }
 
-    if (evp->sigev_notify != SIGEV_THREAD) { // 必须有超时处理函数
+    if ((evp->sigev_notify == SIGEV_THREAD) && (evp->sigev_notify_function == NULL)) { // 必须有超时处理函数
         errno = EINVAL;
         return PTHREAD_OP_FAIL;
     }
 
-    timer.type = OS_TIMER_SOFTWARE;
-    timer.mode = OS_TIMER_LOOP;
-    timer.interval = 1;
-    timer.timerGroupId = 0;
-    timer.callBackFunc = OsTimerWrapper;
-    timer.arg1 = (U32)evp->sigev_notify_function;
-    timer.arg2 = (U32)evp->sigev_value.sival_int;
-    ret = PRT_TimerCreate(&timer, &swtmrId);
+    /* 不支持信号，只支持线程回调及不通知 */
+    if ((evp->sigev_notify != SIGEV_THREAD) && (evp->sigev_notify != SIGEV_NONE)) {
+        errno = ENOTSUP;
+        return PTHREAD_OP_FAIL;
+    }
+
+    ret = OsPosixTimerCreate(clockId, evp, timerId);
     if (ret != OS_OK) {
-        errno = EINVAL;
+        errno = ret;
         return PTHREAD_OP_FAIL;
     }
 
-    *timerId = (timer_t)swtmrId;
     return OS_OK;
-}
\ No newline at end of file
+}
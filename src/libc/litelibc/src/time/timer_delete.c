@@ -14,17 +14,23 @@
  */
 #include <time.h>
 #include <errno.h>
-#include "prt_timer.h"
-#include "prt_posix_internal.h"
+#include "prt_posix_timer_internal.h"
 
 int timer_delete(timer_t timerId)
 {
-    U32 swtmrId = (U32)timerId;
+    int ret;
+    struct TagPosixTimer *timer = OsPosixTimerGet(timerId);
 
-    if (PRT_TimerDelete(0, swtmrId) != OS_OK) {
+    if (timer == NULL) {
         errno = EINVAL;
         return PTHREAD_OP_FAIL;
     }
 
+    ret = OsPosixTimerDelete(timer);
+    if (ret != OS_OK) {
+        errno = ret;
+        return PTHREAD_OP_FAIL;
+    }
+
     return OS_OK;
-}
\ No newline at end of file
+}
@@ -14,23 +14,17 @@
  */
 #include <time.h>
 #include <errno.h>
-#include <limits.h>
-#include "prt_timer.h"
-#include "prt_posix_internal.h"
+#include "prt_posix_timer_internal.h"
 
 int timer_getoverrun(timer_t t)
 {
-	U32 swtmrId = (U32)t;
-	U32 overrun = 0;
+	struct TagPosixTimer *timer = OsPosixTimerGet(t);
 
-	if (PRT_TimerGetOverrun(0, swtmrId, &overrun) != OS_OK) {
+	if (timer == NULL) {
 		errno = EINVAL;
 		return PTHREAD_OP_FAIL;
 	}
 
-	if (overrun >= (U8)DELAYTIMER_MAX) {
-		overrun = DELAYTIMER_MAX;
-	}
-
-	return overrun;
-}
\ No newline at end of file
+	/* 回调线程送达通知时记录，超过DELAYTIMER_MAX时已截断 */
+	return (int)timer->lastOverrun;
+}
@@ -13,9 +13,8 @@
  * Description: timer_gettime 相关接口实现
  */
 #include <time.h>
-#include "prt_posix_internal.h"
+#include "prt_posix_timer_internal.h"
 #include "prt_sys_external.h"
-#include "prt_timer.h"
 #include "prt_swtmr_external.h"
 
 #define OS_SYS_NS_PER_MS  (OS_SYS_NS_PER_SECOND / OS_SYS_MS_PER_SECOND)
@@ -29,31 +28,30 @@ void OsTimeMs2Spec(U32 expireTime, struct timespec *tp)
     tp->tv_nsec = (long)remainder * OS_SYS_NS_PER_MS;
 }
 
-int timer_gettime(timer_t timerId, struct itimerspec *value)
+static void OsTimeTick2Spec(U32 tick, struct timespec *tp)
 {
-    U32 ret;
-    U32 expireTime; // 剩余超时时间,单位ms
-    struct SwTmrInfo info;
+    /* 先乘后除，Tick频率不能整除1s时不丢失精度，U32 Tick数乘以1e9不会溢出U64 */
+    OsTimeNs2Spec(((U64)tick * OS_SYS_NS_PER_SECOND) / OsSysGetTickPerSecond(), tp);
+}
 
-    if (value == NULL) {
-        errno = EINVAL;
-        return PTHREAD_OP_FAIL;
-    }
+int timer_gettime(timer_t timerId, struct itimerspec *value)
+{
+    U32 remain;
+    U32 interval;
+    struct TagPosixTimer *timer = OsPosixTimerGet(timerId);
 
-    ret = PRT_TimerQuery(0, (TimerHandle)timerId, &expireTime);
-    if (ret != OS_OK) {
+    if ((timer == NULL) || (value == NULL)) {
         errno = EINVAL;
         return PTHREAD_OP_FAIL;
     }
 
-    ret = PRT_SwTmrInfoGet((TimerHandle)timerId, &info);
-    if (ret != OS_OK) {
+    if (OsSwTmrTickQuery(timer->swtmrId, &remain, &interval) != OS_OK) {
         errno = EINVAL;
         return PTHREAD_OP_FAIL;
     }
 
-    OsTimeMs2Spec(expireTime, &value->it_value);
-    OsTimeMs2Spec((info.mode == OS_TIMER_ONCE) ? 0 : info.interval, &value->it_interval);
+    OsTimeTick2Spec(remain, &value->it_value);
+    OsTimeTick2Spec(interval, &value->it_interval);
 
     return OS_OK;
 }
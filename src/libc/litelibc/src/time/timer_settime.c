@@ -13,19 +13,19 @@
  * Description: timer_settime 相关接口实现
  */
 #include <time.h>
-#include "prt_posix_internal.h"
+#include "prt_posix_timer_internal.h"
 #include "prt_sys_external.h"
-#include "prt_timer.h"
 #include "prt_swtmr_external.h"
 
 int timer_settime(timer_t timerId, int flags, const struct itimerspec *value, struct itimerspec *ovalue)
 {
-    U32 intSave;
-    U32 interval, expiry, ret;
-    struct TagSwTmrCtrl *swtmr;
-    (void)flags;
+    U32 interval;
+    U32 expiry;
+    uintptr_t intSave;
+    bool absArmed = FALSE;
+    struct TagPosixTimer *timer = OsPosixTimerGet(timerId);
 
-    if (value == NULL) {
+    if ((timer == NULL) || (value == NULL)) {
         errno = EINVAL;
         return PTHREAD_OP_FAIL;
     }
@@ -35,14 +35,6 @@ int timer_settime(timer_t timerId, int flags, const struct itimerspec *value, st
         return PTHREAD_OP_FAIL;
     }
 
-    expiry = OsTimeSpec2Tick(&value->it_value);
-    interval = OsTimeSpec2Tick(&value->it_interval);
-
-    if (interval != 0 && interval != expiry) {
-        errno = ENOTSUP;
-        return PTHREAD_OP_FAIL;
-    }
-
     if (ovalue) {
         if (timer_gettime(timerId, ovalue) != OS_OK) {
             errno = EINVAL;
@@ -50,29 +42,28 @@ int timer_settime(timer_t timerId, int flags, const struct itimerspec *value, st
         }
     }
 
-    ret = PRT_TimerStop(0, (TimerHandle)timerId);
-    if (ret != OS_OK && ret != OS_ERRNO_SWTMR_UNSTART) {
-        errno = EINVAL;
-        return PTHREAD_OP_FAIL;
-    }
-
     // 当 it_value = 0, 表示要停止定时器.
     if ((value->it_value.tv_sec == 0) && (value->it_value.tv_nsec == 0)) {
-        return OS_OK;
+        expiry = 0;
+    } else if (((U32)flags & TIMER_ABSTIME) != 0) {
+        expiry = OsPosixTimerAbs2Tick(timer->clockId, &value->it_value);
+        absArmed = (timer->clockId != CLOCK_MONOTONIC);
+    } else {
+        expiry = OsTimeSpec2Tick(&value->it_value);
     }
+    interval = OsTimeSpec2Tick(&value->it_interval);
 
+    /* 停止、设置首次到期时间及周期在一次关中断内完成，与clock_settime重新设置互斥 */
     intSave = PRT_HwiLock();
-    swtmr = g_swtmrCbArray + OS_SWTMR_ID_2_INDEX((TimerHandle)timerId);
-    swtmr->mode = (interval ? OS_TIMER_LOOP : OS_TIMER_ONCE);
-    swtmr->interval = (interval ? interval : expiry);
-    swtmr->idxRollNum = swtmr->interval;
-    swtmr->overrun = 0;
-    PRT_HwiRestore(intSave);
-
-    if (PRT_TimerStart(0, (TimerHandle)timerId) != OS_OK) {
+    if (OsSwTmrArm(timer->swtmrId, expiry, interval) != OS_OK) {
+        PRT_HwiRestore(intSave);
         errno = EINVAL;
         return PTHREAD_OP_FAIL;
     }
+    timer->absValue = value->it_value;
+    timer->absInterval = interval;
+    timer->absArmed = absArmed;
+    PRT_HwiRestore(intSave);
 
     return OS_OK;
-}
\ No newline at end of file
+}
@@ -15,14 +15,7 @@
 #include "prt_task_external.h"
 #include "prt_fscmem_internal.h"
 
-/* 判断初始化内存地址和大小是否为4字节对齐 */
-#define OS_MEM_GETBIT(addr) (addr & (U32)(sizeof(U32) - 1))
-
-OS_SEC_BSS struct TagMemFuncLib g_memArithAPI; /* 算法对应API */
-OS_SEC_BSS struct TagFscMemCtrl g_fscMemNodeList[OS_FSC_MEM_LAST_IDX];
-OS_SEC_BSS U32 g_fscMemBitMap = 1;
-
-OS_SEC_TEXT struct TagFscMemCtrl *OsFscMemSearch(U32 size, U32 *idx)
+OS_SEC_TEXT struct TagFscMemCtrl *OsFscMemSearch(struct TagFscMemPt *memPt, uintptr_t size, U32 *idx)
 {
     U32 staIdx;
     struct TagFscMemCtrl *currBlk = NULL;
@@ -32,11 +25,11 @@ OS_SEC_TEXT struct TagFscMemCtrl *OsFscMemSearch(U32 size, U32 *idx)
     *idx = staIdx + 1;
 
     while (TRUE) {
-        *idx = OsGetLmb1((g_fscMemBitMap << *idx) >> *idx);
+        *idx = OsFscMemGetLmb1((memPt->bitMap << *idx) >> *idx);
         if (OS_FSC_MEM_LAST_IDX <= *idx) {
             *idx = staIdx;
 
-            headBlk = &g_fscMemNodeList[*idx];
+            headBlk = &memPt->nodeList[*idx];
             currBlk = headBlk->next;
 
             /* 空闲链表非空 */
@@ -53,10 +46,10 @@ OS_SEC_TEXT struct TagFscMemCtrl *OsFscMemSearch(U32 size, U32 *idx)
             return NULL;
         }
 
-        headBlk = &g_fscMemNodeList[*idx];
+        headBlk = &memPt->nodeList[*idx];
         /* 空闲链表为空，清除BitMap标志位 */
         if (headBlk->next == headBlk) {
-            g_fscMemBitMap &= ~(OS_FSC_MEM_IDX2BIT(*idx));
+            memPt->bitMap &= ~(OS_FSC_MEM_IDX2BIT(*idx));
         } else {
             break;
         }
@@ -66,17 +59,17 @@ OS_SEC_TEXT struct TagFscMemCtrl *OsFscMemSearch(U32 size, U32 *idx)
     return currBlk;
 }
 
-OS_SEC_TEXT void *OsFscMemAllocInner(U32 mid, U32 size, uintptr_t align)
+OS_SEC_TEXT void *OsFscMemAllocInner(void *arithCtrl, uintptr_t size, uintptr_t align)
 {
+    struct TagFscMemPt *memPt = (struct TagFscMemPt *)arithCtrl;
     U32 idx;
-    U32 allocSize;
+    uintptr_t allocSize;
     U32 *blkTailMagic = NULL;
     uintptr_t usrAddr;
     struct TagFscMemCtrl *plotBlk = NULL;
     struct TagFscMemCtrl *currBlk = NULL;
     struct TagFscMemCtrl *nextBlk = NULL;
 
-    (void)mid;
     if (size == 0) {
         OS_REPORT_ERROR(OS_ERRNO_MEM_ALLOC_SIZE_ZERO);
         return NULL;
@@ -90,19 +83,21 @@ OS_SEC_TEXT void *OsFscMemAllocInner(U32 mid, U32 size, uintptr_t align)
         return NULL;
     }
 
-    currBlk = OsFscMemSearch(allocSize, &idx);
+    currBlk = OsFscMemSearch(memPt, allocSize, &idx);
     if (currBlk == NULL) {
         return NULL;
     }
 
     /* 找到足够空间的空闲链表，并对其进行分割 */
     if (OS_FSC_MEM_SZGET(currBlk) >= (allocSize + OS_FSC_MEM_MIN_SIZE)) {
-        currBlk->size -= allocSize;
-
-        /* 调整链表 */
-        if (idx != OS_FSC_MEM_SZ2IDX(currBlk->size)) {
-            OsFscMemDelete(currBlk);
-            OsFscMemInsert(currBlk, g_fscMemNodeList, &g_fscMemBitMap);
+        /* 调整链表，剩余部分仍在原链表时大小级别不变，只需更新空闲大小 */
+        if (idx != OS_FSC_MEM_SZ2IDX(currBlk->size - allocSize)) {
+            OsFscMemDelete(memPt, currBlk);
+            currBlk->size -= allocSize;
+            OsFscMemInsert(memPt, currBlk);
+        } else {
+            currBlk->size -= allocSize;
+            memPt->freeStat.freeSize -= allocSize;
         }
 
         plotBlk = (struct TagFscMemCtrl *)((uintptr_t)currBlk + (uintptr_t)currBlk->size);
@@ -111,7 +106,7 @@ OS_SEC_TEXT void *OsFscMemAllocInner(U32 mid, U32 size, uintptr_t align)
 
         currBlk = plotBlk;
     } else {
-        OsFscMemDelete(currBlk);
+        OsFscMemDelete(memPt, currBlk);
     }
 
     nextBlk = (struct TagFscMemCtrl *)((uintptr_t)currBlk + (uintptr_t)currBlk->size);
@@ -130,8 +125,9 @@ OS_SEC_TEXT void *OsFscMemAllocInner(U32 mid, U32 size, uintptr_t align)
     return (void *)usrAddr;
 }
 
-OS_SEC_TEXT U32 OsFscMemFree(void *addr)
+OS_SEC_TEXT U32 OsFscMemFree(void *arithCtrl, void *addr)
 {
+    struct TagFscMemPt *memPt = (struct TagFscMemPt *)arithCtrl;
     struct TagFscMemCtrl *prevBlk = NULL; /* 前一内存块指针 */
     struct TagFscMemCtrl *currBlk = NULL; /* 当前内存块指针 */
     struct TagFscMemCtrl *nextBlk = NULL; /* 后一内存块指针 */
@@ -158,7 +154,7 @@ OS_SEC_TEXT U32 OsFscMemFree(void *addr)
 
     /* 后一内存块未使用，当前模块释放后与其合并 */
     if (nextBlk->next != OS_FSC_MEM_MAGIC_USED) {
-        OsFscMemDelete(nextBlk);
+        OsFscMemDelete(memPt, nextBlk);
 
         currBlk->size += nextBlk->size;
 
@@ -170,9 +166,9 @@ OS_SEC_TEXT U32 OsFscMemFree(void *addr)
     /* 前一内存块未使用，当前内存模块与其合并 */
     if (currBlk->prevSize != 0) {
         prevBlk = (struct TagFscMemCtrl *)((uintptr_t)currBlk - (uintptr_t)currBlk->prevSize);
-        prevBlk->size += currBlk->size;
+        OsFscMemDelete(memPt, prevBlk);
 
-        OsFscMemDelete(prevBlk);
+        prevBlk->size += currBlk->size;
 
         if (memset_s(currBlk, sizeof(struct TagFscMemCtrl), 0, sizeof(struct TagFscMemCtrl)) != EOK) {
             OS_GOTO_SYS_ERROR1();
@@ -181,7 +177,7 @@ OS_SEC_TEXT U32 OsFscMemFree(void *addr)
     }
 
     /* 合并后的总内存块插入链表 */
-    OsFscMemInsert(currBlk, g_fscMemNodeList, &g_fscMemBitMap);
+    OsFscMemInsert(memPt, currBlk);
 
     nextBlk = (struct TagFscMemCtrl *)((uintptr_t)currBlk + (uintptr_t)currBlk->size);
     nextBlk->prevSize = currBlk->size;
@@ -189,46 +185,94 @@ OS_SEC_TEXT U32 OsFscMemFree(void *addr)
     return OS_OK;
 }
 
-OS_SEC_TEXT void *OsMemAlloc(enum MoudleId mid, U8 ptNo, U32 size)
+/*
+ * 描述：原地调整已使用块的大小，用户地址不变。扩大时只合并后一相邻空闲块，空间不足时返回错误由调用者重新申请；
+ *       缩小或合并后有剩余时分割出空闲块挂回链表
+ */
+OS_SEC_TEXT U32 OsFscMemResize(void *arithCtrl, void *addr, uintptr_t size)
 {
-    (void)ptNo;
-    return OsFscMemAllocInner(mid, size, OS_FSC_MEM_SIZE_ALIGN);
-}
+    struct TagFscMemPt *memPt = (struct TagFscMemPt *)arithCtrl;
+    struct TagFscMemCtrl *currBlk = NULL;
+    struct TagFscMemCtrl *nextBlk = NULL;
+    struct TagFscMemCtrl *plotBlk = NULL;
+    U32 *blkTailMagic = NULL;
+    uintptr_t newSize;
 
-OS_SEC_TEXT void *OsMemAllocAlign(U32 mid, U8 ptNo, U32 size, enum MemAlign alignPow)
-{
-    (void)ptNo;
-    if (alignPow >= MEM_ADDR_BUTT || alignPow < MEM_ADDR_ALIGN_004) {
-        OS_REPORT_ERROR(OS_ERRNO_MEM_ALLOC_ALIGNPOW_INVALID);
-        return NULL;
+    currBlk = (struct TagFscMemCtrl *)OsMemGetHeadAddr((uintptr_t)addr);
+    if ((currBlk->next != OS_FSC_MEM_MAGIC_USED) || (currBlk->size == 0)) {
+        return OS_ERRNO_MEM_FREE_SH_DAMAGED;
+    }
+
+    blkTailMagic = (U32 *)((uintptr_t)currBlk + currBlk->size - (uintptr_t)OS_FSC_MEM_TAIL_SIZE);
+    if (*blkTailMagic != OS_FSC_MEM_TAIL_MAGIC) {
+        return OS_ERRNO_MEM_OVERWRITE;
+    }
+
+    if (size >= (OS_FSC_MEM_MAXVAL - OS_FSC_MEM_USED_HEAD_SIZE - OS_FSC_MEM_TAIL_SIZE)) {
+        return OS_ERRNO_FSCMEM_ALLOC_NO_MEMORY;
     }
-    return OsFscMemAllocInner(mid, size, (1U << (U32)alignPow));
+
+    /* 用户地址已按OS_FSC_MEM_SIZE_ALIGN对齐，新块大小保持对齐 */
+    newSize = ((uintptr_t)addr - (uintptr_t)currBlk) + ALIGN(size, OS_FSC_MEM_SIZE_ALIGN) + OS_FSC_MEM_TAIL_SIZE;
+
+    nextBlk = (struct TagFscMemCtrl *)((uintptr_t)currBlk + currBlk->size);
+    if (newSize > currBlk->size) {
+        if ((nextBlk->next == OS_FSC_MEM_MAGIC_USED) || ((currBlk->size + nextBlk->size) < newSize)) {
+            return OS_ERRNO_FSCMEM_ALLOC_NO_MEMORY;
+        }
+
+        OsFscMemDelete(memPt, nextBlk);
+        currBlk->size += nextBlk->size;
+
+        if (memset_s(nextBlk, sizeof(struct TagFscMemCtrl), 0, sizeof(struct TagFscMemCtrl)) != EOK) {
+            OS_GOTO_SYS_ERROR1();
+        }
+    }
+
+    if (currBlk->size >= (newSize + OS_FSC_MEM_MIN_SIZE)) {
+        plotBlk = (struct TagFscMemCtrl *)((uintptr_t)currBlk + newSize);
+        plotBlk->size = currBlk->size - newSize;
+        plotBlk->prevSize = 0;
+        currBlk->size = newSize;
+
+        /* 分割出的空闲块与后一空闲块合并 */
+        nextBlk = (struct TagFscMemCtrl *)((uintptr_t)plotBlk + plotBlk->size);
+        if (nextBlk->next != OS_FSC_MEM_MAGIC_USED) {
+            OsFscMemDelete(memPt, nextBlk);
+            plotBlk->size += nextBlk->size;
+
+            if (memset_s(nextBlk, sizeof(struct TagFscMemCtrl), 0, sizeof(struct TagFscMemCtrl)) != EOK) {
+                OS_GOTO_SYS_ERROR1();
+            }
+        }
+
+        OsFscMemInsert(memPt, plotBlk);
+
+        nextBlk = (struct TagFscMemCtrl *)((uintptr_t)plotBlk + plotBlk->size);
+        nextBlk->prevSize = plotBlk->size;
+    } else {
+        nextBlk = (struct TagFscMemCtrl *)((uintptr_t)currBlk + currBlk->size);
+        nextBlk->prevSize = 0;
+    }
+
+    blkTailMagic = (U32 *)((uintptr_t)currBlk + currBlk->size - (uintptr_t)OS_FSC_MEM_TAIL_SIZE);
+    *blkTailMagic = OS_FSC_MEM_TAIL_MAGIC;
+
+    return OS_OK;
 }
 
 /*
- * 描述：初始化内存
+ * 描述：初始化分区的空闲链表，整个分区挂成一个空闲块
  */
-OS_SEC_TEXT U32 OsFscMemInit(U32 addr, U32 size)
+OS_SEC_TEXT U32 OsFscMemPtInit(void *arithCtrl, uintptr_t addr, uintptr_t size)
 {
     U32 idx;
+    struct TagFscMemPt *memPt = (struct TagFscMemPt *)arithCtrl;
     struct TagFscMemCtrl *headBlk = NULL;
     struct TagFscMemCtrl *currBlk = NULL;
     struct TagFscMemCtrl *nextBlk = NULL;
 
-    /* 异常判断 */
-    if ((void *)(uintptr_t)addr == NULL) {
-        return OS_ERRNO_MEM_INITADDR_ISINVALID;
-    }
-
-    if (OS_MEM_GETBIT(addr) != 0U) {
-        return OS_ERRNO_MEM_INITADDR_INVALID;
-    }
-
-    if (OS_MEM_GETBIT(size) != 0U) {
-        return OS_ERRNO_MEM_INITSIZE_INVALID;
-    }
-
-    if (size < OS_FSC_MEM_USED_HEAD_SIZE) {
+    if (size < (OS_FSC_MEM_USED_HEAD_SIZE + OS_FSC_MEM_MIN_SIZE)) {
         return OS_ERRNO_MEM_PTCREATE_SIZE_ISTOOSMALL;
     }
 
@@ -236,12 +280,16 @@ OS_SEC_TEXT U32 OsFscMemInit(U32 addr, U32 size)
         return OS_ERRNO_MEM_PTCREATE_SIZE_ISTOOBIG;
     }
 
-    if (memset_s((void *)(uintptr_t)addr, size, 0, size) != EOK) {
+#if !defined(OS_OPTION_FAST_BOOT)
+    OsMemSetDword(addr, size, 0);
+#endif
+
+    if (memset_s(&memPt->freeStat, sizeof(struct TagMemFreeStat), 0, sizeof(struct TagMemFreeStat)) != EOK) {
         OS_GOTO_SYS_ERROR1();
     }
 
     /* 链表初始化，指向自己 */
-    headBlk = &g_fscMemNodeList[0];
+    headBlk = &memPt->nodeList[0];
     for (idx = 0; idx < OS_FSC_MEM_LAST_IDX; idx++, headBlk++) {
         headBlk->prev = headBlk;
         headBlk->next = headBlk;
@@ -249,31 +297,43 @@ OS_SEC_TEXT U32 OsFscMemInit(U32 addr, U32 size)
 
     size -= OS_FSC_MEM_USED_HEAD_SIZE;
 
-    g_fscMemBitMap |= 1U << (31 - OS_FSC_MEM_LAST_IDX);
+    memPt->bitMap = OS_FSC_MEM_IDX2BIT(OS_FSC_MEM_LAST_IDX);
 
-    /* 获取索引号 */
-    idx = OS_FSC_MEM_SZ2IDX(size);
-    g_fscMemBitMap |= OS_FSC_MEM_IDX2BIT(idx);
-
-    /* 挂载链表初始化 */
-    headBlk = &g_fscMemNodeList[idx];
-    currBlk = (struct TagFscMemCtrl *)(uintptr_t)addr;
-    currBlk->next = headBlk;
+    /* 整个分区作为一个空闲块挂入链表 */
+    currBlk = (struct TagFscMemCtrl *)addr;
     currBlk->prevSize = 0;
     currBlk->size = size;
-    currBlk->prev = headBlk;
-    headBlk->next = currBlk;
-    headBlk->prev = currBlk;
+    OsFscMemInsert(memPt, currBlk);
 
     nextBlk = (struct TagFscMemCtrl *)((uintptr_t)currBlk + (uintptr_t)currBlk->size);
     nextBlk->next = OS_FSC_MEM_MAGIC_USED;
     nextBlk->size = 0;
+    /* 分区可能未清零，尾部哨兵块的控制头全部显式初始化 */
+    nextBlk->prevSize = 0;
+    nextBlk->prev = NULL;
 
-    g_memArithAPI.alloc = OsMemAlloc;
-    g_memArithAPI.allocAlign = OsMemAllocAlign;
+    return OS_OK;
+}
+
+/*
+ * 描述：注册FSC算法并创建系统缺省分区
+ */
+OS_SEC_TEXT U32 OsFscMemInit(uintptr_t addr, uintptr_t size)
+{
+    g_memArithAPI.arith = (U32)MEM_ARITH_FSC;
+    g_memArithAPI.ctrlSize = sizeof(struct TagFscMemPt);
+#if defined(OS_OPTION_FAST_BOOT)
+    /* 快速启动不在初始化时清零分区，清零申请由PRT_MemAllocZero逐块完成 */
+    g_memArithAPI.zeroInit = FALSE;
+#else
+    g_memArithAPI.zeroInit = TRUE;
+#endif
+    g_memArithAPI.alloc = OsFscMemAllocInner;
     g_memArithAPI.free = OsFscMemFree;
+    g_memArithAPI.resize = OsFscMemResize;
+    g_memArithAPI.ptInit = OsFscMemPtInit;
 
     g_osMemAlloc = OsMemAlloc;
 
-    return OS_OK;
+    return OsMemPtCreate(OS_MEM_DEFAULT_FSC_PT, addr, size, (U8)MEM_PT_ATTR_CACHEABLE);
 }
@@ -26,12 +26,19 @@
 #define OS_FSC_MEM_PREV_USED 0
 #define OS_FSC_MEM_USED_MAGIC OS_MEM_HEAD_MAGICWORD
 
-#define OS_FSC_MEM_SZ2IDX(size) (31 - OsGetLmb1((U32)(size)))
-#define OS_FSC_MEM_IDX2BIT(idx) (0x80000000UL >> (idx))
+#define OS_FSC_MEM_SZ2IDX(size) (OS_FSC_MEM_LAST_IDX - OsFscMemGetLmb1((uintptr_t)(size)))
+#define OS_FSC_MEM_IDX2BIT(idx) (((uintptr_t)1 << OS_FSC_MEM_LAST_IDX) >> (idx))
 
 #define OS_FSC_MEM_SIZE_ALIGN OS_MEM_ADDR_ALIGN
 #define OS_FSC_MEM_MIN_SIZE (OS_FSC_MEM_SLICE_HEAD_SIZE + OS_FSC_MEM_SIZE_ALIGN)
 
+/* FSC分区的算法控制块，每个分区有独立的空闲链表及位图 */
+struct TagFscMemPt {
+    struct TagMemFreeStat freeStat; /* 必须为第一个成员 */
+    struct TagFscMemCtrl nodeList[OS_FSC_MEM_LAST_IDX];
+    uintptr_t bitMap;
+};
+
 /*
  * 模块内全局变量声明
  */
@@ -40,26 +47,38 @@
  * 模块内函数声明
  */
 extern void *OsFscMemSplit(U8 ptNo, uintptr_t size, uintptr_t align,
-                           struct TagFscMemCtrl *fscFreeListHead, U32 *bitMapPtr);
+                           struct TagFscMemCtrl *fscFreeListHead, uintptr_t *bitMapPtr);
 extern U32 OsMemPtParaCheck(uintptr_t addr, uintptr_t size, uintptr_t *ptAddr);
 
 /*
  * 模块内内联函数定义
  */
-OS_SEC_ALW_INLINE INLINE void OsFscMemDelete(struct TagFscMemCtrl *currBlk)
+/* 前导零个数，调用者保证value非0 */
+OS_SEC_ALW_INLINE INLINE U32 OsFscMemGetLmb1(uintptr_t value)
+{
+    if (sizeof(uintptr_t) == sizeof(U32)) {
+        return OsGetLmb1((U32)value);
+    }
+
+    return (U32)__builtin_clzl((unsigned long)value);
+}
+
+/* 调用者保证摘出空闲链表前未修改块大小 */
+OS_SEC_ALW_INLINE INLINE void OsFscMemDelete(struct TagFscMemPt *memPt, struct TagFscMemCtrl *currBlk)
 {
+    OsMemFreeStatSub(&memPt->freeStat, currBlk->size);
+
     currBlk->next->prev = currBlk->prev;
     currBlk->prev->next = currBlk->next;
 }
 
-OS_SEC_ALW_INLINE INLINE void OsFscMemInsert(struct TagFscMemCtrl *currBlk,
-                                             struct TagFscMemCtrl *fscFreeList,
-                                             U32 *bitMapPtr)
+OS_SEC_ALW_INLINE INLINE void OsFscMemInsert(struct TagFscMemPt *memPt, struct TagFscMemCtrl *currBlk)
 {
     U32 idx = OS_FSC_MEM_SZ2IDX(currBlk->size);
-    struct TagFscMemCtrl *headBlk = &(fscFreeList[idx]);
+    struct TagFscMemCtrl *headBlk = &(memPt->nodeList[idx]);
 
-    *bitMapPtr |= OS_FSC_MEM_IDX2BIT(idx);
+    memPt->bitMap |= OS_FSC_MEM_IDX2BIT(idx);
+    OsMemFreeStatAdd(&memPt->freeStat, currBlk->size);
 
     currBlk->prev = headBlk;
     currBlk->next = headBlk->next;
@@ -25,6 +25,6 @@
 /*
  * 模块间函数声明
  */
-extern U32 OsFscMemFree(void *addr);
+extern U32 OsFscMemFree(void *arithCtrl, void *addr);
 
 #endif /* PRT_FSCMEM_EXTERNAL_H */
@@ -26,12 +26,13 @@
 #define OS_MEM_ALIGN_CHECK(value) ((value) & 0x3UL)
 
 #define OS_FSC_MEM_MAGIC_USED                               (struct TagFscMemCtrl *)0x5a5aa5a5
-#define OS_FSC_MEM_LAST_IDX                                 31
+/* 空闲链表按块大小的最高有效位划分，32位平台31个，64位平台63个，块大小上限随指针宽度扩展 */
+#define OS_FSC_MEM_LAST_IDX                                 ((U32)(sizeof(uintptr_t) * 8) - 1)
 #define OS_FSC_MEM_USED_HEAD_SIZE                           (sizeof(struct TagFscMemCtrl))
-#define OS_FSC_MEM_TAIL_SIZE                                (sizeof(U32))
+#define OS_FSC_MEM_TAIL_SIZE                                OS_MEM_ADDR_ALIGN
 
-#define OS_FSC_MEM_SZGET(currBlk)                           ((U32)(currBlk->size))
-#define OS_FSC_MEM_MAXVAL                                   ((1U << OS_FSC_MEM_LAST_IDX) - OS_FSC_MEM_SIZE_ALIGN)
+#define OS_FSC_MEM_SZGET(currBlk)                           ((uintptr_t)((currBlk)->size))
+#define OS_FSC_MEM_MAXVAL                                   (((uintptr_t)1 << OS_FSC_MEM_LAST_IDX) - OS_FSC_MEM_SIZE_ALIGN)
 
 #define OS_FSC_MEM_TAIL_MAGIC                               0xABCDDCBA
 
@@ -46,8 +47,8 @@ struct TagFscMemCtrl {
     struct TagFscMemCtrl *prev;
 };
 
-extern void *OsMemAlloc(enum MoudleId mid, U8 ptNo, U32 size);
-extern void *OsMemAllocAlign(U32 mid, U8 ptNo, U32 size, enum MemAlign alignPow);
+extern void *OsMemAlloc(enum MoudleId mid, U8 ptNo, uintptr_t size);
+extern void *OsMemAllocAlign(U32 mid, U8 ptNo, uintptr_t size, enum MemAlign alignPow);
 
 /* 对齐之后，返回地址不一定紧跟在内存头后面，需要设置返回地址与内存头之间的差值 */
 OS_SEC_ALW_INLINE INLINE void OsMemSetHeadAddr(uintptr_t usrAddr, uintptr_t ctrlAddr)
@@ -63,6 +64,31 @@ OS_SEC_ALW_INLINE INLINE void *OsMemGetHeadAddr(uintptr_t usrAddr)
 
     return (void *)(uintptr_t)((usrAddr - (uintptr_t)headOffset) - sizeof(struct TagFscMemCtrl));
 }
+/*
+ * 已使用块的prev字段首字节记录申请的模块号。用户地址紧跟块控制头时，对齐偏移存放在prev字段的末尾两个字节，
+ * 否则存放在对齐补齐的空间中，均不与首字节重叠
+ */
+OS_SEC_ALW_INLINE INLINE void OsMemSetBlkMid(struct TagFscMemCtrl *blk, U32 mid)
+{
+    *(U8 *)&blk->prev = (U8)mid;
+}
+
+OS_SEC_ALW_INLINE INLINE U32 OsMemGetBlkMid(struct TagFscMemCtrl *blk)
+{
+    return *(U8 *)&blk->prev;
+}
+
+/* 已使用块的prev字段第二个字节记录小块缓存的级别标记，0表示块不属于缓存 */
+OS_SEC_ALW_INLINE INLINE void OsMemSetBlkCls(struct TagFscMemCtrl *blk, U32 cls)
+{
+    *((U8 *)&blk->prev + 1) = (U8)cls;
+}
+
+OS_SEC_ALW_INLINE INLINE U32 OsMemGetBlkCls(struct TagFscMemCtrl *blk)
+{
+    return *((U8 *)&blk->prev + 1);
+}
+
 OS_SEC_ALW_INLINE INLINE uintptr_t OsMemSetHookAddr(uintptr_t addrress)
 {
     return LOG_ADDR_DBG(addrress);
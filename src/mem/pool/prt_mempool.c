@@ -0,0 +1,167 @@
+/*
+ * Copyright (c) 2023-2023 Huawei Technologies Co., Ltd. All rights reserved.
+ *
+ * UniProton is licensed under Mulan PSL v2.
+ * You can use this software according to the terms and conditions of the Mulan PSL v2.
+ * You may obtain a copy of Mulan PSL v2 at:
+ *          http://license.coscl.org.cn/MulanPSL2
+ * THIS SOFTWARE IS PROVIDED ON AN "AS IS" BASIS, WITHOUT WARRANTIES OF ANY KIND,
+ * EITHER EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO NON-INFRINGEMENT,
+ * MERCHANTABILITY OR FIT FOR A PARTICULAR PURPOSE.
+ * See the Mulan PSL v2 for more details.
+ * Create: 2023-06-01
+ * Description: 定长内存池实现，申请释放为无锁的出栈入栈操作，可在中断中调用
+ */
+#include "prt_mempool_internal.h"
+
+OS_SEC_ALW_INLINE INLINE struct TagMemPoolCb *OsMemPoolCbGet(MemPoolHandle poolHandle)
+{
+    struct TagMemPoolCb *poolCb = (struct TagMemPoolCb *)poolHandle;
+
+    if ((poolCb == NULL) || (poolCb->magic != OS_MEM_POOL_MAGIC)) {
+        return NULL;
+    }
+
+    return poolCb;
+}
+
+OS_SEC_L4_TEXT U32 PRT_MemPoolCreate(U8 ptNo, U32 blkSize, U32 blkNum, MemPoolHandle *poolHandle)
+{
+    U32 idx;
+    U32 blkStride;
+    U64 totalSize;
+    uintptr_t blkAddr;
+    struct TagMemPoolCb *poolCb = NULL;
+
+    if (poolHandle == NULL) {
+        return OS_ERRNO_MEM_POOL_PARA_NULL;
+    }
+
+    if ((blkSize == 0) || (blkNum == 0)) {
+        return OS_ERRNO_MEM_POOL_PARA_INVALID;
+    }
+
+    /* 空闲块的首个字复用为链表指针，块步长至少为一个指针 */
+    blkStride = (blkSize < sizeof(void *)) ? (U32)sizeof(void *) : blkSize;
+    if (blkStride > (OS_MAX_U32 - OS_MEM_ADDR_ALIGN)) {
+        return OS_ERRNO_MEM_POOL_PARA_INVALID;
+    }
+    blkStride = ALIGN(blkStride, OS_MEM_ADDR_ALIGN);
+
+    totalSize = (U64)blkStride * blkNum + OS_MEM_POOL_CB_SIZE;
+    if ((U64)(uintptr_t)totalSize != totalSize) {
+        return OS_ERRNO_MEM_POOL_PARA_INVALID;
+    }
+
+    poolCb = (struct TagMemPoolCb *)PRT_MemAlloc(OS_MID_MEM, ptNo, (uintptr_t)totalSize);
+    if (poolCb == NULL) {
+        return OS_ERRNO_MEM_POOL_NO_MEMORY;
+    }
+
+    poolCb->blkStride = blkStride;
+    poolCb->blkSize = blkSize;
+    poolCb->blkNum = blkNum;
+    poolCb->usedNum = 0;
+    poolCb->peakNum = 0;
+    poolCb->failNum = 0;
+    poolCb->blkStart = (uintptr_t)poolCb + OS_MEM_POOL_CB_SIZE;
+    poolCb->blkEnd = poolCb->blkStart + (uintptr_t)blkStride * blkNum;
+
+    /* 按地址顺序串成空闲链表 */
+    blkAddr = poolCb->blkStart;
+    for (idx = 0; idx < (blkNum - 1); idx++) {
+        *(void **)blkAddr = (void *)(blkAddr + blkStride);
+        blkAddr += blkStride;
+    }
+    *(void **)blkAddr = NULL;
+
+    poolCb->freeList = (void *)poolCb->blkStart;
+    poolCb->magic = OS_MEM_POOL_MAGIC;
+
+    *poolHandle = (MemPoolHandle)poolCb;
+
+    return OS_OK;
+}
+
+OS_SEC_L4_TEXT U32 PRT_MemPoolDelete(MemPoolHandle poolHandle)
+{
+    struct TagMemPoolCb *poolCb = OsMemPoolCbGet(poolHandle);
+
+    if (poolCb == NULL) {
+        return OS_ERRNO_MEM_POOL_HANDLE_INVALID;
+    }
+
+    if (poolCb->usedNum != 0) {
+        return OS_ERRNO_MEM_POOL_BUSY;
+    }
+
+    poolCb->magic = 0;
+
+    return PRT_MemFree(OS_MID_MEM, poolCb);
+}
+
+OS_SEC_TEXT void *PRT_MemPoolAlloc(MemPoolHandle poolHandle)
+{
+    void *blk;
+    U32 usedNum;
+    struct TagMemPoolCb *poolCb = OsMemPoolCbGet(poolHandle);
+
+    if (poolCb == NULL) {
+        return NULL;
+    }
+
+    blk = OsAtomicStackPop(&poolCb->freeList);
+    OS_TRACE(OS_TRACE_EVENT_MEM_ALLOC, poolCb->blkSize, OS_TRACE_ADDR_LO(blk), OS_TRACE_ADDR_HI(blk));
+    if (blk == NULL) {
+        (void)OsAtomicAdd32(&poolCb->failNum, 1);
+        return NULL;
+    }
+
+    usedNum = OsAtomicAdd32(&poolCb->usedNum, 1);
+    OsAtomicMax32(&poolCb->peakNum, usedNum);
+
+    return blk;
+}
+
+OS_SEC_TEXT U32 PRT_MemPoolFree(MemPoolHandle poolHandle, void *addr)
+{
+    uintptr_t offset;
+    struct TagMemPoolCb *poolCb = OsMemPoolCbGet(poolHandle);
+
+    if (poolCb == NULL) {
+        return OS_ERRNO_MEM_POOL_HANDLE_INVALID;
+    }
+
+    /* 地址低于blkStart时偏移回绕为大数，与越过池尾一并被拦截，取模前偏移已在池内 */
+    offset = (uintptr_t)addr - poolCb->blkStart;
+    if ((offset >= (poolCb->blkEnd - poolCb->blkStart)) || ((offset % poolCb->blkStride) != 0)) {
+        return OS_ERRNO_MEM_POOL_ADDR_INVALID;
+    }
+
+    OS_TRACE(OS_TRACE_EVENT_MEM_FREE, 0, OS_TRACE_ADDR_LO(addr), OS_TRACE_ADDR_HI(addr));
+    OsAtomicStackPush(&poolCb->freeList, addr);
+    (void)OsAtomicAdd32(&poolCb->usedNum, (U32)-1);
+
+    return OS_OK;
+}
+
+OS_SEC_L4_TEXT U32 PRT_MemPoolGetInfo(MemPoolHandle poolHandle, struct MemPoolInfo *info)
+{
+    struct TagMemPoolCb *poolCb = OsMemPoolCbGet(poolHandle);
+
+    if (poolCb == NULL) {
+        return OS_ERRNO_MEM_POOL_HANDLE_INVALID;
+    }
+
+    if (info == NULL) {
+        return OS_ERRNO_MEM_POOL_PARA_NULL;
+    }
+
+    info->blkSize = poolCb->blkSize;
+    info->blkNum = poolCb->blkNum;
+    info->usedNum = poolCb->usedNum;
+    info->peakNum = poolCb->peakNum;
+    info->failNum = poolCb->failNum;
+
+    return OS_OK;
+}
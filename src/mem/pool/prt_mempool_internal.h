@@ -0,0 +1,46 @@
+/*
+ * Copyright (c) 2023-2023 Huawei Technologies Co., Ltd. All rights reserved.
+ *
+ * UniProton is licensed under Mulan PSL v2.
+ * You can use this software according to the terms and conditions of the Mulan PSL v2.
+ * You may obtain a copy of Mulan PSL v2 at:
+ *          http://license.coscl.org.cn/MulanPSL2
+ * THIS SOFTWARE IS PROVIDED ON AN "AS IS" BASIS, WITHOUT WARRANTIES OF ANY KIND,
+ * EITHER EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO NON-INFRINGEMENT,
+ * MERCHANTABILITY OR FIT FOR A PARTICULAR PURPOSE.
+ * See the Mulan PSL v2 for more details.
+ * Create: 2023-06-01
+ * Description: 定长内存池模块的模块内头文件。
+ */
+#ifndef PRT_MEMPOOL_INTERNAL_H
+#define PRT_MEMPOOL_INTERNAL_H
+
+#include "prt_cpu_external.h"
+#include "prt_lib_external.h"
+#include "../prt_mem_internal.h"
+
+#define OS_MEM_POOL_MAGIC 0x504F4F4CU
+
+/* 内存池控制块，位于内存池起始处，其后为连续的定长内存块 */
+struct TagMemPoolCb {
+    /* 空闲块链表头，空闲块的首个字保存下一空闲块地址 */
+    void *freeList;
+    /* 魔术字，用于校验句柄 */
+    U32 magic;
+    /* 块步长，不小于用户块大小且按OS_MEM_ADDR_ALIGN对齐 */
+    U32 blkStride;
+    U32 blkSize;
+    U32 blkNum;
+    /* 已分配块数 */
+    volatile U32 usedNum;
+    /* 已分配块数的峰值 */
+    volatile U32 peakNum;
+    /* 池空导致的申请失败次数 */
+    volatile U32 failNum;
+    uintptr_t blkStart;
+    uintptr_t blkEnd;
+};
+
+#define OS_MEM_POOL_CB_SIZE ALIGN(sizeof(struct TagMemPoolCb), OS_MEM_ADDR_ALIGN)
+
+#endif /* PRT_MEMPOOL_INTERNAL_H */
@@ -14,27 +14,446 @@
  */
 #include "prt_mem_internal.h"
 
-OS_SEC_TEXT void *PRT_MemAlloc(U32 mid, U8 ptNo, U32 size)
+OS_SEC_BSS struct TagMemFuncLib g_memArithAPI; /* 算法对应API */
+OS_SEC_BSS struct TagMemPtCb *g_memPtList; /* 已创建的分区链表 */
+OS_SEC_BSS struct TagMemUsedStat g_memMidStat[OS_MID_BUTT]; /* 按模块号统计的已分配内存 */
+
+OS_SEC_ALW_INLINE INLINE struct TagMemPtCb *OsMemPtGet(U8 ptNo)
+{
+    struct TagMemPtCb *ptCb = g_memPtList;
+
+    while ((ptCb != NULL) && (ptCb->ptNo != ptNo)) {
+        ptCb = ptCb->next;
+    }
+
+    return ptCb;
+}
+
+/*
+ * 描述：根据内存块地址查找所属分区
+ */
+OS_SEC_ALW_INLINE INLINE struct TagMemPtCb *OsMemPtFind(uintptr_t addr)
+{
+    struct TagMemPtCb *ptCb = g_memPtList;
+
+    while ((ptCb != NULL) && ((addr < ptCb->startAddr) || (addr >= ptCb->endAddr))) {
+        ptCb = ptCb->next;
+    }
+
+    return ptCb;
+}
+
+OS_SEC_ALW_INLINE INLINE void OsMemUsedStatAdd(struct TagMemUsedStat *stat, uintptr_t blkSize)
+{
+    stat->usedSize += blkSize;
+    stat->allocCnt++;
+    if (stat->usedSize > stat->peakSize) {
+        stat->peakSize = stat->usedSize;
+    }
+}
+
+OS_SEC_ALW_INLINE INLINE void OsMemUsedStatSub(struct TagMemUsedStat *stat, uintptr_t blkSize)
+{
+    stat->usedSize -= blkSize;
+    stat->allocCnt--;
+}
+
+OS_SEC_TEXT void *OsMemAllocInner(U32 mid, U8 ptNo, uintptr_t size, uintptr_t align)
 {
     void *addr;
+    struct TagFscMemCtrl *blk = NULL;
+    struct TagMemPtCb *ptCb = OsMemPtGet(ptNo);
+
+    if (ptCb == NULL) {
+        OS_REPORT_ERROR(OS_ERRNO_MEM_PT_NOT_CREATED);
+        return NULL;
+    }
+
+    addr = g_memArithAPI.alloc(OS_MEM_PT_ARITH_CTRL(ptCb), size, align);
+    if (addr == NULL) {
+        return NULL;
+    }
+
+    /* 按块大小统计，包含块控制头及对齐补齐的开销 */
+    mid = OS_MEM_MID_INDEX(mid);
+    blk = (struct TagFscMemCtrl *)OsMemGetHeadAddr((uintptr_t)addr);
+    OsMemSetBlkMid(blk, mid);
+    OsMemSetBlkCls(blk, 0);
+    OsMemUsedStatAdd(&ptCb->usedStat, blk->size);
+    OsMemUsedStatAdd(&g_memMidStat[mid], blk->size);
+
+    if ((uintptr_t)blk < ptCb->cleanEnd) {
+        ptCb->cleanEnd = (uintptr_t)blk;
+    }
+
+    return addr;
+}
+
+OS_SEC_TEXT void *OsMemAlloc(enum MoudleId mid, U8 ptNo, uintptr_t size)
+{
+    return OsMemAllocInner((U32)mid, ptNo, size, OS_MEM_ADDR_ALIGN);
+}
+
+OS_SEC_TEXT void *OsMemAllocAlign(U32 mid, U8 ptNo, uintptr_t size, enum MemAlign alignPow)
+{
+    uintptr_t align;
+
+    if (alignPow >= MEM_ADDR_BUTT || alignPow < MEM_ADDR_ALIGN_004) {
+        OS_REPORT_ERROR(OS_ERRNO_MEM_ALLOC_ALIGNPOW_INVALID);
+        return NULL;
+    }
+
+    /* 块地址本身已按OS_MEM_ADDR_ALIGN对齐，更小的对齐要求按OS_MEM_ADDR_ALIGN处理 */
+    align = OS_MEM_ADDR_ALIGN_TYPE_TO_SIZE(alignPow);
+    if (align < OS_MEM_ADDR_ALIGN) {
+        align = OS_MEM_ADDR_ALIGN;
+    }
+
+    return OsMemAllocInner(mid, ptNo, size, align);
+}
+
+OS_SEC_TEXT U32 OsMemFree(void *addr)
+{
+    U32 ret;
+    U32 mid;
+    uintptr_t blkSize;
+    struct TagFscMemCtrl *blk = NULL;
+    struct TagMemPtCb *ptCb = NULL;
+
+    if (addr == NULL) {
+        return OS_ERRNO_MEM_FREE_ADDR_INVALID;
+    }
+
+    ptCb = OsMemPtFind((uintptr_t)addr);
+    if (ptCb == NULL) {
+        return OS_ERRNO_MEM_FREE_ADDR_INVALID;
+    }
+
+    /* 释放时块可能被合并，先记录块大小及模块号，释放成功后再更新统计 */
+    blk = (struct TagFscMemCtrl *)OsMemGetHeadAddr((uintptr_t)addr);
+    blkSize = blk->size;
+    mid = OsMemGetBlkMid(blk);
+
+    ret = g_memArithAPI.free(OS_MEM_PT_ARITH_CTRL(ptCb), addr);
+    if (ret != OS_OK) {
+        return ret;
+    }
+
+    OsMemUsedStatSub(&ptCb->usedStat, blkSize);
+    OsMemUsedStatSub(&g_memMidStat[OS_MEM_MID_INDEX(mid)], blkSize);
+
+    return OS_OK;
+}
+
+/*
+ * 描述：创建分区，分区控制块及算法控制块放在分区起始处，调用者保证已关中断
+ */
+OS_SEC_TEXT U32 OsMemPtCreate(U8 ptNo, uintptr_t addr, uintptr_t size, U8 attr)
+{
+    U32 ret;
+    uintptr_t arithAddr;
+    struct TagMemPtCb *ptCb = NULL;
+    struct TagMemPtCb *tail = NULL;
+
+    if (ptNo >= OS_MEM_PT_NUM_MAX) {
+        return OS_ERRNO_MEM_PTNO_INVALID;
+    }
+
+    if ((void *)addr == NULL) {
+        return OS_ERRNO_MEM_INITADDR_ISINVALID;
+    }
+
+    if (OS_MEM_ALIGN_CHECK(addr) != 0U) {
+        return OS_ERRNO_MEM_INITADDR_INVALID;
+    }
+
+    if (OS_MEM_ALIGN_CHECK(size) != 0U) {
+        return OS_ERRNO_MEM_INITSIZE_INVALID;
+    }
+
+    if ((addr + size) < addr) {
+        return OS_ERRNO_MEM_PTCREATE_SIZE_ISTOOBIG;
+    }
+
+    /* 算法管理的空间起始地址及大小按OS_MEM_ADDR_ALIGN对齐，保证块控制头对齐 */
+    arithAddr = ALIGN((uintptr_t)OS_MEM_PT_ARITH_CTRL(addr) + g_memArithAPI.ctrlSize, OS_MEM_ADDR_ALIGN);
+    if ((addr + size) <= arithAddr) {
+        return OS_ERRNO_MEM_PTCREATE_SIZE_ISTOOSMALL;
+    }
+
+    for (ptCb = g_memPtList; ptCb != NULL; ptCb = ptCb->next) {
+        if (ptCb->ptNo == ptNo) {
+            return OS_ERRNO_MEM_PT_ALREADY_CREATED;
+        }
+
+        if ((addr < ptCb->endAddr) && ((addr + size) > ptCb->startAddr)) {
+            return OS_ERRNO_MEM_PT_OVERLAP;
+        }
+        tail = ptCb;
+    }
+
+    ptCb = (struct TagMemPtCb *)addr;
+    ret = g_memArithAPI.ptInit(OS_MEM_PT_ARITH_CTRL(ptCb), arithAddr,
+        ((addr + size) - arithAddr) & ~(uintptr_t)(OS_MEM_ADDR_ALIGN - 1));
+    if (ret != OS_OK) {
+        return ret;
+    }
+
+    ptCb->next = NULL;
+    ptCb->startAddr = addr;
+    ptCb->endAddr = addr + size;
+    ptCb->ptNo = ptNo;
+    ptCb->arith = (U8)g_memArithAPI.arith;
+    ptCb->attr = attr;
+    ptCb->reserved = 0;
+    ptCb->totalSize = ((addr + size) - arithAddr) & ~(uintptr_t)(OS_MEM_ADDR_ALIGN - 1);
+    ptCb->usedStat.usedSize = 0;
+    ptCb->usedStat.peakSize = 0;
+    ptCb->usedStat.allocCnt = 0;
+    ptCb->cleanEnd = g_memArithAPI.zeroInit ? (arithAddr + ptCb->totalSize) : 0;
+
+    /* 按创建顺序挂在链表尾，缺省分区最先创建，查找时最先命中 */
+    if (tail == NULL) {
+        g_memPtList = ptCb;
+    } else {
+        tail->next = ptCb;
+    }
+
+    return OS_OK;
+}
+
+OS_SEC_L4_TEXT U32 PRT_MemPtCreate(struct MemPtCreate *para, U8 ptNo)
+{
+    U32 ret;
     uintptr_t intSave;
 
+    if (para == NULL) {
+        return OS_ERRNO_MEM_PTCREATE_PARA_NULL;
+    }
+
+    /* 内存算法在编译时选定，所有分区使用同一算法 */
+    if ((U32)para->arith != g_memArithAPI.arith) {
+        return OS_ERRNO_MEM_PT_ARITH_INVALID;
+    }
+
+    if ((U32)para->attr >= (U32)MEM_PT_ATTR_BUTT) {
+        return OS_ERRNO_MEM_PT_ATTR_INVALID;
+    }
+
     intSave = PRT_HwiLock();
-    addr = g_memArithAPI.alloc(mid, ptNo, size);
+    ret = OsMemPtCreate(ptNo, (uintptr_t)para->ptAddr, para->ptSize, (U8)para->attr);
     PRT_HwiRestore(intSave);
 
+    return ret;
+}
+
+#if defined(OS_OPTION_MEM_CACHE)
+OS_SEC_BSS struct TagMemCache g_memCache; /* 缺省分区的小块缓存 */
+
+OS_SEC_ALW_INLINE INLINE U32 OsMemCacheClsGet(uintptr_t size)
+{
+    if (size <= OS_MEM_CACHE_CLS_SIZE(0)) {
+        return 0;
+    }
+
+    return (OsMemSizeClass(size - 1) + 1) - OS_MEM_CACHE_MIN_LOG2;
+}
+
+OS_SEC_ALW_INLINE INLINE void OsMemCachePush(struct TagMemCacheCls *cache, void *addr)
+{
+    *(void **)addr = cache->head;
+    cache->head = addr;
+    cache->num++;
+}
+
+OS_SEC_ALW_INLINE INLINE void *OsMemCachePop(struct TagMemCacheCls *cache)
+{
+    void *addr = cache->head;
+
+    cache->head = *(void **)addr;
+    cache->num--;
+
     return addr;
 }
 
-OS_SEC_TEXT void *PRT_MemAllocAlign(U32 mid, U8 ptNo, U32 size, enum MemAlign alignPow)
+/*
+ * 描述：从后端批量申请块填充缓存，每次只为一个块进入后端临界区，缓存中的块统计到OS_MID_MEM
+ */
+OS_SEC_TEXT void OsMemCacheRefill(U32 cls)
+{
+    U32 loop;
+    void *addr;
+    uintptr_t intSave;
+    struct TagMemCacheCls *cache = &g_memCache.cls[cls];
+
+    for (loop = 0; loop < OS_MEM_CACHE_BATCH; loop++) {
+        intSave = PRT_HwiLock();
+        addr = OsMemAllocInner(OS_MID_MEM, OS_MEM_DEFAULT_FSC_PT, OS_MEM_CACHE_CLS_SIZE(cls), OS_MEM_ADDR_ALIGN);
+        if (addr != NULL) {
+            OsMemSetBlkCls((struct TagFscMemCtrl *)OsMemGetHeadAddr((uintptr_t)addr),
+                (cls + 1) | OS_MEM_CACHE_CLS_FREE);
+            OsMemCachePush(cache, addr);
+        }
+        PRT_HwiRestore(intSave);
+
+        if (addr == NULL) {
+            break;
+        }
+    }
+}
+
+/*
+ * 描述：将缓存中的块归还给后端，直到缓存块数不超过keepNum
+ */
+OS_SEC_TEXT void OsMemCacheFlush(U32 cls, U32 keepNum)
+{
+    void *addr;
+    uintptr_t intSave;
+    struct TagMemCacheCls *cache = &g_memCache.cls[cls];
+
+    while (TRUE) {
+        intSave = PRT_HwiLock();
+        if (cache->num <= keepNum) {
+            PRT_HwiRestore(intSave);
+            break;
+        }
+
+        addr = OsMemCachePop(cache);
+        OsMemSetBlkCls((struct TagFscMemCtrl *)OsMemGetHeadAddr((uintptr_t)addr), 0);
+        (void)OsMemFree(addr);
+        PRT_HwiRestore(intSave);
+    }
+}
+
+OS_SEC_TEXT void OsMemCacheDrain(void)
+{
+    U32 cls;
+
+    for (cls = 0; cls < OS_MEM_CACHE_CLS_NUM; cls++) {
+        OsMemCacheFlush(cls, 0);
+    }
+}
+
+/*
+ * 描述：从缓存申请，临界区内只摘链表头及更新统计，与后端的查找、分割无关
+ */
+OS_SEC_TEXT void *OsMemCacheAlloc(U32 mid, U32 cls)
+{
+    void *addr = NULL;
+    uintptr_t intSave;
+    struct TagFscMemCtrl *blk = NULL;
+    struct TagMemCacheCls *cache = &g_memCache.cls[cls];
+
+    if (cache->num == 0) {
+        OsMemCacheRefill(cls);
+    }
+
+    intSave = OsIntLock();
+    if (cache->num != 0) {
+        addr = OsMemCachePop(cache);
+        blk = (struct TagFscMemCtrl *)OsMemGetHeadAddr((uintptr_t)addr);
+        OsMemSetBlkCls(blk, cls + 1);
+        OsMemSetBlkMid(blk, mid);
+        OsMemUsedStatSub(&g_memMidStat[OS_MID_MEM], blk->size);
+        OsMemUsedStatAdd(&g_memMidStat[mid], blk->size);
+    }
+    OsIntRestore(intSave);
+
+    return addr;
+}
+
+/*
+ * 描述：释放到缓存，块不是从缓存申请的返回FALSE，由后端释放
+ */
+OS_SEC_TEXT bool OsMemCacheFree(void *addr, U32 *ret)
+{
+    U32 cls;
+    bool needFlush;
+    uintptr_t intSave;
+    struct TagFscMemCtrl *blk = NULL;
+    struct TagMemPtCb *ptCb = g_memPtList;
+
+    /* 缺省分区最先创建，位于分区链表头 */
+    if ((ptCb == NULL) || ((uintptr_t)addr < ptCb->startAddr) || ((uintptr_t)addr >= ptCb->endAddr) ||
+        (((uintptr_t)addr & (OS_MEM_ADDR_ALIGN - 1)) != 0)) {
+        return FALSE;
+    }
+
+    intSave = OsIntLock();
+    blk = (struct TagFscMemCtrl *)OsMemGetHeadAddr((uintptr_t)addr);
+    cls = OsMemGetBlkCls(blk);
+    if ((blk->next != OS_FSC_MEM_MAGIC_USED) || (cls == 0)) {
+        OsIntRestore(intSave);
+        return FALSE;
+    }
+
+    if ((cls & OS_MEM_CACHE_CLS_FREE) != 0) {
+        OsIntRestore(intSave);
+        *ret = OS_ERRNO_MEM_FREE_SH_DAMAGED;
+        return TRUE;
+    }
+
+    cls = (cls & OS_MEM_CACHE_CLS_MASK) - 1;
+    OsMemUsedStatSub(&g_memMidStat[OS_MEM_MID_INDEX(OsMemGetBlkMid(blk))], blk->size);
+    OsMemUsedStatAdd(&g_memMidStat[OS_MID_MEM], blk->size);
+    OsMemSetBlkMid(blk, OS_MID_MEM);
+    OsMemSetBlkCls(blk, (cls + 1) | OS_MEM_CACHE_CLS_FREE);
+    OsMemCachePush(&g_memCache.cls[cls], addr);
+    needFlush = (g_memCache.cls[cls].num > OS_MEM_CACHE_HIGH);
+    OsIntRestore(intSave);
+
+    if (needFlush) {
+        OsMemCacheFlush(cls, OS_MEM_CACHE_HIGH - OS_MEM_CACHE_BATCH);
+    }
+
+    *ret = OS_OK;
+    return TRUE;
+}
+#endif
+
+OS_SEC_TEXT void *PRT_MemAlloc(U32 mid, U8 ptNo, uintptr_t size)
+{
+    void *addr;
+    uintptr_t intSave;
+
+#if defined(OS_OPTION_MEM_CACHE)
+    if ((ptNo == OS_MEM_DEFAULT_FSC_PT) && (size != 0) && (size <= OS_MEM_CACHE_MAX_SIZE)) {
+        addr = OsMemCacheAlloc(OS_MEM_MID_INDEX(mid), OsMemCacheClsGet(size));
+        if (addr != NULL) {
+            OS_TRACE(OS_TRACE_EVENT_MEM_ALLOC, size, OS_TRACE_ADDR_LO(addr), OS_TRACE_ADDR_HI(addr));
+            return addr;
+        }
+    }
+#endif
+
+    intSave = PRT_HwiLock();
+    addr = OsMemAlloc((enum MoudleId)mid, ptNo, size);
+    PRT_HwiRestore(intSave);
+
+#if defined(OS_OPTION_MEM_CACHE)
+    /* 内存不足时缓存的空闲块可能使后端无法合并出大块，归还所有缓存后重试 */
+    if ((addr == NULL) && (ptNo == OS_MEM_DEFAULT_FSC_PT) && (size != 0)) {
+        OsMemCacheDrain();
+        intSave = PRT_HwiLock();
+        addr = OsMemAlloc((enum MoudleId)mid, ptNo, size);
+        PRT_HwiRestore(intSave);
+    }
+#endif
+
+    OS_TRACE(OS_TRACE_EVENT_MEM_ALLOC, size, OS_TRACE_ADDR_LO(addr), OS_TRACE_ADDR_HI(addr));
+    return addr;
+}
+
+OS_SEC_TEXT void *PRT_MemAllocAlign(U32 mid, U8 ptNo, uintptr_t size, enum MemAlign alignPow)
 {
     void *addr;
     uintptr_t intSave;
 
     intSave = PRT_HwiLock();
-    addr = g_memArithAPI.allocAlign(mid, ptNo, size, alignPow);
+    addr = OsMemAllocAlign(mid, ptNo, size, alignPow);
     PRT_HwiRestore(intSave);
 
+    OS_TRACE(OS_TRACE_EVENT_MEM_ALLOC, size, OS_TRACE_ADDR_LO(addr), OS_TRACE_ADDR_HI(addr));
     return addr;
 }
 
@@ -44,9 +463,264 @@ OS_SEC_TEXT U32 PRT_MemFree(U32 mid, void *addr)
     uintptr_t intSave;
 
     (void)mid;
+    OS_TRACE(OS_TRACE_EVENT_MEM_FREE, 0, OS_TRACE_ADDR_LO(addr), OS_TRACE_ADDR_HI(addr));
+#if defined(OS_OPTION_MEM_CACHE)
+    if (OsMemCacheFree(addr, &ret)) {
+        return ret;
+    }
+#endif
+
     intSave = PRT_HwiLock();
-    ret = g_memArithAPI.free(addr);
+    ret = OsMemFree(addr);
     PRT_HwiRestore(intSave);
 
     return ret;
 }
+
+/*
+ * 描述：获取分区的使用统计，只复制按大小级别统计的计数，耗时与空闲块个数无关
+ */
+OS_SEC_L4_TEXT U32 PRT_MemPtGetInfo(U8 ptNo, struct MemPtInfo *info)
+{
+    U32 idx;
+    uintptr_t intSave;
+    struct TagMemPtCb *ptCb = NULL;
+    struct TagMemFreeStat *freeStat = NULL;
+
+    if (info == NULL) {
+        return OS_ERRNO_MEM_INFO_PTR_NULL;
+    }
+
+    intSave = PRT_HwiLock();
+    ptCb = OsMemPtGet(ptNo);
+    if (ptCb == NULL) {
+        PRT_HwiRestore(intSave);
+        return OS_ERRNO_MEM_PT_NOT_CREATED;
+    }
+
+    freeStat = (struct TagMemFreeStat *)OS_MEM_PT_ARITH_CTRL(ptCb);
+    info->totalSize = ptCb->totalSize;
+    info->usedSize = ptCb->usedStat.usedSize;
+    info->peakSize = ptCb->usedStat.peakSize;
+    info->allocCnt = ptCb->usedStat.allocCnt;
+    info->freeSize = freeStat->freeSize;
+    info->maxFreeClass = 0;
+    for (idx = 0; idx < OS_MEM_FREE_CLASS_NUM; idx++) {
+        info->freeBlkNum[idx] = freeStat->freeBlkNum[idx];
+        if (freeStat->freeBlkNum[idx] != 0) {
+            info->maxFreeClass = idx;
+        }
+    }
+    PRT_HwiRestore(intSave);
+
+    return OS_OK;
+}
+
+/*
+ * 描述：获取模块的内存使用统计
+ */
+OS_SEC_L4_TEXT U32 PRT_MemGetModInfo(U32 mid, struct MemModInfo *info)
+{
+    uintptr_t intSave;
+
+    if (info == NULL) {
+        return OS_ERRNO_MEM_INFO_PTR_NULL;
+    }
+
+    if (mid >= (U32)OS_MID_BUTT) {
+        return OS_ERRNO_MEM_MID_INVALID;
+    }
+
+    intSave = PRT_HwiLock();
+    info->usedSize = g_memMidStat[mid].usedSize;
+    info->peakSize = g_memMidStat[mid].peakSize;
+    info->allocCnt = g_memMidStat[mid].allocCnt;
+    PRT_HwiRestore(intSave);
+
+    return OS_OK;
+}
+
+/*
+ * 描述：申请内存并清零，分区中从未分配过的内存在初始化时已清零的，不再重复清零
+ */
+OS_SEC_TEXT void *PRT_MemAllocZero(U32 mid, U8 ptNo, uintptr_t size)
+{
+    void *addr;
+    uintptr_t cleanEnd = 0;
+    uintptr_t intSave;
+    struct TagMemPtCb *ptCb = NULL;
+    struct TagFscMemCtrl *blk = NULL;
+
+#if defined(OS_OPTION_MEM_CACHE)
+    /* 小块可能来自缓存，直接清零 */
+    if ((ptNo == OS_MEM_DEFAULT_FSC_PT) && (size != 0) && (size <= OS_MEM_CACHE_MAX_SIZE)) {
+        addr = PRT_MemAlloc(mid, ptNo, size);
+        if ((addr != NULL) && (memset_s(addr, size, 0, size) != EOK)) {
+            OS_GOTO_SYS_ERROR1();
+        }
+        return addr;
+    }
+#endif
+
+    intSave = PRT_HwiLock();
+    ptCb = OsMemPtGet(ptNo);
+    if (ptCb != NULL) {
+        cleanEnd = ptCb->cleanEnd;
+    }
+    addr = OsMemAlloc((enum MoudleId)mid, ptNo, size);
+    PRT_HwiRestore(intSave);
+
+    OS_TRACE(OS_TRACE_EVENT_MEM_ALLOC, size, OS_TRACE_ADDR_LO(addr), OS_TRACE_ADDR_HI(addr));
+    if (addr == NULL) {
+        return NULL;
+    }
+
+    /* 清零在临界区外进行，不增加关中断时间 */
+    blk = (struct TagFscMemCtrl *)OsMemGetHeadAddr((uintptr_t)addr);
+    if ((((uintptr_t)blk + blk->size) > cleanEnd) && (memset_s(addr, size, 0, size) != EOK)) {
+        OS_GOTO_SYS_ERROR1();
+    }
+
+    return addr;
+}
+
+/*
+ * 描述：按标志申请内存，按cache行对齐时大小同时补齐，保证缓冲区不与其他内存块共享cache行
+ */
+OS_SEC_TEXT void *PRT_MemAllocFlags(U32 mid, U8 ptNo, uintptr_t size, U32 flags)
+{
+    void *addr;
+    uintptr_t align = OS_MEM_ADDR_ALIGN;
+    uintptr_t intSave;
+    struct TagMemPtCb *ptCb = NULL;
+
+    if ((flags & ~OS_MEM_FLAG_MASK) != 0) {
+        OS_REPORT_ERROR(OS_ERRNO_MEM_ALLOC_FLAGS_INVALID);
+        return NULL;
+    }
+
+    if ((flags & OS_MEM_FLAG_CACHE_ALIGN) != 0) {
+        if (ALIGN(size, OS_MEM_CACHE_LINE_SIZE) < size) {
+            OS_REPORT_ERROR(OS_ERRNO_MEM_ALLOC_SIZETOOLARGE);
+            return NULL;
+        }
+        size = ALIGN(size, OS_MEM_CACHE_LINE_SIZE);
+        align = OS_MEM_CACHE_LINE_SIZE;
+    }
+
+    intSave = PRT_HwiLock();
+    ptCb = OsMemPtGet(ptNo);
+    if ((ptCb != NULL) && ((flags & OS_MEM_FLAG_NONCACHE) != 0) && (ptCb->attr != (U8)MEM_PT_ATTR_NONCACHE)) {
+        PRT_HwiRestore(intSave);
+        OS_REPORT_ERROR(OS_ERRNO_MEM_PT_ATTR_INVALID);
+        return NULL;
+    }
+
+    addr = OsMemAllocInner(mid, ptNo, size, align);
+    PRT_HwiRestore(intSave);
+
+    OS_TRACE(OS_TRACE_EVENT_MEM_ALLOC, size, OS_TRACE_ADDR_LO(addr), OS_TRACE_ADDR_HI(addr));
+    return addr;
+}
+
+/*
+ * 描述：原地调整内存块大小，调整成功时更新统计，返回OS_OK
+ */
+OS_SEC_ALW_INLINE INLINE U32 OsMemResize(struct TagMemPtCb *ptCb, void *addr, uintptr_t size)
+{
+    U32 ret;
+    uintptr_t oldSize;
+    struct TagMemUsedStat *midStat = NULL;
+    struct TagFscMemCtrl *blk = (struct TagFscMemCtrl *)OsMemGetHeadAddr((uintptr_t)addr);
+
+    /* 缓存中的块不能再被使用 */
+    if ((OsMemGetBlkCls(blk) & OS_MEM_CACHE_CLS_FREE) != 0) {
+        return OS_ERRNO_MEM_FREE_SH_DAMAGED;
+    }
+
+    oldSize = blk->size;
+    ret = g_memArithAPI.resize(OS_MEM_PT_ARITH_CTRL(ptCb), addr, size);
+    if ((ret != OS_OK) || (blk->size == oldSize)) {
+        return ret;
+    }
+
+    /* 大小改变后不再属于原缓存级别，释放时归还后端 */
+    OsMemSetBlkCls(blk, 0);
+
+    midStat = &g_memMidStat[OS_MEM_MID_INDEX(OsMemGetBlkMid(blk))];
+    if (blk->size > oldSize) {
+        ptCb->usedStat.usedSize += blk->size - oldSize;
+        midStat->usedSize += blk->size - oldSize;
+        if (ptCb->usedStat.usedSize > ptCb->usedStat.peakSize) {
+            ptCb->usedStat.peakSize = ptCb->usedStat.usedSize;
+        }
+        if (midStat->usedSize > midStat->peakSize) {
+            midStat->peakSize = midStat->usedSize;
+        }
+    } else {
+        ptCb->usedStat.usedSize -= oldSize - blk->size;
+        midStat->usedSize -= oldSize - blk->size;
+    }
+
+    return OS_OK;
+}
+
+/*
+ * 描述：调整内存块大小，优先原地扩大或缩小，后一相邻块空间不足时在原分区重新申请并拷贝
+ */
+OS_SEC_TEXT void *PRT_MemRealloc(U32 mid, void *addr, uintptr_t size)
+{
+    U32 ret;
+    U8 ptNo;
+    void *newAddr;
+    uintptr_t usrSize;
+    uintptr_t intSave;
+    struct TagMemPtCb *ptCb = NULL;
+    struct TagFscMemCtrl *blk = NULL;
+
+    if (size == 0) {
+        OS_REPORT_ERROR(OS_ERRNO_MEM_ALLOC_SIZE_ZERO);
+        return NULL;
+    }
+
+    intSave = PRT_HwiLock();
+    ptCb = (addr == NULL) ? NULL : OsMemPtFind((uintptr_t)addr);
+    if (ptCb == NULL) {
+        PRT_HwiRestore(intSave);
+        OS_REPORT_ERROR(OS_ERRNO_MEM_FREE_ADDR_INVALID);
+        return NULL;
+    }
+
+    ret = OsMemResize(ptCb, addr, size);
+    if (ret == OS_OK) {
+        PRT_HwiRestore(intSave);
+        /* 原地调整按释放后以新大小重新申请记录，解析工具据此更新块大小 */
+        OS_TRACE(OS_TRACE_EVENT_MEM_FREE, 0, OS_TRACE_ADDR_LO(addr), OS_TRACE_ADDR_HI(addr));
+        OS_TRACE(OS_TRACE_EVENT_MEM_ALLOC, size, OS_TRACE_ADDR_LO(addr), OS_TRACE_ADDR_HI(addr));
+        return addr;
+    }
+
+    if (ret != OS_ERRNO_FSCMEM_ALLOC_NO_MEMORY) {
+        PRT_HwiRestore(intSave);
+        OS_REPORT_ERROR(ret);
+        return NULL;
+    }
+
+    blk = (struct TagFscMemCtrl *)OsMemGetHeadAddr((uintptr_t)addr);
+    usrSize = ((uintptr_t)blk + blk->size - OS_FSC_MEM_TAIL_SIZE) - (uintptr_t)addr;
+    ptNo = ptCb->ptNo;
+    PRT_HwiRestore(intSave);
+
+    newAddr = PRT_MemAlloc(mid, ptNo, size);
+    if (newAddr == NULL) {
+        return NULL;
+    }
+
+    if (memcpy_s(newAddr, size, addr, (usrSize < size) ? usrSize : size) != EOK) {
+        OS_GOTO_SYS_ERROR1();
+    }
+
+    (void)PRT_MemFree(mid, addr);
+
+    return newAddr;
+}
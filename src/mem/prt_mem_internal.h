@@ -19,28 +19,125 @@
 #include "prt_attr_external.h"
 #include "prt_lib_external.h"
 #include "prt_cpu_external.h"
+#include "prt_trace_external.h"
 
 /*
  * 模块内宏定义
  */
 #define OS_MEM_ADDR_ALIGN_TYPE_TO_SIZE(size) (0x1UL << (U32)(size))
 
-/* 申请一个内存块 */
-typedef void *(*MemAllocFunc)(enum MoudleId mid, U8 ptNo, U32 size);
+/* 分区号上限，分区控制块按链表组织，不占用按分区数预留的静态空间 */
+#define OS_MEM_PT_NUM_MAX (OS_MAX_PT_NUM + OS_MEM_DEFAULT_PTNUM)
 
-/* 申请size字节并返回指向已分配内存的指针，内存地址将按照alignPow动态对齐 */
-typedef void *(*MemAllocAlignFunc)(U32 mid, U8 ptNo, U32 size, enum MemAlign alignPow);
+/* 模块号超出范围的申请统计到OS_MID_APP */
+#define OS_MEM_MID_INDEX(mid) (((U32)(mid) < (U32)OS_MID_BUTT) ? (U32)(mid) : (U32)OS_MID_APP)
 
-/* 释放一个内存块  */
-typedef U32 (*MemFreeFunc)(void *addr);
+/* 块控制头中的级别标记为级别加1，缓存中的空闲块再置上OS_MEM_CACHE_CLS_FREE，用于检测重复释放 */
+#define OS_MEM_CACHE_CLS_FREE 0x80U
+#define OS_MEM_CACHE_CLS_MASK 0x7fU
+
+#if defined(OS_OPTION_MEM_CACHE)
+/* 缓存的用户大小级别为16、32、64、128、256字节，只缓存缺省分区中按缺省对齐申请的小块 */
+#define OS_MEM_CACHE_MIN_LOG2 4U
+#define OS_MEM_CACHE_CLS_NUM 5U
+#define OS_MEM_CACHE_MAX_SIZE ((uintptr_t)1 << (OS_MEM_CACHE_MIN_LOG2 + OS_MEM_CACHE_CLS_NUM - 1))
+#define OS_MEM_CACHE_CLS_SIZE(cls) ((uintptr_t)1 << (OS_MEM_CACHE_MIN_LOG2 + (cls)))
+
+/* 缓存为空时一次从后端申请的块数；缓存块数超过上限时一次归还给后端的块数 */
+#define OS_MEM_CACHE_BATCH 8U
+#define OS_MEM_CACHE_HIGH 32U
+
+/* 每个级别的空闲块链表，块仍是后端的已使用块，链表指针存放在用户空间的首个字中 */
+struct TagMemCacheCls {
+    void *head;
+    U32 num;
+};
+
+struct TagMemCache {
+    struct TagMemCacheCls cls[OS_MEM_CACHE_CLS_NUM];
+};
+#endif
+
+/*
+ * 空闲块统计，由算法在空闲块挂入及摘出空闲链表时更新，必须作为算法控制块的第一个成员
+ */
+struct TagMemFreeStat {
+    uintptr_t freeSize;                    /* 空闲块总大小 */
+    U32 freeBlkNum[OS_MEM_FREE_CLASS_NUM]; /* 按块大小最高有效位统计的空闲块数 */
+};
+
+/* 已分配块统计 */
+struct TagMemUsedStat {
+    uintptr_t usedSize; /* 已分配块的总大小，含块控制头 */
+    uintptr_t peakSize; /* usedSize的峰值 */
+    U32 allocCnt;       /* 已分配块数 */
+};
+
+/*
+ * 分区控制块，位于分区起始处，其后依次为算法控制块及算法管理的内存空间。
+ * 每个分区有独立的空闲链表及位图，互不影响。
+ */
+struct TagMemPtCb {
+    struct TagMemPtCb *next; /* 已创建分区链表，缺省分区在链表头 */
+    uintptr_t startAddr;     /* 分区起始地址 */
+    uintptr_t endAddr;       /* 分区结束地址(不含) */
+    U8 ptNo;                 /* 分区号 */
+    U8 arith;                /* 分区使用的内存算法 */
+    U8 attr;                 /* 分区属性 */
+    U8 reserved;
+    uintptr_t totalSize;     /* 算法管理的内存大小 */
+    struct TagMemUsedStat usedStat;
+    /*
+     * cleanEnd以下的内存从未分配过。初始化时清零分区的算法从空闲块高地址端分割，
+     * 完全位于cleanEnd以下的新块内容仍为0，其他算法cleanEnd为0
+     */
+    uintptr_t cleanEnd;
+};
+
+/* 分区对应的算法控制块 */
+#define OS_MEM_PT_ARITH_CTRL(ptCb) ((void *)ALIGN((uintptr_t)(ptCb) + sizeof(struct TagMemPtCb), OS_MEM_ADDR_ALIGN))
+
+/* 在分区中申请一个内存块，内存地址按align对齐 */
+typedef void *(*MemAllocFunc)(void *arithCtrl, uintptr_t size, uintptr_t align);
+
+/* 释放一个内存块 */
+typedef U32 (*MemFreeFunc)(void *arithCtrl, void *addr);
+
+/* 原地调整已使用块的大小，用户地址不变，无法原地调整时返回错误 */
+typedef U32 (*MemResizeFunc)(void *arithCtrl, void *addr, uintptr_t size);
+
+/* 初始化分区的算法控制块，addr及size为算法可管理的内存空间 */
+typedef U32 (*MemPtInitFunc)(void *arithCtrl, uintptr_t addr, uintptr_t size);
 
 struct TagMemFuncLib {
-    void *addr;        /* 分区起始地址 */
-    MemAllocFunc alloc; /* 申请一个内存块 */
-    MemAllocAlignFunc allocAlign; /* 申请size字节并返回指向已分配内存的指针，内存地址将按照alignPow动态对齐 */
-    MemFreeFunc free;   /* 释放一个内存块 */
+    U32 arith;           /* 内存算法类型 */
+    U32 ctrlSize;        /* 每个分区的算法控制块大小 */
+    bool zeroInit;       /* 初始化分区时是否清零整个分区 */
+    MemAllocFunc alloc;  /* 申请一个内存块 */
+    MemFreeFunc free;    /* 释放一个内存块 */
+    MemResizeFunc resize; /* 原地调整内存块大小 */
+    MemPtInitFunc ptInit; /* 初始化分区 */
 };
 
 extern struct TagMemFuncLib g_memArithAPI; /* 算法对应API */
 
+extern U32 OsMemPtCreate(U8 ptNo, uintptr_t addr, uintptr_t size, U8 attr);
+
+OS_SEC_ALW_INLINE INLINE U32 OsMemSizeClass(uintptr_t size)
+{
+    return (OS_MEM_FREE_CLASS_NUM - 1) - (U32)__builtin_clzl((unsigned long)size);
+}
+
+OS_SEC_ALW_INLINE INLINE void OsMemFreeStatAdd(struct TagMemFreeStat *stat, uintptr_t size)
+{
+    stat->freeSize += size;
+    stat->freeBlkNum[OsMemSizeClass(size)]++;
+}
+
+OS_SEC_ALW_INLINE INLINE void OsMemFreeStatSub(struct TagMemFreeStat *stat, uintptr_t size)
+{
+    stat->freeSize -= size;
+    stat->freeBlkNum[OsMemSizeClass(size)]--;
+}
+
 #endif /* PRT_MEM_INTERNAL_H */
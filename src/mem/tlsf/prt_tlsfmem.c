@@ -0,0 +1,338 @@
+/*
+ * Copyright (c) 2023-2023 Huawei Technologies Co., Ltd. All rights reserved.
+ *
+ * UniProton is licensed under Mulan PSL v2.
+ * You can use this software according to the terms and conditions of the Mulan PSL v2.
+ * You may obtain a copy of Mulan PSL v2 at:
+ *          http://license.coscl.org.cn/MulanPSL2
+ * THIS SOFTWARE IS PROVIDED ON AN "AS IS" BASIS, WITHOUT WARRANTIES OF ANY KIND,
+ * EITHER EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO NON-INFRINGEMENT,
+ * MERCHANTABILITY OR FIT FOR A PARTICULAR PURPOSE.
+ * See the Mulan PSL v2 for more details.
+ * Create: 2023-06-01
+ * Description: TLSF(两级分离适配)内存实现，申请和释放均为常数时间
+ */
+#include "prt_task_external.h"
+#include "prt_tlsfmem_internal.h"
+
+OS_SEC_ALW_INLINE INLINE void OsTlsfMemInsert(struct TagTlsfMemCtrl *tlsfCtrl, struct TagFscMemCtrl *currBlk)
+{
+    U32 fl;
+    U32 sl;
+    struct TagFscMemCtrl *headBlk = NULL;
+
+    OsTlsfMappingInsert(currBlk->size, &fl, &sl);
+    headBlk = tlsfCtrl->freeList[fl][sl];
+
+    currBlk->prev = NULL;
+    currBlk->next = headBlk;
+    if (headBlk != NULL) {
+        headBlk->prev = currBlk;
+    }
+    tlsfCtrl->freeList[fl][sl] = currBlk;
+
+    tlsfCtrl->flBitMap |= OS_TLSF_IDX2BIT(fl);
+    tlsfCtrl->slBitMap[fl] |= OS_TLSF_IDX2BIT(sl);
+
+    OsMemFreeStatAdd(&tlsfCtrl->freeStat, currBlk->size);
+}
+
+OS_SEC_ALW_INLINE INLINE void OsTlsfMemDelete(struct TagTlsfMemCtrl *tlsfCtrl, struct TagFscMemCtrl *currBlk)
+{
+    U32 fl;
+    U32 sl;
+
+    OsMemFreeStatSub(&tlsfCtrl->freeStat, currBlk->size);
+
+    if (currBlk->next != NULL) {
+        currBlk->next->prev = currBlk->prev;
+    }
+
+    if (currBlk->prev != NULL) {
+        currBlk->prev->next = currBlk->next;
+        return;
+    }
+
+    /* 链表头节点，需要更新链表头及位图 */
+    OsTlsfMappingInsert(currBlk->size, &fl, &sl);
+    tlsfCtrl->freeList[fl][sl] = currBlk->next;
+    if (currBlk->next == NULL) {
+        tlsfCtrl->slBitMap[fl] &= ~OS_TLSF_IDX2BIT(sl);
+        if (tlsfCtrl->slBitMap[fl] == 0) {
+            tlsfCtrl->flBitMap &= ~OS_TLSF_IDX2BIT(fl);
+        }
+    }
+}
+
+/*
+ * 描述：查找不小于size的空闲块，只检查位图，不遍历链表
+ */
+OS_SEC_TEXT struct TagFscMemCtrl *OsTlsfMemSearch(struct TagTlsfMemCtrl *tlsfCtrl, uintptr_t size)
+{
+    U32 fl;
+    U32 sl;
+    uintptr_t slMap;
+    uintptr_t flMap;
+
+    OsTlsfMappingSearch(size, &fl, &sl);
+    if (fl >= OS_TLSF_FL_NUM) {
+        OS_REPORT_ERROR(OS_ERRNO_FSCMEM_ALLOC_NO_MEMORY);
+        return NULL;
+    }
+
+    /* 同一一级区间内下标不小于sl的二级链表 */
+    slMap = (tlsfCtrl->slBitMap[fl] << sl) >> sl;
+    if (slMap == 0) {
+        /* 更大的一级区间 */
+        fl++;
+        flMap = (fl < OS_TLSF_FL_NUM) ? ((tlsfCtrl->flBitMap << fl) >> fl) : 0;
+        if (flMap == 0) {
+            OS_REPORT_ERROR(OS_ERRNO_FSCMEM_ALLOC_NO_MEMORY);
+            return NULL;
+        }
+
+        fl = OsTlsfGetLmb1(flMap);
+        slMap = tlsfCtrl->slBitMap[fl];
+    }
+
+    sl = OsTlsfGetLmb1(slMap);
+
+    return tlsfCtrl->freeList[fl][sl];
+}
+
+OS_SEC_TEXT void *OsTlsfMemAllocInner(void *arithCtrl, uintptr_t size, uintptr_t align)
+{
+    struct TagTlsfMemCtrl *tlsfCtrl = (struct TagTlsfMemCtrl *)arithCtrl;
+    uintptr_t allocSize;
+    U32 *blkTailMagic = NULL;
+    uintptr_t usrAddr;
+    struct TagFscMemCtrl *currBlk = NULL;
+    struct TagFscMemCtrl *nextBlk = NULL;
+    struct TagFscMemCtrl *plotBlk = NULL;
+
+    if (size == 0) {
+        OS_REPORT_ERROR(OS_ERRNO_MEM_ALLOC_SIZE_ZERO);
+        return NULL;
+    }
+
+    /*
+     * 由于已经按OS_TLSF_MEM_SIZE_ALIGN字节对齐，最大可能补齐的大小是align - OS_TLSF_MEM_SIZE_ALIGN，
+     * 块大小整体按OS_TLSF_MEM_SIZE_ALIGN对齐，保证分割出的块控制头地址对齐
+     */
+    allocSize = ALIGN(ALIGN(size, OS_TLSF_MEM_SIZE_ALIGN) + (align - OS_TLSF_MEM_SIZE_ALIGN) +
+        OS_FSC_MEM_USED_HEAD_SIZE + OS_FSC_MEM_TAIL_SIZE, OS_TLSF_MEM_SIZE_ALIGN);
+    if ((allocSize < size) || allocSize >= ((OS_TLSF_MEM_MAXVAL - OS_FSC_MEM_USED_HEAD_SIZE) - OS_FSC_MEM_TAIL_SIZE)) {
+        OS_REPORT_ERROR(OS_ERRNO_MEM_ALLOC_SIZETOOLARGE);
+        return NULL;
+    }
+
+    currBlk = OsTlsfMemSearch(tlsfCtrl, allocSize);
+    if (currBlk == NULL) {
+        return NULL;
+    }
+
+    OsTlsfMemDelete(tlsfCtrl, currBlk);
+
+    /* 剩余部分足够构成一个空闲块时进行分割，剩余部分重新挂入空闲链表 */
+    if (OS_FSC_MEM_SZGET(currBlk) >= (allocSize + OS_TLSF_MEM_MIN_SIZE)) {
+        plotBlk = (struct TagFscMemCtrl *)((uintptr_t)currBlk + (uintptr_t)allocSize);
+        plotBlk->size = currBlk->size - allocSize;
+        plotBlk->prevSize = 0;
+        OsTlsfMemInsert(tlsfCtrl, plotBlk);
+
+        nextBlk = (struct TagFscMemCtrl *)((uintptr_t)plotBlk + (uintptr_t)plotBlk->size);
+        nextBlk->prevSize = plotBlk->size;
+
+        currBlk->size = allocSize;
+    } else {
+        nextBlk = (struct TagFscMemCtrl *)((uintptr_t)currBlk + (uintptr_t)currBlk->size);
+        nextBlk->prevSize = 0;
+    }
+
+    currBlk->next = OS_FSC_MEM_MAGIC_USED;
+
+    /* 设置内存越界检查魔术字 */
+    blkTailMagic = (U32 *)((uintptr_t)currBlk + (uintptr_t)currBlk->size - (uintptr_t)OS_FSC_MEM_TAIL_SIZE);
+    *blkTailMagic = OS_FSC_MEM_TAIL_MAGIC;
+
+    // currBlk->prev 复用为内存对齐的偏移地址
+    currBlk->prev = 0;
+    usrAddr = (((uintptr_t)currBlk + OS_FSC_MEM_SLICE_HEAD_SIZE + align - 1) & ~(align - 1));
+    OsMemSetHeadAddr(usrAddr, ((uintptr_t)currBlk + OS_FSC_MEM_SLICE_HEAD_SIZE));
+
+    return (void *)usrAddr;
+}
+
+OS_SEC_TEXT U32 OsTlsfMemFree(void *arithCtrl, void *addr)
+{
+    struct TagTlsfMemCtrl *tlsfCtrl = (struct TagTlsfMemCtrl *)arithCtrl;
+    struct TagFscMemCtrl *prevBlk = NULL; /* 前一内存块指针 */
+    struct TagFscMemCtrl *currBlk = NULL; /* 当前内存块指针 */
+    struct TagFscMemCtrl *nextBlk = NULL; /* 后一内存块指针 */
+    U32 *blkTailMagic = NULL;
+    uintptr_t blkSize;
+
+    if (addr == NULL) {
+        return OS_ERRNO_MEM_FREE_ADDR_INVALID;
+    }
+
+    currBlk = (struct TagFscMemCtrl *)OsMemGetHeadAddr((uintptr_t)addr);
+    blkSize = currBlk->size;
+
+    if ((currBlk->next != OS_FSC_MEM_MAGIC_USED) || (currBlk->size == 0)) {
+        return OS_ERRNO_MEM_FREE_SH_DAMAGED;
+    }
+
+    blkTailMagic = (U32 *)((uintptr_t)currBlk + blkSize - (uintptr_t)OS_FSC_MEM_TAIL_SIZE);
+    if (*blkTailMagic != OS_FSC_MEM_TAIL_MAGIC) {
+        return OS_ERRNO_MEM_OVERWRITE;
+    }
+
+    nextBlk = (struct TagFscMemCtrl *)((uintptr_t)currBlk + blkSize);
+
+    /* 后一内存块未使用，当前模块释放后与其合并 */
+    if (nextBlk->next != OS_FSC_MEM_MAGIC_USED) {
+        OsTlsfMemDelete(tlsfCtrl, nextBlk);
+        currBlk->size += nextBlk->size;
+    }
+
+    /* 前一内存块未使用，当前内存模块与其合并 */
+    if (currBlk->prevSize != 0) {
+        prevBlk = (struct TagFscMemCtrl *)((uintptr_t)currBlk - (uintptr_t)currBlk->prevSize);
+        OsTlsfMemDelete(tlsfCtrl, prevBlk);
+        prevBlk->size += currBlk->size;
+        currBlk = prevBlk;
+    }
+
+    /* 合并后的总内存块插入链表 */
+    OsTlsfMemInsert(tlsfCtrl, currBlk);
+
+    nextBlk = (struct TagFscMemCtrl *)((uintptr_t)currBlk + (uintptr_t)currBlk->size);
+    nextBlk->prevSize = currBlk->size;
+
+    return OS_OK;
+}
+
+/*
+ * 描述：原地调整已使用块的大小，用户地址不变。扩大时只合并后一相邻空闲块，空间不足时返回错误由调用者重新申请；
+ *       缩小或合并后有剩余时分割出空闲块挂回链表
+ */
+OS_SEC_TEXT U32 OsTlsfMemResize(void *arithCtrl, void *addr, uintptr_t size)
+{
+    struct TagTlsfMemCtrl *tlsfCtrl = (struct TagTlsfMemCtrl *)arithCtrl;
+    struct TagFscMemCtrl *currBlk = NULL;
+    struct TagFscMemCtrl *nextBlk = NULL;
+    struct TagFscMemCtrl *plotBlk = NULL;
+    U32 *blkTailMagic = NULL;
+    uintptr_t newSize;
+
+    currBlk = (struct TagFscMemCtrl *)OsMemGetHeadAddr((uintptr_t)addr);
+    if ((currBlk->next != OS_FSC_MEM_MAGIC_USED) || (currBlk->size == 0)) {
+        return OS_ERRNO_MEM_FREE_SH_DAMAGED;
+    }
+
+    blkTailMagic = (U32 *)((uintptr_t)currBlk + currBlk->size - (uintptr_t)OS_FSC_MEM_TAIL_SIZE);
+    if (*blkTailMagic != OS_FSC_MEM_TAIL_MAGIC) {
+        return OS_ERRNO_MEM_OVERWRITE;
+    }
+
+    if (size >= (OS_TLSF_MEM_MAXVAL - OS_FSC_MEM_USED_HEAD_SIZE - OS_FSC_MEM_TAIL_SIZE)) {
+        return OS_ERRNO_FSCMEM_ALLOC_NO_MEMORY;
+    }
+
+    newSize = ALIGN(((uintptr_t)addr - (uintptr_t)currBlk) + ALIGN(size, OS_TLSF_MEM_SIZE_ALIGN) +
+        OS_FSC_MEM_TAIL_SIZE, OS_TLSF_MEM_SIZE_ALIGN);
+
+    nextBlk = (struct TagFscMemCtrl *)((uintptr_t)currBlk + currBlk->size);
+    if (newSize > currBlk->size) {
+        if ((nextBlk->next == OS_FSC_MEM_MAGIC_USED) || ((currBlk->size + nextBlk->size) < newSize)) {
+            return OS_ERRNO_FSCMEM_ALLOC_NO_MEMORY;
+        }
+
+        OsTlsfMemDelete(tlsfCtrl, nextBlk);
+        currBlk->size += nextBlk->size;
+    }
+
+    if (currBlk->size >= (newSize + OS_TLSF_MEM_MIN_SIZE)) {
+        plotBlk = (struct TagFscMemCtrl *)((uintptr_t)currBlk + newSize);
+        plotBlk->size = currBlk->size - newSize;
+        plotBlk->prevSize = 0;
+        currBlk->size = newSize;
+
+        /* 分割出的空闲块与后一空闲块合并 */
+        nextBlk = (struct TagFscMemCtrl *)((uintptr_t)plotBlk + plotBlk->size);
+        if (nextBlk->next != OS_FSC_MEM_MAGIC_USED) {
+            OsTlsfMemDelete(tlsfCtrl, nextBlk);
+            plotBlk->size += nextBlk->size;
+        }
+
+        OsTlsfMemInsert(tlsfCtrl, plotBlk);
+
+        nextBlk = (struct TagFscMemCtrl *)((uintptr_t)plotBlk + plotBlk->size);
+        nextBlk->prevSize = plotBlk->size;
+    } else {
+        nextBlk = (struct TagFscMemCtrl *)((uintptr_t)currBlk + currBlk->size);
+        nextBlk->prevSize = 0;
+    }
+
+    blkTailMagic = (U32 *)((uintptr_t)currBlk + currBlk->size - (uintptr_t)OS_FSC_MEM_TAIL_SIZE);
+    *blkTailMagic = OS_FSC_MEM_TAIL_MAGIC;
+
+    return OS_OK;
+}
+
+/*
+ * 描述：初始化分区的位图及空闲链表，整个分区挂成一个空闲块
+ */
+OS_SEC_TEXT U32 OsTlsfMemPtInit(void *arithCtrl, uintptr_t addr, uintptr_t size)
+{
+    struct TagTlsfMemCtrl *tlsfCtrl = (struct TagTlsfMemCtrl *)arithCtrl;
+    struct TagFscMemCtrl *currBlk = NULL;
+    struct TagFscMemCtrl *nextBlk = NULL;
+
+    if (size < (OS_FSC_MEM_USED_HEAD_SIZE + OS_TLSF_MEM_MIN_SIZE)) {
+        return OS_ERRNO_MEM_PTCREATE_SIZE_ISTOOSMALL;
+    }
+
+    if (size > OS_TLSF_MEM_MAXVAL) {
+        return OS_ERRNO_MEM_PTCREATE_SIZE_ISTOOBIG;
+    }
+
+    /* TLSF只依赖块控制头及空闲链表，不需要清零整个分区 */
+    if (memset_s(tlsfCtrl, sizeof(struct TagTlsfMemCtrl), 0, sizeof(struct TagTlsfMemCtrl)) != EOK) {
+        OS_GOTO_SYS_ERROR1();
+    }
+
+    /* 分区尾部预留一个块控制头作为哨兵，标记为已使用，避免释放时越界合并 */
+    size = (size & ~(uintptr_t)(OS_TLSF_MEM_SIZE_ALIGN - 1)) - OS_FSC_MEM_USED_HEAD_SIZE;
+
+    currBlk = (struct TagFscMemCtrl *)addr;
+    currBlk->prevSize = 0;
+    currBlk->size = size;
+    OsTlsfMemInsert(tlsfCtrl, currBlk);
+
+    nextBlk = (struct TagFscMemCtrl *)((uintptr_t)currBlk + (uintptr_t)currBlk->size);
+    nextBlk->next = OS_FSC_MEM_MAGIC_USED;
+    nextBlk->size = 0;
+    nextBlk->prevSize = currBlk->size;
+
+    return OS_OK;
+}
+
+/*
+ * 描述：注册TLSF算法并创建系统缺省分区
+ */
+OS_SEC_TEXT U32 OsTlsfMemInit(uintptr_t addr, uintptr_t size)
+{
+    g_memArithAPI.arith = (U32)MEM_ARITH_TLSF;
+    g_memArithAPI.ctrlSize = sizeof(struct TagTlsfMemCtrl);
+    g_memArithAPI.zeroInit = FALSE;
+    g_memArithAPI.alloc = OsTlsfMemAllocInner;
+    g_memArithAPI.free = OsTlsfMemFree;
+    g_memArithAPI.resize = OsTlsfMemResize;
+    g_memArithAPI.ptInit = OsTlsfMemPtInit;
+
+    g_osMemAlloc = OsMemAlloc;
+
+    return OsMemPtCreate(OS_MEM_DEFAULT_FSC_PT, addr, size, (U8)MEM_PT_ATTR_CACHEABLE);
+}
@@ -0,0 +1,100 @@
+/*
+ * Copyright (c) 2023-2023 Huawei Technologies Co., Ltd. All rights reserved.
+ *
+ * UniProton is licensed under Mulan PSL v2.
+ * You can use this software according to the terms and conditions of the Mulan PSL v2.
+ * You may obtain a copy of Mulan PSL v2 at:
+ *          http://license.coscl.org.cn/MulanPSL2
+ * THIS SOFTWARE IS PROVIDED ON AN "AS IS" BASIS, WITHOUT WARRANTIES OF ANY KIND,
+ * EITHER EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO NON-INFRINGEMENT,
+ * MERCHANTABILITY OR FIT FOR A PARTICULAR PURPOSE.
+ * See the Mulan PSL v2 for more details.
+ * Create: 2023-06-01
+ * Description: TLSF内存算法模块的模块内头文件。
+ */
+#ifndef PRT_TLSFMEM_INTERNAL_H
+#define PRT_TLSFMEM_INTERNAL_H
+
+#include "prt_fscmem_external.h"
+#include "prt_cpu_external.h"
+#include "prt_lib_external.h"
+#include "../prt_mem_internal.h"
+
+/*
+ * 块控制头与FSC算法共用struct TagFscMemCtrl，已使用块的next为OS_FSC_MEM_MAGIC_USED，
+ * 空闲块的next/prev为所在空闲链表的前后节点，链表以NULL结尾。
+ */
+#define OS_TLSF_MEM_SIZE_ALIGN OS_MEM_ADDR_ALIGN
+#define OS_TLSF_MEM_ALIGN_LOG2 ((sizeof(uintptr_t) == 8) ? 3U : 2U)
+#define OS_TLSF_MEM_MIN_SIZE (OS_FSC_MEM_SLICE_HEAD_SIZE + OS_TLSF_MEM_SIZE_ALIGN)
+/* 位图按指针宽度，64位平台块大小上限扩展到2^63 */
+#define OS_TLSF_BITMAP_BITS ((U32)(sizeof(uintptr_t) * 8))
+#define OS_TLSF_MEM_MAXVAL (((uintptr_t)1 << (OS_TLSF_BITMAP_BITS - 1)) - OS_TLSF_MEM_SIZE_ALIGN)
+
+/* 二级索引个数为2的OS_TLSF_SL_LOG2次幂，每个一级区间[2^n, 2^(n+1))再等分为OS_TLSF_SL_NUM个链表 */
+#define OS_TLSF_SL_LOG2 4U
+#define OS_TLSF_SL_NUM (1U << OS_TLSF_SL_LOG2)
+
+/* 小于OS_TLSF_SMALL_SIZE的块全部放在一级索引0中，按对齐粒度线性划分二级索引 */
+#define OS_TLSF_FL_SHIFT (OS_TLSF_SL_LOG2 + OS_TLSF_MEM_ALIGN_LOG2)
+#define OS_TLSF_SMALL_SIZE ((uintptr_t)1 << OS_TLSF_FL_SHIFT)
+
+/* 块大小小于OS_TLSF_MEM_MAXVAL，最高位下标不超过OS_TLSF_BITMAP_BITS - 2 */
+#define OS_TLSF_FL_NUM (OS_TLSF_BITMAP_BITS - OS_TLSF_FL_SHIFT)
+
+/* 位图与FSC算法一致，下标idx对应最高位向低位数的第idx位，取前导零即可得到最小的非空下标 */
+#define OS_TLSF_IDX2BIT(idx) (((uintptr_t)1 << (OS_TLSF_BITMAP_BITS - 1)) >> (idx))
+
+struct TagTlsfMemCtrl {
+    /* 空闲块统计，必须为第一个成员 */
+    struct TagMemFreeStat freeStat;
+    /* 一级位图，第fl位表示slBitMap[fl]非空 */
+    uintptr_t flBitMap;
+    /* 二级位图，第sl位表示freeList[fl][sl]非空 */
+    uintptr_t slBitMap[OS_TLSF_FL_NUM];
+    /* 空闲链表头 */
+    struct TagFscMemCtrl *freeList[OS_TLSF_FL_NUM][OS_TLSF_SL_NUM];
+};
+
+/* 调用者保证value非0，使用CLZ指令保证常数时间 */
+OS_SEC_ALW_INLINE INLINE U32 OsTlsfGetLmb1(uintptr_t value)
+{
+    return (U32)__builtin_clzl((unsigned long)value);
+}
+
+/* 返回最高有效位的下标 */
+OS_SEC_ALW_INLINE INLINE U32 OsTlsfFls(uintptr_t value)
+{
+    return (OS_TLSF_BITMAP_BITS - 1) - OsTlsfGetLmb1(value);
+}
+
+/*
+ * 描述：计算块大小所在的空闲链表下标
+ */
+OS_SEC_ALW_INLINE INLINE void OsTlsfMappingInsert(uintptr_t size, U32 *fl, U32 *sl)
+{
+    U32 msb;
+
+    if (size < OS_TLSF_SMALL_SIZE) {
+        *fl = 0;
+        *sl = (U32)(size >> OS_TLSF_MEM_ALIGN_LOG2);
+    } else {
+        msb = OsTlsfFls(size);
+        *sl = (U32)(size >> (msb - OS_TLSF_SL_LOG2)) ^ OS_TLSF_SL_NUM;
+        *fl = msb - (OS_TLSF_FL_SHIFT - 1);
+    }
+}
+
+/*
+ * 描述：将申请大小向上取整到所在二级区间的上界，保证找到的链表中任意一块都能满足申请
+ */
+OS_SEC_ALW_INLINE INLINE void OsTlsfMappingSearch(uintptr_t size, U32 *fl, U32 *sl)
+{
+    if (size >= OS_TLSF_SMALL_SIZE) {
+        size += ((uintptr_t)1 << (OsTlsfFls(size) - OS_TLSF_SL_LOG2)) - 1;
+    }
+
+    OsTlsfMappingInsert(size, fl, sl);
+}
+
+#endif /* PRT_TLSFMEM_INTERNAL_H */
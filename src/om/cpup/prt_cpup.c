@@ -33,6 +33,8 @@ OS_SEC_BSS struct TagCpupThread *g_cpup;
 OS_SEC_BSS U32 g_tickCount;
 /* CPU占用率采样周期值 */
 OS_SEC_BSS U64 g_baseValue;
+/* 采样周期值的倒数因子，Tick中计算占用率时不做64位除法 */
+OS_SEC_BSS struct LibDivConst g_baseValueDiv;
 
 OS_SEC_L4_TEXT U32 OsCpupRegister(struct CpupModInfo *modInfo)
 {
@@ -33,6 +33,7 @@ extern U32 g_ticksPerSample;
 extern U32 g_cpupIndex;
 extern U32 g_tickCount;
 extern U64 g_baseValue;
+extern struct LibDivConst g_baseValueDiv;
 extern CpupNowFunc g_cpupNow;
 /* CPUP告警检测函数钩子 */
 extern CpupWarnFunc g_cpupWarnCheck;
@@ -163,7 +163,7 @@ OS_SEC_L2_TEXT void OsCpupTickCal(void)
     U32 index;
 
     for (index = 0; index < (OS_MAX_TCB_NUM - 1); index++) {
-        g_cpup[index].usage = (U16)DIV64(g_cpup[index].allTime * CPUP_USE_RATE, g_baseValue);
+        g_cpup[index].usage = (U16)OsLibDiv(g_cpup[index].allTime * CPUP_USE_RATE, &g_baseValueDiv);
         if (g_cpup[index].usage > CPUP_USE_RATE) {
             g_cpup[index].usage = CPUP_USE_RATE;
         }
@@ -171,7 +171,7 @@ OS_SEC_L2_TEXT void OsCpupTickCal(void)
 
     OsMcCpupSet(0x0U, (U32)(CPUP_USE_RATE - g_cpup[TSK_GET_INDEX(IDLE_TASK_ID)].usage));
 
-    g_cpupDelTask = (U16)DIV64(g_cpuTimeDelTask * CPUP_USE_RATE, g_baseValue);
+    g_cpupDelTask = (U16)OsLibDiv(g_cpuTimeDelTask * CPUP_USE_RATE, &g_baseValueDiv);
 }
 
 /*
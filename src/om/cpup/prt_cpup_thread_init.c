@@ -109,6 +109,9 @@ OS_SEC_L4_TEXT U32 OsCpupInit(void)
     }
 
     g_baseValue = (g_systemClock / g_tickModInfo.tickPerSecond) * (U64)g_ticksPerSample;
+    if (g_baseValue != 0) {
+        OsLibDivConstInit(&g_baseValueDiv, g_baseValue);
+    }
 
     OsCpupGlobalInit();
 
@@ -148,7 +148,7 @@ typedef U32(*OsHookChgFunc)(U32 hookType, enum HookChgType chgType);
 
 extern union TagMhookCb g_hookCb[OS_HOOK_TYPE_TOTAL];
 
-typedef void *(*MemAllocHook)(enum MoudleId mid, U8 ptNo, U32 size);
+typedef void *(*MemAllocHook)(enum MoudleId mid, U8 ptNo, uintptr_t size);
 extern MemAllocHook g_osMemAlloc;
 
 /*
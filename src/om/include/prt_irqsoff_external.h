@@ -0,0 +1,31 @@
+/*
+ * Copyright (c) 2023-2023 Huawei Technologies Co., Ltd. All rights reserved.
+ *
+ * UniProton is licensed under Mulan PSL v2.
+ * You can use this software according to the terms and conditions of the Mulan PSL v2.
+ * You may obtain a copy of Mulan PSL v2 at:
+ *          http://license.coscl.org.cn/MulanPSL2
+ * THIS SOFTWARE IS PROVIDED ON AN "AS IS" BASIS, WITHOUT WARRANTIES OF ANY KIND,
+ * EITHER EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO NON-INFRINGEMENT,
+ * MERCHANTABILITY OR FIT FOR A PARTICULAR PURPOSE.
+ * See the Mulan PSL v2 for more details.
+ * Create: 2023-06-01
+ * Description: 关中断时间统计模块的内部公共头文件
+ */
+#ifndef PRT_IRQSOFF_EXTERNAL_H
+#define PRT_IRQSOFF_EXTERNAL_H
+
+#include "prt_hwi.h"
+
+#if defined(OS_OPTION_IRQSOFF_TRACE)
+/*
+ * 由PRT_HwiLock在中断从开到关时调用，调用时中断已关闭，caller为PRT_HwiLock的返回地址
+ */
+extern void OsIrqsOffTraceLock(uintptr_t caller);
+/*
+ * 由PRT_HwiRestore/PRT_HwiUnLock在即将开中断时调用，调用时中断仍关闭，caller为其返回地址
+ */
+extern void OsIrqsOffTraceRestore(uintptr_t caller);
+#endif
+
+#endif /* PRT_IRQSOFF_EXTERNAL_H */
@@ -0,0 +1,42 @@
+/*
+ * Copyright (c) 2023-2023 Huawei Technologies Co., Ltd. All rights reserved.
+ *
+ * UniProton is licensed under Mulan PSL v2.
+ * You can use this software according to the terms and conditions of the Mulan PSL v2.
+ * You may obtain a copy of Mulan PSL v2 at:
+ *          http://license.coscl.org.cn/MulanPSL2
+ * THIS SOFTWARE IS PROVIDED ON AN "AS IS" BASIS, WITHOUT WARRANTIES OF ANY KIND,
+ * EITHER EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO NON-INFRINGEMENT,
+ * MERCHANTABILITY OR FIT FOR A PARTICULAR PURPOSE.
+ * See the Mulan PSL v2 for more details.
+ * Create: 2023-06-01
+ * Description: 内核事件跟踪模块的内部公共头文件
+ */
+#ifndef PRT_TRACE_EXTERNAL_H
+#define PRT_TRACE_EXTERNAL_H
+
+#include "prt_trace.h"
+
+#if defined(OS_OPTION_TRACE)
+extern volatile bool g_traceEnable;
+
+/*
+ * 写入一条跟踪记录，可在任意上下文调用
+ */
+extern void OsTraceRecord(U32 eventId, U32 arg0, U32 arg1, U32 arg2);
+
+/* 未开始跟踪时只增加一次读操作 */
+#define OS_TRACE(eventId, arg0, arg1, arg2)                                       \
+    do {                                                                          \
+        if (g_traceEnable) {                                                      \
+            OsTraceRecord((U32)(eventId), (U32)(arg0), (U32)(arg1), (U32)(arg2)); \
+        }                                                                         \
+    } while (0)
+
+#define OS_TRACE_ADDR_LO(addr) ((U32)(uintptr_t)(addr))
+#define OS_TRACE_ADDR_HI(addr) ((U32)((U64)(uintptr_t)(addr) >> 32))
+#else
+#define OS_TRACE(eventId, arg0, arg1, arg2)
+#endif
+
+#endif /* PRT_TRACE_EXTERNAL_H */
@@ -0,0 +1,230 @@
+/*
+ * Copyright (c) 2023-2023 Huawei Technologies Co., Ltd. All rights reserved.
+ *
+ * UniProton is licensed under Mulan PSL v2.
+ * You can use this software according to the terms and conditions of the Mulan PSL v2.
+ * You may obtain a copy of Mulan PSL v2 at:
+ *          http://license.coscl.org.cn/MulanPSL2
+ * THIS SOFTWARE IS PROVIDED ON AN "AS IS" BASIS, WITHOUT WARRANTIES OF ANY KIND,
+ * EITHER EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO NON-INFRINGEMENT,
+ * MERCHANTABILITY OR FIT FOR A PARTICULAR PURPOSE.
+ * See the Mulan PSL v2 for more details.
+ * Create: 2023-06-01
+ * Description: 关中断时间统计模块的C文件
+ */
+#include "securec.h"
+#include "prt_irqsoff_external.h"
+#include "prt_sys_external.h"
+
+/*
+ * 调用点统计表项，lockAddr为0表示空闲
+ */
+struct TagIrqsOffSite {
+    uintptr_t lockAddr;
+    uintptr_t unlockAddr;
+    U32 count;
+    U32 hist[OS_HWI_IRQSOFF_HIST_NUM];
+    U64 maxCycle;
+};
+
+struct TagIrqsOffTrace {
+    /* 是否正在统计 */
+    bool enable;
+    /* 当前是否处于被记录的关中断区间 */
+    bool active;
+    /* 当前关中断区间的调用点及开始cycle数 */
+    uintptr_t lockAddr;
+    U64 startCycle;
+    /* 统计门限 */
+    U32 thresholdUs;
+    U64 thresholdCycle;
+    /* 已使用的表项个数 */
+    U32 siteNum;
+    /* 表满后丢弃的记录次数 */
+    U32 dropped;
+};
+
+OS_SEC_BSS struct TagIrqsOffTrace g_irqsOffTrace;
+/* 以关中断调用点为键的开放寻址哈希表 */
+OS_SEC_BSS struct TagIrqsOffSite g_irqsOffSite[OS_IRQSOFF_TRACE_SITE_NUM];
+
+OS_SEC_L0_TEXT void OsIrqsOffTraceLock(uintptr_t caller)
+{
+    if (!g_irqsOffTrace.enable) {
+        return;
+    }
+
+    g_irqsOffTrace.active = TRUE;
+    g_irqsOffTrace.lockAddr = caller;
+    g_irqsOffTrace.startCycle = OsCurCycleGet64();
+}
+
+/*
+ * 描述：查找调用点对应的表项，不存在时分配新表项，表满时返回NULL
+ */
+OS_SEC_ALW_INLINE INLINE struct TagIrqsOffSite *OsIrqsOffSiteFind(uintptr_t lockAddr)
+{
+    U32 i;
+    U32 idx = (U32)(lockAddr >> 1) % OS_IRQSOFF_TRACE_SITE_NUM;
+    struct TagIrqsOffSite *site;
+
+    for (i = 0; i < OS_IRQSOFF_TRACE_SITE_NUM; i++) {
+        site = &g_irqsOffSite[idx];
+        if (site->lockAddr == lockAddr) {
+            return site;
+        }
+        if (site->lockAddr == 0) {
+            site->lockAddr = lockAddr;
+            g_irqsOffTrace.siteNum++;
+            return site;
+        }
+        idx = (idx + 1 == OS_IRQSOFF_TRACE_SITE_NUM) ? 0 : (idx + 1);
+    }
+
+    return NULL;
+}
+
+OS_SEC_L0_TEXT void OsIrqsOffTraceRestore(uintptr_t caller)
+{
+    U64 cycle;
+    U32 us;
+    U32 idx;
+    struct TagIrqsOffSite *site;
+
+    if (!g_irqsOffTrace.active) {
+        return;
+    }
+    g_irqsOffTrace.active = FALSE;
+
+    cycle = OsCurCycleGet64() - g_irqsOffTrace.startCycle;
+    if (cycle < g_irqsOffTrace.thresholdCycle) {
+        return;
+    }
+
+    site = OsIrqsOffSiteFind(g_irqsOffTrace.lockAddr);
+    if (site == NULL) {
+        g_irqsOffTrace.dropped++;
+        return;
+    }
+
+    us = (U32)OsLibMulShift(cycle, &g_sysClkConv.cycle2Us);
+    idx = OsLibLog2Bucket(us, OS_HWI_IRQSOFF_HIST_NUM);
+
+    site->count++;
+    site->hist[idx]++;
+    if (cycle > site->maxCycle) {
+        site->maxCycle = cycle;
+        site->unlockAddr = caller;
+    }
+}
+
+/*
+ * 描述：开始统计关中断时间
+ */
+OS_SEC_L4_TEXT void PRT_HwiIrqsOffTraceStart(U32 thresholdUs)
+{
+    uintptr_t intSave;
+
+    intSave = PRT_HwiLock();
+    (void)memset_s(g_irqsOffSite, sizeof(g_irqsOffSite), 0, sizeof(g_irqsOffSite));
+    g_irqsOffTrace.siteNum = 0;
+    g_irqsOffTrace.dropped = 0;
+    g_irqsOffTrace.thresholdUs = thresholdUs;
+    g_irqsOffTrace.thresholdCycle = OS_US2CYCLE((U64)thresholdUs, g_systemClock);
+    /* 当前所在的关中断区间开始时尚未记录，不参与统计 */
+    g_irqsOffTrace.active = FALSE;
+    g_irqsOffTrace.enable = TRUE;
+    PRT_HwiRestore(intSave);
+}
+
+/*
+ * 描述：停止统计关中断时间
+ */
+OS_SEC_L4_TEXT void PRT_HwiIrqsOffTraceStop(void)
+{
+    uintptr_t intSave;
+
+    intSave = PRT_HwiLock();
+    g_irqsOffTrace.enable = FALSE;
+    g_irqsOffTrace.active = FALSE;
+    PRT_HwiRestore(intSave);
+}
+
+/*
+ * 描述：在关中断下读取一个调用点的统计信息，表项空闲时返回FALSE
+ */
+OS_SEC_ALW_INLINE INLINE bool OsIrqsOffSiteRead(U32 idx, struct HwiIrqsOffSite *info)
+{
+    uintptr_t intSave;
+    struct TagIrqsOffSite *site = &g_irqsOffSite[idx];
+
+    intSave = PRT_HwiLock();
+    if (site->lockAddr == 0) {
+        PRT_HwiRestore(intSave);
+        return FALSE;
+    }
+
+    info->lockAddr = site->lockAddr;
+    info->unlockAddr = site->unlockAddr;
+    info->count = site->count;
+    info->maxUs = (U32)OsLibMulShift(site->maxCycle, &g_sysClkConv.cycle2Us);
+    (void)memcpy_s(info->hist, sizeof(info->hist), site->hist, sizeof(site->hist));
+    PRT_HwiRestore(intSave);
+
+    return TRUE;
+}
+
+/*
+ * 描述：获取关中断调用点统计信息
+ */
+OS_SEC_L4_TEXT U32 PRT_HwiIrqsOffSiteGet(U32 inNum, struct HwiIrqsOffSite *site, U32 *outNum)
+{
+    U32 idx;
+    U32 num = 0;
+
+    if ((site == NULL) || (outNum == NULL)) {
+        return OS_ERRNO_HWI_IRQSOFF_PTR_NULL;
+    }
+
+    for (idx = 0; (idx < OS_IRQSOFF_TRACE_SITE_NUM) && (num < inNum); idx++) {
+        if (OsIrqsOffSiteRead(idx, &site[num])) {
+            num++;
+        }
+    }
+
+    *outNum = num;
+    return OS_OK;
+}
+
+/*
+ * 描述：输出关中断调用点统计信息
+ */
+OS_SEC_L4_TEXT U32 PRT_HwiIrqsOffDump(HwiIrqsOffPrintFunc print)
+{
+    U32 idx;
+    U32 i;
+    struct HwiIrqsOffSite info;
+
+    if (print == NULL) {
+        return OS_ERRNO_HWI_IRQSOFF_PTR_NULL;
+    }
+
+    (void)print("irqsoff trace: %s, threshold %u us, sites %u, dropped %u\n",
+        g_irqsOffTrace.enable ? "on" : "off", g_irqsOffTrace.thresholdUs, g_irqsOffTrace.siteNum,
+        g_irqsOffTrace.dropped);
+
+    for (idx = 0; idx < OS_IRQSOFF_TRACE_SITE_NUM; idx++) {
+        if (!OsIrqsOffSiteRead(idx, &info)) {
+            continue;
+        }
+
+        (void)print("lock 0x%lx unlock 0x%lx count %u max %u us hist", (unsigned long)info.lockAddr,
+            (unsigned long)info.unlockAddr, info.count, info.maxUs);
+        for (i = 0; i < OS_HWI_IRQSOFF_HIST_NUM; i++) {
+            (void)print(" %u", info.hist[i]);
+        }
+        (void)print("\n");
+    }
+
+    return OS_OK;
+}
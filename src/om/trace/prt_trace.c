@@ -0,0 +1,145 @@
+/*
+ * Copyright (c) 2023-2023 Huawei Technologies Co., Ltd. All rights reserved.
+ *
+ * UniProton is licensed under Mulan PSL v2.
+ * You can use this software according to the terms and conditions of the Mulan PSL v2.
+ * You may obtain a copy of Mulan PSL v2 at:
+ *          http://license.coscl.org.cn/MulanPSL2
+ * THIS SOFTWARE IS PROVIDED ON AN "AS IS" BASIS, WITHOUT WARRANTIES OF ANY KIND,
+ * EITHER EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO NON-INFRINGEMENT,
+ * MERCHANTABILITY OR FIT FOR A PARTICULAR PURPOSE.
+ * See the Mulan PSL v2 for more details.
+ * Create: 2023-06-01
+ * Description: 内核事件跟踪模块的C文件
+ */
+#include "prt_trace_external.h"
+#include "prt_sys_external.h"
+#include "prt_asm_cpu_external.h"
+#include "prt_task.h"
+
+#define OS_TRACE_RECORD_NUM ((OS_TRACE_BUF_SIZE - sizeof(struct TraceBufHead)) / sizeof(struct TraceRecord))
+#define OS_TRACE_INFO(eventId, delta) (((eventId) << OS_TRACE_DELTA_BITS) | (delta))
+
+/*
+ * 跟踪缓冲区，只由本核写入，写入时关本核中断，核间无需加锁
+ */
+struct TagTraceBuf {
+    struct TraceBufHead head;
+    struct TraceRecord record[OS_TRACE_RECORD_NUM];
+};
+
+OS_SEC_BSS volatile bool g_traceEnable;
+OS_SEC_BSS struct TagTraceBuf g_traceBuf;
+
+OS_SEC_ALW_INLINE INLINE void OsTraceWrite(U32 info, U32 arg0, U32 arg1, U32 arg2)
+{
+    struct TraceBufHead *head = &g_traceBuf.head;
+    struct TraceRecord *record = &g_traceBuf.record[head->writeIdx];
+
+    record->info = info;
+    record->arg[0] = arg0;
+    record->arg[1] = arg1;
+    record->arg[2] = arg2;
+
+    head->writeIdx = (head->writeIdx + 1 == head->recordNum) ? 0 : (head->writeIdx + 1);
+    head->writeCount++;
+}
+
+OS_SEC_L0_TEXT void OsTraceRecord(U32 eventId, U32 arg0, U32 arg1, U32 arg2)
+{
+    U32 need;
+    U64 cycle;
+    U64 delta;
+    uintptr_t intSave;
+    struct TraceBufHead *head = &g_traceBuf.head;
+
+    intSave = OsIntLock();
+    /* 关中断前的判断可能与PRT_TraceStop交错 */
+    if (!g_traceEnable) {
+        OsIntRestore(intSave);
+        return;
+    }
+
+    cycle = OsCurCycleGet64();
+    delta = cycle - head->lastCycle;
+    need = (delta > OS_TRACE_DELTA_MAX) ? 2 : 1;
+    if ((head->mode == OS_TRACE_MODE_STOP) && (head->writeCount + need > head->recordNum)) {
+        head->lost++;
+        OsIntRestore(intSave);
+        return;
+    }
+
+    /* cycle差超出记录位宽时先单独记录完整的差值 */
+    if (need == 2) {
+        OsTraceWrite(OS_TRACE_INFO(OS_TRACE_EVENT_TIME, 0), (U32)delta, (U32)(delta >> 32), 0);
+        delta = 0;
+    }
+    OsTraceWrite(OS_TRACE_INFO(eventId, (U32)delta), arg0, arg1, arg2);
+    head->lastCycle = cycle;
+
+    OsIntRestore(intSave);
+}
+
+/*
+ * 描述：开始跟踪内核事件
+ */
+OS_SEC_L4_TEXT U32 PRT_TraceStart(U32 mode)
+{
+    uintptr_t intSave;
+    struct TraceBufHead *head = &g_traceBuf.head;
+
+    if ((mode != OS_TRACE_MODE_OVERWRITE) && (mode != OS_TRACE_MODE_STOP)) {
+        return OS_ERRNO_TRACE_MODE_INVALID;
+    }
+
+    intSave = OsIntLock();
+    if (g_traceEnable) {
+        OsIntRestore(intSave);
+        return OS_ERRNO_TRACE_ALREADY_STARTED;
+    }
+
+    head->magic = OS_TRACE_MAGIC;
+    head->version = (U16)OS_TRACE_VERSION;
+#if defined(OS_ARCH_ARMV8)
+    head->coreId = (U16)OsGetCoreID();
+#else
+    head->coreId = 0;
+#endif
+    head->recordNum = (U32)OS_TRACE_RECORD_NUM;
+    head->mode = mode;
+    head->writeIdx = 0;
+    head->lost = 0;
+    head->writeCount = 0;
+    head->cyclePerSec = (U64)g_systemClock;
+    head->lastCycle = OsCurCycleGet64();
+    g_traceEnable = TRUE;
+    OsIntRestore(intSave);
+
+    return OS_OK;
+}
+
+/*
+ * 描述：停止跟踪内核事件
+ */
+OS_SEC_L4_TEXT void PRT_TraceStop(void)
+{
+    uintptr_t intSave;
+
+    intSave = OsIntLock();
+    g_traceEnable = FALSE;
+    OsIntRestore(intSave);
+}
+
+/*
+ * 描述：获取本核跟踪缓冲区
+ */
+OS_SEC_L4_TEXT U32 PRT_TraceBufGet(void **addr, U32 *size)
+{
+    if ((addr == NULL) || (size == NULL)) {
+        return OS_ERRNO_TRACE_PTR_NULL;
+    }
+
+    *addr = (void *)&g_traceBuf;
+    *size = (U32)sizeof(g_traceBuf);
+    return OS_OK;
+}
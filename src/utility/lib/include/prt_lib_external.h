@@ -51,6 +51,7 @@
 #define OS_64BIT_SET(high, low)         (((U64)(high) << 32) + (U64)(low))
 #define OS_LMB32                        31
 
+#define OS_MAX_U64 0xFFFFFFFFFFFFFFFFULL
 #define OS_MAX_U32 0xFFFFFFFFU
 #define OS_MAX_U16 0xFFFFU
 #define OS_MAX_U12 0xFFFU
@@ -150,11 +151,115 @@
 #define OS_SYS_UINT_IDX(coreId) ((U32)(coreId) >> 5)  // 一个U32表示32个核
 #define OS_SYS_UINT_LCOREID_OFFSET(coreId) (((coreId) & 0x1fUL))  // 核号在一个U32里的偏移
 
+/*
+ * 乘法移位换算因子，value * to / from换算为(value * mult) >> shift，避免运行时的64位除法。
+ * mult向上取整，整数倍的输入换算结果精确，其余输入换算结果单调且误差不超过1。
+ */
+struct LibMulShift {
+    U64 mult;
+    U32 shift;
+};
+
+/*
+ * 描述：计算value * mult的128位乘积，高低64位分别由hi和lo返回
+ */
+OS_SEC_ALW_INLINE INLINE void OsLibMul64x64(U64 value, U64 mult, U64 *hi, U64 *lo)
+{
+#if defined(__SIZEOF_INT128__)
+    unsigned __int128 prod = (unsigned __int128)value * mult;
+
+    *hi = (U64)(prod >> OS_DWORD_BIT_NUM);
+    *lo = (U64)prod;
+#else
+    /* 32位平台拆成四个32x32乘法，对应umull指令 */
+    U64 ll = (U64)OS_GET_64BIT_LOW_32BIT(value) * OS_GET_64BIT_LOW_32BIT(mult);
+    U64 lh = (U64)OS_GET_64BIT_LOW_32BIT(value) * OS_GET_64BIT_HIGH_32BIT(mult);
+    U64 hl = (U64)OS_GET_64BIT_HIGH_32BIT(value) * OS_GET_64BIT_LOW_32BIT(mult);
+    U64 hh = (U64)OS_GET_64BIT_HIGH_32BIT(value) * OS_GET_64BIT_HIGH_32BIT(mult);
+    U64 mid = (ll >> OS_WORD_BIT_NUM) + OS_GET_64BIT_LOW_32BIT(lh) + OS_GET_64BIT_LOW_32BIT(hl);
+
+    *hi = hh + (lh >> OS_WORD_BIT_NUM) + (hl >> OS_WORD_BIT_NUM) + (mid >> OS_WORD_BIT_NUM);
+    *lo = (mid << OS_WORD_BIT_NUM) | OS_GET_64BIT_LOW_32BIT(ll);
+#endif
+}
+
+/*
+ * 描述：按换算因子换算，结果超出64位时截断
+ */
+OS_SEC_ALW_INLINE INLINE U64 OsLibMulShift(U64 value, const struct LibMulShift *conv)
+{
+    U64 hi;
+    U64 lo;
+
+    OsLibMul64x64(value, conv->mult, &hi, &lo);
+    if (conv->shift >= OS_DWORD_BIT_NUM) {
+        return hi >> (conv->shift - OS_DWORD_BIT_NUM);
+    }
+    if (conv->shift == 0) {
+        return lo;
+    }
+    return (hi << (OS_DWORD_BIT_NUM - conv->shift)) | (lo >> conv->shift);
+}
+
+/*
+ * 定除数的倒数乘法因子，value / divisor换算为一次64x64乘法取高64位及移位，结果与整数除法完全一致。
+ * mult为0表示除数为2的幂，只需移位；add为TRUE表示倒数需要65位，高位的1通过一次加法补偿。
+ */
+struct LibDivConst {
+    U64 mult;
+    U64 divisor;
+    U8 shift;
+    bool add;
+};
+
+/*
+ * 描述：按倒数因子计算value / divisor
+ */
+OS_SEC_ALW_INLINE INLINE U64 OsLibDiv(U64 value, const struct LibDivConst *div)
+{
+    U64 hi;
+    U64 lo;
+
+    if (div->mult == 0) {
+        return value >> div->shift;
+    }
+
+    OsLibMul64x64(value, div->mult, &hi, &lo);
+    if (div->add) {
+        hi += (value - hi) >> 1;
+    }
+    return hi >> div->shift;
+}
+
+/*
+ * 描述：按倒数因子计算value % divisor
+ */
+OS_SEC_ALW_INLINE INLINE U64 OsLibDivRemain(U64 value, const struct LibDivConst *div)
+{
+    return value - OsLibDiv(value, div) * div->divisor;
+}
+
+/*
+ * 描述：按2的幂分桶，0落在桶0，[2^(n-1), 2^n)落在桶n，超出的值落在最后一个桶bucketNum - 1
+ */
+OS_SEC_ALW_INLINE INLINE U32 OsLibLog2Bucket(U32 value, U32 bucketNum)
+{
+    U32 idx = (value == 0) ? 0 : (32U - (U32)__builtin_clz(value));
+
+    return (idx >= bucketNum) ? (bucketNum - 1) : idx;
+}
+
 /*
  * 模块间宏定义
  */
+extern void OsLibDivConstInit(struct LibDivConst *div, U64 divisor);
+extern void OsLibDivBenchSet(U64 divisor);
+extern U64 OsLibDivBenchDiv64(U64 value);
+extern U64 OsLibDivBenchRecip(U64 value);
+extern void OsLibMulShiftInit(struct LibMulShift *conv, U32 to, U32 from);
 extern void OsAdd64(U32 *low, U32 *high, U32 oldLow, U32 oldHigh);
 extern void OsSub64(U32 *low, U32 *high, U32 oldLow, U32 oldHigh);
 extern U32 OsGetLmb1(U32 value);
+extern void OsMemSetDword(uintptr_t addr, uintptr_t size, U64 value);
 
 #endif /* PRT_LIB_EXTERNAL_H */
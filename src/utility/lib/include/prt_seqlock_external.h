@@ -0,0 +1,69 @@
+/*
+ * Copyright (c) 2023-2023 Huawei Technologies Co., Ltd. All rights reserved.
+ *
+ * UniProton is licensed under Mulan PSL v2.
+ * You can use this software according to the terms and conditions of the Mulan PSL v2.
+ * You may obtain a copy of Mulan PSL v2 at:
+ *          http://license.coscl.org.cn/MulanPSL2
+ * THIS SOFTWARE IS PROVIDED ON AN "AS IS" BASIS, WITHOUT WARRANTIES OF ANY KIND,
+ * EITHER EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO NON-INFRINGEMENT,
+ * MERCHANTABILITY OR FIT FOR A PARTICULAR PURPOSE.
+ * See the Mulan PSL v2 for more details.
+ * Create: 2023-06-01
+ * Description: 顺序锁，用于中断中更新、任务和中断中无锁读取的多字数据
+ */
+#ifndef PRT_SEQLOCK_EXTERNAL_H
+#define PRT_SEQLOCK_EXTERNAL_H
+
+#include "prt_typedef.h"
+
+/*
+ * 写者进入前序号加1变为奇数，退出后再加1变为偶数；读者读取前后序号一致且为偶数时数据完整，否则重读。
+ * 写者必须在关中断下完成写操作，保证同核的读者不会看到奇数序号，读者不关中断。
+ */
+struct SeqLock {
+    volatile U32 seq;
+};
+
+#define OS_SEQLOCK_INIT {0}
+
+/* 单核上读者和写者只可能是任务与中断的关系，编译器屏障即可保证访存顺序 */
+#define OS_SEQLOCK_BARRIER() OS_EMBED_ASM("" : : : "memory")
+
+OS_SEC_ALW_INLINE INLINE void OsSeqWriteBegin(struct SeqLock *lock)
+{
+    lock->seq++;
+    OS_SEQLOCK_BARRIER();
+}
+
+OS_SEC_ALW_INLINE INLINE void OsSeqWriteEnd(struct SeqLock *lock)
+{
+    OS_SEQLOCK_BARRIER();
+    lock->seq++;
+}
+
+/*
+ * 描述：读开始，返回当前序号，写者正在写时等待
+ */
+OS_SEC_ALW_INLINE INLINE U32 OsSeqReadBegin(const struct SeqLock *lock)
+{
+    U32 seq;
+
+    do {
+        seq = lock->seq;
+    } while ((seq & 1U) != 0);
+    OS_SEQLOCK_BARRIER();
+
+    return seq;
+}
+
+/*
+ * 描述：读结束，返回TRUE表示读的过程中数据被更新，需要重读
+ */
+OS_SEC_ALW_INLINE INLINE bool OsSeqReadRetry(const struct SeqLock *lock, U32 seq)
+{
+    OS_SEQLOCK_BARRIER();
+    return (lock->seq != seq);
+}
+
+#endif /* PRT_SEQLOCK_EXTERNAL_H */
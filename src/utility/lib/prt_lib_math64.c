@@ -14,6 +14,10 @@
  */
 #include "prt_lib_external.h"
 #include "prt_attr_external.h"
+#include "prt_cpu_external.h"
+
+/* 定除数除法性能测试钩子使用的除数 */
+OS_SEC_BSS struct LibDivConst g_libDivBench;
 
 /*
  * 描述：64位加法
@@ -55,6 +59,109 @@ OS_SEC_L4_TEXT void OsSub64(U32 *low, U32 *high, U32 oldLow, U32 oldHigh)
     OsSub64X(oldLow, oldHigh, low, high);
 }
 
+/*
+ * 描述：计算to / from的乘法移位换算因子，from不能为0。
+ * 逐位做长除法，shift取使mult不超过64位的最大值，精度最高。
+ */
+OS_SEC_L4_TEXT void OsLibMulShiftInit(struct LibMulShift *conv, U32 to, U32 from)
+{
+    U64 mult = to / from;
+    U64 rem = to % from;
+    U32 shift = 0;
+
+    while ((mult < (1ULL << (OS_DWORD_BIT_NUM - 1))) && (shift < (OS_DWORD_BIT_NUM * 2 - 1))) {
+        rem <<= 1;
+        mult <<= 1;
+        if (rem >= from) {
+            rem -= from;
+            mult |= 1;
+        }
+        shift++;
+    }
+
+    /* 向上取整，保证整数倍的输入换算结果精确 */
+    if (rem != 0) {
+        if (mult == OS_MAX_U64) {
+            mult = 1ULL << (OS_DWORD_BIT_NUM - 1);
+            shift--;
+        } else {
+            mult++;
+        }
+    }
+
+    conv->mult = mult;
+    conv->shift = shift;
+}
+
+/*
+ * 描述：计算除数的倒数乘法因子，divisor不能为0。
+ * mult取floor(2^(64 + log2) / divisor) + 1，误差不足以改变商时直接使用，否则精度再提高一位，由OsLibDiv补偿第65位。
+ */
+OS_SEC_L4_TEXT void OsLibDivConstInit(struct LibDivConst *div, U64 divisor)
+{
+    U32 log2 = (OS_DWORD_BIT_NUM - 1) - (U32)__builtin_clzll(divisor);
+    U64 quot = 0;
+    U64 rem = 1ULL << log2;
+    U64 twice;
+    U64 carry;
+    U32 i;
+
+    div->divisor = divisor;
+    div->shift = (U8)log2;
+    div->add = FALSE;
+
+    if ((divisor & (divisor - 1)) == 0) {
+        div->mult = 0;
+        return;
+    }
+
+    /* 2^(64 + log2)除以divisor，被除数高64位小于除数，逐位做长除法 */
+    for (i = 0; i < OS_DWORD_BIT_NUM; i++) {
+        carry = rem >> (OS_DWORD_BIT_NUM - 1);
+        rem <<= 1;
+        quot <<= 1;
+        if ((carry != 0) || (rem >= divisor)) {
+            rem -= divisor;
+            quot |= 1;
+        }
+    }
+
+    if ((divisor - rem) >= (1ULL << log2)) {
+        twice = rem + rem;
+        quot += quot;
+        if ((twice >= divisor) || (twice < rem)) {
+            quot++;
+        }
+        div->add = TRUE;
+    }
+
+    div->mult = quot + 1;
+}
+
+/*
+ * 描述：设置定除数除法性能测试钩子的除数，divisor不能为0，仅供测试用例调用。
+ */
+OS_SEC_L4_TEXT void OsLibDivBenchSet(U64 divisor)
+{
+    OsLibDivConstInit(&g_libDivBench, divisor);
+}
+
+/*
+ * 描述：按换算点改造前的方式用DIV64计算value / divisor，作为倒数因子除法的对照，仅供测试用例调用。
+ */
+OS_SEC_TEXT U64 OsLibDivBenchDiv64(U64 value)
+{
+    return DIV64(value, g_libDivBench.divisor);
+}
+
+/*
+ * 描述：按换算点当前的方式用倒数因子计算value / divisor，仅供测试用例调用。
+ */
+OS_SEC_TEXT U64 OsLibDivBenchRecip(U64 value)
+{
+    return OsLibDiv(value, &g_libDivBench);
+}
+
 OS_SEC_L4_TEXT U32 OsGetLmb1(U32 value)
 {
     int i;
@@ -0,0 +1,56 @@
+/*
+ * Copyright (c) 2023-2023 Huawei Technologies Co., Ltd. All rights reserved.
+ *
+ * UniProton is licensed under Mulan PSL v2.
+ * You can use this software according to the terms and conditions of the Mulan PSL v2.
+ * You may obtain a copy of Mulan PSL v2 at:
+ *          http://license.coscl.org.cn/MulanPSL2
+ * THIS SOFTWARE IS PROVIDED ON AN "AS IS" BASIS, WITHOUT WARRANTIES OF ANY KIND,
+ * EITHER EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO NON-INFRINGEMENT,
+ * MERCHANTABILITY OR FIT FOR A PARTICULAR PURPOSE.
+ * See the Mulan PSL v2 for more details.
+ * Create: 2023-06-01
+ * Description: 提供按双字批量填充内存
+ */
+#include "prt_lib_external.h"
+#include "prt_attr_external.h"
+
+/* 主循环每次写入的双字个数 */
+#define OS_MEM_SET_UNROLL 4
+
+/*
+ * 描述：用value按双字填充[addr, addr + size)，value的第n个字节对应8字节对齐地址偏移n处的字节。
+ * 首尾不足双字的部分按字节写，中间部分只做8字节自然对齐的写操作，MMU及cache使能前也可使用。
+ */
+OS_SEC_TEXT void OsMemSetDword(uintptr_t addr, uintptr_t size, U64 value)
+{
+    U64 *dword = NULL;
+    uintptr_t cnt;
+    uintptr_t end = addr + size;
+
+    while ((addr < end) && OS_NOT_ALIGN_CHK(addr, OS_BYTES_PER_DWORD)) {
+        *(U8 *)addr = (U8)(value >> (OS_ALIGN(addr, OS_BYTES_PER_DWORD) * OS_BITS_PER_BYTE));
+        addr++;
+    }
+
+    dword = (U64 *)addr;
+    cnt = (end - addr) / OS_BYTES_PER_DWORD;
+    while (cnt >= OS_MEM_SET_UNROLL) {
+        dword[0] = value;
+        dword[1] = value;
+        dword[2] = value;
+        dword[3] = value;
+        dword += OS_MEM_SET_UNROLL;
+        cnt -= OS_MEM_SET_UNROLL;
+    }
+    while (cnt != 0) {
+        *dword++ = value;
+        cnt--;
+    }
+
+    addr = (uintptr_t)dword;
+    while (addr < end) {
+        *(U8 *)addr = (U8)(value >> (OS_ALIGN(addr, OS_BYTES_PER_DWORD) * OS_BITS_PER_BYTE));
+        addr++;
+    }
+}
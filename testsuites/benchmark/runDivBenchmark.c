@@ -0,0 +1,142 @@
+/*
+ * Copyright (c) 2023-2023 Huawei Technologies Co., Ltd. All rights reserved.
+ *
+ * UniProton is licensed under Mulan PSL v2.
+ * You can use this software according to the terms and conditions of the Mulan PSL v2.
+ * You may obtain a copy of Mulan PSL v2 at:
+ *          http://license.coscl.org.cn/MulanPSL2
+ * THIS SOFTWARE IS PROVIDED ON AN "AS IS" BASIS, WITHOUT WARRANTIES OF ANY KIND,
+ * EITHER EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO NON-INFRINGEMENT,
+ * MERCHANTABILITY OR FIT FOR A PARTICULAR PURPOSE.
+ * See the Mulan PSL v2 for more details.
+ * Create: 2023-06-01
+ * Description: 定除数64位除法换算性能测试
+ */
+#include <stdio.h>
+#include "prt_config.h"
+#include "prt_config_internal.h"
+#include "prt_clk.h"
+#include "prt_hwi.h"
+#include "bench_support.h"
+
+/*
+ * 定除数64位除法测试。
+ * 按改为倒数因子除法的换算点构造被除数与除数：软件定时器ms到Tick、Tick到ms的换算，以及CPUP按采样基准值计算使用率。
+ * 通过内核测试钩子分别用改造前的DIV64与当前的倒数因子除法计算同一组被除数，统计每次换算的cycle数，并记录两者结果的最大偏差。
+ */
+#define DIV_BENCH_NUM   256
+#define DIV_BENCH_ROUND 16
+#define DIV_BENCH_MS_PER_SECOND 1000U
+/* CPUP使用率按万分比计算 */
+#define DIV_BENCH_CPUP_USE_RATE 10000U
+/* CPUP采样周期，单位Tick，测试配置未使能CPUP，取典型值 */
+#define DIV_BENCH_CPUP_SAMPLE 1000U
+#define DIV_BENCH_CPUP_BASE (((U64)OS_SYS_CLOCK / OS_TICK_PER_SECOND) * DIV_BENCH_CPUP_SAMPLE)
+
+struct DivBenchCase {
+    const char *name;
+    U64 divisor;
+    /* 换算前的取值上限，被除数为该范围内的值乘以mult */
+    U64 range;
+    U64 mult;
+};
+
+static U64 g_benchDividend[DIV_BENCH_NUM];
+static volatile U64 g_benchSink;
+
+static void DivBenchFill(const struct DivBenchCase *benchCase)
+{
+    U32 i;
+    U64 value;
+
+    for (i = 0; i < DIV_BENCH_NUM; i++) {
+        value = ((U64)BenchRand() << 40) ^ ((U64)BenchRand() << 16) ^ BenchRand();
+        g_benchDividend[i] = (value % (benchCase->range + 1)) * benchCase->mult;
+    }
+}
+
+/* 每轮换算DIV_BENCH_NUM个被除数，按每次换算的平均cycle数记录 */
+static void DivBenchTime(U64 (*div)(U64 value), struct BenchStat *stat)
+{
+    U32 i;
+    U32 round;
+    U64 start;
+    U64 end;
+    U64 sum = 0;
+    uintptr_t intSave;
+
+    for (round = 0; round < DIV_BENCH_ROUND; round++) {
+        intSave = PRT_HwiLock();
+        start = PRT_ClkGetCycleCount64();
+        for (i = 0; i < DIV_BENCH_NUM; i++) {
+            sum += div(g_benchDividend[i]);
+        }
+        end = PRT_ClkGetCycleCount64();
+        PRT_HwiRestore(intSave);
+        BenchStatRecord(stat, (end - start) / DIV_BENCH_NUM);
+    }
+
+    g_benchSink = sum;
+}
+
+static U64 DivBenchMaxDiff(void)
+{
+    U32 i;
+    U64 ret;
+    U64 quot;
+    U64 diff;
+    U64 maxDiff = 0;
+
+    for (i = 0; i < DIV_BENCH_NUM; i++) {
+        ret = OsLibDivBenchRecip(g_benchDividend[i]);
+        quot = OsLibDivBenchDiv64(g_benchDividend[i]);
+        diff = (ret > quot) ? (ret - quot) : (quot - ret);
+        if (diff > maxDiff) {
+            maxDiff = diff;
+        }
+    }
+
+    return maxDiff;
+}
+
+static void DivBenchRun(const struct DivBenchCase *benchCase)
+{
+    struct BenchStat recipStat = {0};
+    struct BenchStat div64Stat = {0};
+
+    DivBenchFill(benchCase);
+    OsLibDivBenchSet(benchCase->divisor);
+
+    DivBenchTime(OsLibDivBenchDiv64, &div64Stat);
+    DivBenchTime(OsLibDivBenchRecip, &recipStat);
+
+    printf("%s, divisor %u, max diff %u\n", benchCase->name, (U32)benchCase->divisor, (U32)DivBenchMaxDiff());
+    BenchStatShow("  div64", &div64Stat);
+    BenchStatShow("  recip", &recipStat);
+}
+
+void Init(uintptr_t param1, uintptr_t param2, uintptr_t param3, uintptr_t param4)
+{
+    U32 i;
+    struct DivBenchCase benchCase[] = {
+        /* 定时器周期ms换算为Tick：tickPerSecond * ms / 1000 */
+        {"ms to tick", DIV_BENCH_MS_PER_SECOND, 0xFFFFFFFFULL, OS_TICK_PER_SECOND},
+        /* 定时器周期及剩余Tick换算为ms：tick * 1000 / tickPerSecond */
+        {"tick to ms", OS_TICK_PER_SECOND, 0xFFFFFFFFULL, DIV_BENCH_MS_PER_SECOND},
+        /* CPUP使用率：allTime * 10000 / 采样周期内的cycle数 */
+        {"cpup usage", DIV_BENCH_CPUP_BASE, DIV_BENCH_CPUP_BASE, DIV_BENCH_CPUP_USE_RATE},
+    };
+
+    (void)param1;
+    (void)param2;
+    (void)param3;
+    (void)param4;
+
+    printf("Start div benchmark....\n");
+
+    for (i = 0; i < sizeof(benchCase) / sizeof(benchCase[0]); i++) {
+        DivBenchRun(&benchCase[i]);
+    }
+
+    printf("Div benchmark end\n");
+}
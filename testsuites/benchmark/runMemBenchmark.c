@@ -0,0 +1,134 @@
+/*
+ * Copyright (c) 2023-2023 Huawei Technologies Co., Ltd. All rights reserved.
+ *
+ * UniProton is licensed under Mulan PSL v2.
+ * You can use this software according to the terms and conditions of the Mulan PSL v2.
+ * You may obtain a copy of Mulan PSL v2 at:
+ *          http://license.coscl.org.cn/MulanPSL2
+ * THIS SOFTWARE IS PROVIDED ON AN "AS IS" BASIS, WITHOUT WARRANTIES OF ANY KIND,
+ * EITHER EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO NON-INFRINGEMENT,
+ * MERCHANTABILITY OR FIT FOR A PARTICULAR PURPOSE.
+ * See the Mulan PSL v2 for more details.
+ * Create: 2023-06-01
+ * Description: 内存算法最坏申请时间测试
+ */
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include "securec.h"
+#include "prt_config.h"
+#include "prt_config_internal.h"
+#include "prt_clk.h"
+#include "prt_task.h"
+#include "prt_hwi.h"
+#include "prt_mem.h"
+#include "bench_support.h"
+
+/*
+ * 内存算法最坏申请时间测试。
+ * 先用随机大小的内存块填满分区，再隔一个释放一个制造碎片，之后随机申请释放，
+ * 统计单次申请/释放的最大及平均cycle数。build_app.sh分别构建FSC版本UniPorton_test_benchmark_mem
+ * 和TLSF版本UniPorton_test_benchmark_mem_tlsf，运行后对比结果。
+ */
+#define MEM_BENCH_SLOT_NUM  256
+#define MEM_BENCH_LOOP      20000
+#define MEM_BENCH_SIZE_MIN  8
+#define MEM_BENCH_SIZE_MAX  512
+
+static void *g_benchSlot[MEM_BENCH_SLOT_NUM];
+static U32 MemBenchSize(void)
+{
+    return MEM_BENCH_SIZE_MIN + BenchRand() % (MEM_BENCH_SIZE_MAX - MEM_BENCH_SIZE_MIN + 1);
+}
+
+static void MemBenchAlloc(U32 slot, struct BenchStat *stat)
+{
+    U64 start;
+    U64 end;
+    uintptr_t intSave;
+    U32 size = MemBenchSize();
+
+    /* 关中断测量，避免tick中断计入单次申请时间 */
+    intSave = PRT_HwiLock();
+    start = PRT_ClkGetCycleCount64();
+    g_benchSlot[slot] = PRT_MemAlloc(OS_MID_APP, OS_MEM_DEFAULT_FSC_PT, size);
+    end = PRT_ClkGetCycleCount64();
+    PRT_HwiRestore(intSave);
+
+    if (g_benchSlot[slot] == NULL) {
+        stat->fail++;
+        return;
+    }
+    BenchStatRecord(stat, end - start);
+}
+
+static void MemBenchFree(U32 slot, struct BenchStat *stat)
+{
+    U64 start;
+    U64 end;
+    U32 ret;
+    uintptr_t intSave;
+
+    intSave = PRT_HwiLock();
+    start = PRT_ClkGetCycleCount64();
+    ret = PRT_MemFree(OS_MID_APP, g_benchSlot[slot]);
+    end = PRT_ClkGetCycleCount64();
+    PRT_HwiRestore(intSave);
+
+    g_benchSlot[slot] = NULL;
+    if (ret != OS_OK) {
+        stat->fail++;
+        return;
+    }
+    BenchStatRecord(stat, end - start);
+}
+
+void Init(uintptr_t param1, uintptr_t param2, uintptr_t param3, uintptr_t param4)
+{
+    U32 i;
+    U32 slot;
+    struct BenchStat allocStat = {0};
+    struct BenchStat freeStat = {0};
+    struct BenchStat fillStat = {0};
+
+    (void)param1;
+    (void)param2;
+    (void)param3;
+    (void)param4;
+
+#if defined(OS_OPTION_MEM_TLSF)
+    printf("Start mem benchmark, arith TLSF....\n");
+#else
+    printf("Start mem benchmark, arith FSC....\n");
+#endif
+
+    /* 填满分区后隔一个释放一个，制造大量同一大小区间的空闲碎片 */
+    for (i = 0; i < MEM_BENCH_SLOT_NUM; i++) {
+        MemBenchAlloc(i, &fillStat);
+    }
+    for (i = 0; i < MEM_BENCH_SLOT_NUM; i += 2) {
+        if (g_benchSlot[i] != NULL) {
+            MemBenchFree(i, &fillStat);
+        }
+    }
+
+    for (i = 0; i < MEM_BENCH_LOOP; i++) {
+        slot = BenchRand() % MEM_BENCH_SLOT_NUM;
+        if (g_benchSlot[slot] == NULL) {
+            MemBenchAlloc(slot, &allocStat);
+        } else {
+            MemBenchFree(slot, &freeStat);
+        }
+    }
+
+    for (i = 0; i < MEM_BENCH_SLOT_NUM; i++) {
+        if (g_benchSlot[i] != NULL) {
+            MemBenchFree(i, &freeStat);
+        }
+    }
+
+    BenchStatShow("fill", &fillStat);
+    BenchStatShow("alloc", &allocStat);
+    BenchStatShow("free", &freeStat);
+    printf("Mem benchmark end\n");
+}
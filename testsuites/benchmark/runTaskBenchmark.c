@@ -0,0 +1,127 @@
+/*
+ * Copyright (c) 2023-2023 Huawei Technologies Co., Ltd. All rights reserved.
+ *
+ * UniProton is licensed under Mulan PSL v2.
+ * You can use this software according to the terms and conditions of the Mulan PSL v2.
+ * You may obtain a copy of Mulan PSL v2 at:
+ *          http://license.coscl.org.cn/MulanPSL2
+ * THIS SOFTWARE IS PROVIDED ON AN "AS IS" BASIS, WITHOUT WARRANTIES OF ANY KIND,
+ * EITHER EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO NON-INFRINGEMENT,
+ * MERCHANTABILITY OR FIT FOR A PARTICULAR PURPOSE.
+ * See the Mulan PSL v2 for more details.
+ * Create: 2023-06-01
+ * Description: 任务创建删除吞吐量测试
+ */
+#include <stdio.h>
+#include <pthread.h>
+#include "prt_config.h"
+#include "prt_config_internal.h"
+#include "prt_clk.h"
+#include "prt_task.h"
+#include "bench_support.h"
+
+/*
+ * 任务创建删除吞吐量测试。
+ * 循环创建比主任务优先级高的短任务，任务运行结束后自删除，统计每轮创建到任务退出的cycle数；
+ * 再以pthread_create/pthread_join重复测试。分别打开和关闭OS_OPTION_TASK_STACK_POOL编译运行后对比结果。
+ */
+#define TASK_BENCH_LOOP        2000
+#define TASK_BENCH_STACK_SIZE  0x1000
+
+static volatile U32 g_benchRunCnt;
+
+static void TaskBenchEntry(uintptr_t param1, uintptr_t param2, uintptr_t param3, uintptr_t param4)
+{
+    (void)param1;
+    (void)param2;
+    (void)param3;
+    (void)param4;
+
+    g_benchRunCnt++;
+}
+
+static void *TaskBenchThread(void *arg)
+{
+    g_benchRunCnt++;
+    return arg;
+}
+
+static void TaskBenchCreate(struct BenchStat *stat)
+{
+    U64 start;
+    U64 end;
+    U32 ret;
+    TskHandle taskPid;
+    struct TskInitParam initParam = {TaskBenchEntry, OS_TSK_PRIORITY_05, 0, { 0 }, TASK_BENCH_STACK_SIZE,
+        "BenchTask", 0};
+
+    /* 新任务优先级高于主任务，PRT_TaskResume返回时新任务已运行结束并自删除 */
+    start = PRT_ClkGetCycleCount64();
+    ret = PRT_TaskCreate(&taskPid, &initParam);
+    if (ret == OS_OK) {
+        ret = PRT_TaskResume(taskPid);
+    }
+    end = PRT_ClkGetCycleCount64();
+
+    if (ret != OS_OK) {
+        stat->fail++;
+        return;
+    }
+    BenchStatRecord(stat, end - start);
+}
+
+static void TaskBenchPthread(struct BenchStat *stat)
+{
+    U64 start;
+    U64 end;
+    int ret;
+    pthread_t thread;
+    pthread_attr_t attr;
+
+    (void)pthread_attr_init(&attr);
+    (void)pthread_attr_setstacksize(&attr, TASK_BENCH_STACK_SIZE);
+
+    start = PRT_ClkGetCycleCount64();
+    ret = pthread_create(&thread, &attr, TaskBenchThread, NULL);
+    if (ret == 0) {
+        ret = pthread_join(thread, NULL);
+    }
+    end = PRT_ClkGetCycleCount64();
+
+    (void)pthread_attr_destroy(&attr);
+    if (ret != 0) {
+        stat->fail++;
+        return;
+    }
+    BenchStatRecord(stat, end - start);
+}
+
+void Init(uintptr_t param1, uintptr_t param2, uintptr_t param3, uintptr_t param4)
+{
+    U32 i;
+    struct BenchStat taskStat = {0};
+    struct BenchStat pthreadStat = {0};
+
+    (void)param1;
+    (void)param2;
+    (void)param3;
+    (void)param4;
+
+#if defined(OS_OPTION_TASK_STACK_POOL)
+    printf("Start task benchmark, stack pool on....\n");
+#else
+    printf("Start task benchmark, stack pool off....\n");
+#endif
+
+    for (i = 0; i < TASK_BENCH_LOOP; i++) {
+        TaskBenchCreate(&taskStat);
+    }
+
+    for (i = 0; i < TASK_BENCH_LOOP; i++) {
+        TaskBenchPthread(&pthreadStat);
+    }
+
+    BenchStatShow("task create+exit", &taskStat);
+    BenchStatShow("pthread create+join", &pthreadStat);
+    printf("run %u, task benchmark end\n", g_benchRunCnt);
+}
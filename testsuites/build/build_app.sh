@@ -8,17 +8,39 @@ ALL_APP=(
     "UniPorton_test_posix_time_interface" \
          "UniPorton_test_posix_thread_sem_interface" 
          "UniPorton_test_posix_thread_pthread_interface"
+         "UniPorton_test_posix_mqueue_interface"
+         "UniPorton_test_benchmark_mem"
+         "UniPorton_test_benchmark_task"
+         "UniPorton_test_benchmark_div"
          )
 
-for one_app in ${ALL_APP[*]}
-do
-export APP=${one_app}
+build_app()
+{
+export APP=$1
 export TMP_DIR=$APP
-cmake -S .. -B $TMP_DIR -DAPP:STRING=$APP -DTOOLCHAIN_PATH:STRING=$TOOLCHAIN_PATH
+cmake -S .. -B $TMP_DIR -DAPP:STRING=$APP -DTOOLCHAIN_PATH:STRING=$TOOLCHAIN_PATH $2
 pushd $TMP_DIR
 make $APP --trace
 popd
 cp $TMP_DIR/$APP $APP.elf
 $TOOLCHAIN_PATH/bin/arm-none-eabi-objcopy -O binary $TMP_DIR/$APP $APP.bin
 rm -rf $TMP_DIR
-done
\ No newline at end of file
+}
+
+for one_app in ${ALL_APP[*]}
+do
+build_app ${one_app}
+done
+
+# 内存性能测试的TLSF版本：复制一份config_m4的配置并打开CONFIG_OS_OPTION_MEM_TLSF，
+# 内核库编译到单独的目录，不改动仓库中的配置，也不覆盖上面FSC版本使用的内核库
+TLSF_DIR=$(pwd)/tlsf_kernel
+rm -rf $TLSF_DIR
+mkdir -p $TLSF_DIR/config_m4
+cp ../../build/uniproton_config/config_m4/defconfig $TLSF_DIR/config_m4/defconfig
+sed -i 's/^# CONFIG_OS_OPTION_MEM_TLSF is not set$/CONFIG_OS_OPTION_MEM_TLSF=y/' $TLSF_DIR/config_m4/defconfig
+pushd ../../
+RPROTON_CONFIG_DIR=$TLSF_DIR/config_m4 RPROTON_BINARY_DIR=$TLSF_DIR python3 build.py m4 normal FPGA ALL ALL $TLSF_DIR/output
+popd
+build_app "UniPorton_test_benchmark_mem_tlsf" "-DOUTPUT_PATH:STRING=$TLSF_DIR/output"
+rm -rf $TLSF_DIR
@@ -27,7 +27,7 @@
 #define FUNCTION "mq_close"
 #define ERROR_PREFIX "unexpected error: " FUNCTION " " TEST ": "
 
-int main()
+int mq_close_3_1()
 {
 	char qname[50];
 	mqd_t queue;
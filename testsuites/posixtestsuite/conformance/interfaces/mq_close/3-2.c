@@ -17,7 +17,7 @@
 #include <stdio.h>
 #include "posixtest.h"
 
-int main()
+int mq_close_3_2()
 {
 	if (mq_close((mqd_t)-1) != -1) {
 		printf("mq_close() did not return -1 on invalid descriptor\n");
@@ -20,7 +20,7 @@
 #include <stdio.h>
 #include "posixtest.h"
 
-int main()
+int mq_close_3_3()
 {
  	/* Use some arbitrary but high number for the descriptor.  */
  	if (mq_close((mqd_t)274) != -1) {
@@ -16,7 +16,7 @@
 #include <stdio.h>
 #include "posixtest.h"
 
-int main()
+int mq_close_5_1()
 {
 	printf("Functionality of using mqdes after mq_close() and before\n");
 	printf("mq_open() will not be tested as POSIX says this is ");
@@ -36,7 +36,7 @@
 #define NAMESIZE	50
 #define MQFLAGS		O_NONBLOCK
 
-int main()
+int mq_getattr_2_1()
 {
 	char mqname[NAMESIZE];
 	mqd_t mqdes;
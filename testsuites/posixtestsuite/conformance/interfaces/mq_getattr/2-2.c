@@ -30,7 +30,7 @@
 #define NAMESIZE	50
 #define MQFLAGS		O_NONBLOCK
 
-int main()
+int mq_getattr_2_2()
 {
 	char mqname[NAMESIZE];
 	mqd_t mqdes;
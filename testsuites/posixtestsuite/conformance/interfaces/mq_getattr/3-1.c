@@ -32,7 +32,7 @@
 #define MAXMSG		40
 #define MSGSIZE		50
 
-int main()
+int mq_getattr_3_1()
 {
 	char mqname[NAMESIZE];
 	mqd_t mqdes;
@@ -31,7 +31,7 @@
 #define MSGSIZE		50
 #define MAXMSG		40
 
-int main()
+int mq_getattr_4_1()
 {
         char mqname[NAMESIZE];
         const char *msgptr = "test message";
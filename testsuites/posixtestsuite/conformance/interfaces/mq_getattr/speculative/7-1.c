@@ -29,7 +29,7 @@
 
 #define NAMESIZE	50
 
-int main()
+int mq_getattr_7_1()
 {
 	char mqname[NAMESIZE];
 	mqd_t mqdes;
@@ -38,7 +38,7 @@ void mqclean(mqd_t queue, const char *qname)
 	mq_unlink(qname);
 }
 
-int main()
+int mq_notify_2_1()
 {
 	char mqname[NAMESIZE];
 	mqd_t mqdes;
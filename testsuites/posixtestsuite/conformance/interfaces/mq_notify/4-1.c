@@ -45,7 +45,7 @@ void mqclean(mqd_t queue, const char *qname)
 	mq_close(queue);
 	mq_unlink(qname);
 }
-int main()
+int mq_notify_4_1()
 {
 	char mqname[50];
 	mqd_t mqdes;
@@ -37,7 +37,7 @@ void mqclean(mqd_t queue, const char *qname)
 	mq_unlink(qname);
 }
 
-int main()
+int mq_notify_8_1()
 {
 	char mqname[NAMESIZE];
 	mqd_t mqdes;
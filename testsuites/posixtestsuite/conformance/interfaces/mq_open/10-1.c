@@ -21,7 +21,7 @@
 #include <stdio.h>
 #include "posixtest.h"
 
-int main()
+int mq_open_10_1()
 {
 	printf("Will not test the user ID and group ID of a created\n");
 	printf("message queue as we would need multiple users and\n");
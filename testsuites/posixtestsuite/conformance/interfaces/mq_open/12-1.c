@@ -28,7 +28,7 @@
 
 #define NAMESIZE 50
 
-int main()
+int mq_open_12_1()
 {
         char qname[NAMESIZE];
         mqd_t queue;
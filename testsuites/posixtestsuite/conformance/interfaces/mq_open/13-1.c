@@ -24,7 +24,7 @@
 #define MAXMSG 10
 #define MSGSIZE 5
 
-int main()
+int mq_open_13_1()
 {
         char qname[NAMESIZE];
         mqd_t queue;
@@ -14,7 +14,7 @@
 #include <stdio.h>
 #include "posixtest.h"
 
-int main()
+int mq_open_14_1()
 {
 	printf("Will not test calling process privileges on name\n");
 	printf("as POSIX does not define when this error occurs.\n");
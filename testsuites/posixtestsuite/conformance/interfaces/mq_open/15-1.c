@@ -22,7 +22,7 @@
 
 #define NAMESIZE 50
 
-int main()
+int mq_open_15_1()
 {
         char qname[NAMESIZE];
         mqd_t queue, queue2;
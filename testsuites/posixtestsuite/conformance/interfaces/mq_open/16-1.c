@@ -32,7 +32,7 @@
 
 #define NAMESIZE 50
 
-int main()
+int mq_open_16_1()
 {
        	char qname[NAMESIZE];
 	int pid, succeeded=0;
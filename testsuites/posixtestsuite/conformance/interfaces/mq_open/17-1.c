@@ -14,7 +14,7 @@
 #include <stdio.h>
 #include "posixtest.h"
 
-int main()
+int mq_open_17_1()
 {
 	printf("Will not test setting O_EXCL without O_CREAT because\n");
 	printf("results are undefined.\n");
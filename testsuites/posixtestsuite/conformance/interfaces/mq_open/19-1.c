@@ -35,7 +35,7 @@
 #define MSGSTR "0123456789"
 #define BUFFER 40
 
-int main()
+int mq_open_19_1()
 {
         char qname[NAMESIZE], msgrcd[BUFFER];
         const char *msgptr = MSGSTR;
@@ -41,7 +41,7 @@ void handler(int signo)
 	return;
 }
 
-int main()
+int mq_open_2_1()
 {
        	char qname[NAMESIZE];
         const char *msgptr = MSGSTR;
@@ -33,7 +33,7 @@ void handler(int signo)
 #endif
 }
 
-int main()
+int mq_open_20_1()
 {
         char qname[NAMESIZE];
         mqd_t queue;
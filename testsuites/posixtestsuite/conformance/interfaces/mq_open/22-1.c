@@ -14,7 +14,7 @@
 #include <stdio.h>
 #include "posixtest.h"
 
-int main()
+int mq_open_22_1()
 {
 	printf("Will not test returning EACCESS when privileges are denied\n");
 	printf("as POSIX does not define when this error occurs.\n");
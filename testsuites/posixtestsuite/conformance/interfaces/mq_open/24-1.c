@@ -15,7 +15,7 @@
 #include <stdio.h>
 #include "posixtest.h"
 
-int main()
+int mq_open_24_1()
 {
 	printf("Will not test mq_open() being interrupted as it is\n");
 	printf("not possible to predictably interrupt an mq_open().\n");
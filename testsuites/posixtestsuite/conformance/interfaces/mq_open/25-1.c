@@ -15,7 +15,7 @@
 #include <stdio.h>
 #include "posixtest.h"
 
-int main()
+int mq_open_25_1()
 {
 	printf("Will not test mq_open() failing with EINVAL if mq_open()\n");
 	printf("is not supported for the name parameter as\n");
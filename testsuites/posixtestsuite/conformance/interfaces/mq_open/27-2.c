@@ -25,7 +25,7 @@
 #include <limits.h>
 #include "posixtest.h"
 
-int main()
+int mq_open_27_2()
 {
         char qname[NAME_MAX*2];
         mqd_t queue;
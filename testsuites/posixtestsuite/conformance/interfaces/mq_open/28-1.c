@@ -15,7 +15,7 @@
 #include <stdio.h>
 #include "posixtest.h"
 
-int main()
+int mq_open_28_1()
 {
 	printf("Will not test returning with ENFILE if the system has\n");
 	printf("too many message queues as this is beyond this\n");
@@ -23,7 +23,7 @@
 
 #define NAMESIZE 50
 
-int main()
+int mq_open_29_1()
 {
         char qname[NAMESIZE];
         mqd_t queue;
@@ -15,7 +15,7 @@
 #include <stdio.h>
 #include "posixtest.h"
 
-int main()
+int mq_open_30_1()
 {
 	printf("Will not test mq_open() failing with ENOSPC when there\n");
 	printf("is not enough space to create the message queue\n");
@@ -16,7 +16,7 @@
 #include <stdio.h>
 #include "posixtest.h"
 
-int main()
+int mq_open_4_1()
 {
 	printf("Will not test that {OPEN_MAX} file and message queues can\n");
 	printf("be opened as we cannot determine at run-time if a given\n");
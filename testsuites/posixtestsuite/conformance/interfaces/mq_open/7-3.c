@@ -25,7 +25,7 @@
 
 #define NAMESIZE 50
 
-int main()
+int mq_open_7_3()
 {
         char qname[NAMESIZE];
         mqd_t roqueue, roqueue2;
@@ -29,7 +29,7 @@
 #define MSGSTR "0123456789"
 #define BUFFER 40
 
-int main()
+int mq_open_8_1()
 {
         char qname[NAMESIZE], msgrcd[BUFFER];
         const char *msgptr = MSGSTR;
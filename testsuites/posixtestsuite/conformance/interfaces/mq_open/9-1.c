@@ -33,7 +33,7 @@
 #define MSGSTR "0123456789"
 #define BUFFER 40
 
-int main()
+int mq_open_9_1()
 {
         char qname[NAMESIZE], msgrcd[BUFFER], msgrcd2[BUFFER];
         const char *msgptr = MSGSTR;
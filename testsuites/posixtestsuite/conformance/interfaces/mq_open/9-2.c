@@ -38,7 +38,7 @@ void handler(int signo)
 	return;
 }
 
-int main()
+int mq_open_9_2()
 {
        	char qname[NAMESIZE];
         const char *msgptr = MSGSTR;
@@ -22,7 +22,7 @@
 
 #define NAMESIZE 50
 
-int main()
+int mq_open_2_2()
 {
         char qname[NAMESIZE];
         mqd_t queue;
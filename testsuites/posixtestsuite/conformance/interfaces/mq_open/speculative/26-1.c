@@ -32,7 +32,7 @@
 
 #define NAMESIZE 50
 
-int main()
+int mq_open_26_1()
 {
 #ifndef _POSIX_OPEN_MAX
 	printf("_POSIX_OPEN_MAX not defined as expected\n");
@@ -26,7 +26,7 @@
 
 #define NAMESIZE 50
 
-int main()
+int mq_open_6_1()
 {
         char qname[NAMESIZE];
         mqd_t queue;
@@ -30,7 +30,7 @@
 #define NAMESIZE 50
 #define BUFFER 40
 
-int main()
+int mq_receive_11_2()
 {
 
 	char mqname[NAMESIZE];
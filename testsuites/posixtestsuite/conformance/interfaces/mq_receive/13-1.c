@@ -36,7 +36,7 @@ void stopreceive(int signo)
 {
 	return;
 }
-int main()
+int mq_receive_13_1()
 {
         char mqname[NAMESIZE], msgrv[BUFFER];
         mqd_t mqdes;
@@ -37,7 +37,7 @@
 #define NAMESIZE 50
 #define BUFFER 40
 
-int main()
+int mq_receive_5_1()
 {
         char mqname[NAMESIZE], msgrv[BUFFER];
         const char *msgptr = "test message ";
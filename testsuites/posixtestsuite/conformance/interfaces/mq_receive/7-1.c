@@ -30,7 +30,7 @@
 #define NAMESIZE 50
 #define BUFFER 40
 
-int main()
+int mq_receive_7_1()
 {
         char mqname[NAMESIZE], msgrv[BUFFER];
         mqd_t mqdes;
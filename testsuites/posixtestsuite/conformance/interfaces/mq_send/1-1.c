@@ -28,7 +28,7 @@
 #define BUFFER 40
 #define MAXMSG 10
 
-int main()
+int mq_send_1_1()
 {
         char qname[NAMESIZE], msgrcd[BUFFER];
         const char *msgptr = MSGSTR;
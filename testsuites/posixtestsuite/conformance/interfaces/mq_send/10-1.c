@@ -28,7 +28,7 @@
 #define BUFFER 40
 #define MAXMSG 10
 
-int main()
+int mq_send_10_1()
 {
         char qname[NAMESIZE];
         char msgptr[MESSAGESIZE];
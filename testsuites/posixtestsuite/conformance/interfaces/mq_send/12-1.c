@@ -51,7 +51,7 @@ void justreturn_handler(int signo)
 	return;
 }
 
-int main()
+int mq_send_12_1()
 {
 	int pid;
         const char *msgptr = MSGSTR;
@@ -31,7 +31,7 @@ static unsigned invalidpri[NUMINVALID] = {
 };
 
 
-int main()
+int mq_send_13_1()
 {
         char qname[NAMESIZE];
         const char *msgptr = MSGSTR;
@@ -30,7 +30,7 @@ static long messagesize[NUMINVALID] = {
 };
 
 
-int main()
+int mq_send_14_1()
 {
         char qname[NAMESIZE];
         const char *msgptr = MSGSTR;
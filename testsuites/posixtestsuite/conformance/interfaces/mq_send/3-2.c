@@ -41,7 +41,7 @@
 #define BUFFER 40
 #define MAXMSG 10
 
-int main()
+int mq_send_3_2()
 {
         char qname[NAMESIZE], msgrcd[BUFFER];
         const char *msgptr1 = MSG1;
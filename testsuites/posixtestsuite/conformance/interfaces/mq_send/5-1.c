@@ -51,7 +51,7 @@ void stopsleep_handler(int signo)
 	return;
 }
 
-int main()
+int mq_send_5_1()
 {
 	int pid;
 	char msgrcd[BUFFER];
@@ -28,7 +28,7 @@
 #define BUFFER 40
 #define MAXMSG 10
 
-int main()
+int mq_send_8_1()
 {
         char qname[NAMESIZE], msgrcd[BUFFER];
         const char *msgptr = MSGSTR;
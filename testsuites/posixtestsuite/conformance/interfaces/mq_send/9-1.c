@@ -30,7 +30,7 @@
 #define BUFFER 40
 #define MAXMSG 10
 
-int main()
+int mq_send_9_1()
 {
         char qname[NAMESIZE], msgrcd[BUFFER];
         const char *msgptr = MSGSTR;
@@ -30,7 +30,7 @@
 #define NAMESIZE	50
 #define MQFLAGS		O_NONBLOCK
 
-int main()
+int mq_setattr_1_1()
 {
 	char mqname[NAMESIZE];
 	mqd_t mqdes;
@@ -31,7 +31,7 @@
 #define NAMESIZE	50
 #define MQCURMSGS	555
 
-int main()
+int mq_setattr_1_2()
 {
 	char mqname[NAMESIZE];
 	mqd_t mqdes;
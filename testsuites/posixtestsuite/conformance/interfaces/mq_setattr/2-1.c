@@ -33,7 +33,7 @@
 #define MQMSGSIZE	777
 #define MQCURMSGS	555
 
-int main()
+int mq_setattr_2_1()
 {
 	char mqname[NAMESIZE];
 	mqd_t mqdes;
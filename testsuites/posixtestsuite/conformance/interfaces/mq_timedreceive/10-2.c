@@ -34,7 +34,7 @@
 #define NAMESIZE 50
 #define BUFFER 40
 
-int main()
+int mq_timedreceive_10_2()
 {
         char mqname[NAMESIZE], msgrv[BUFFER];
         const char *msgptr = "test message";
@@ -34,7 +34,7 @@
 #define NAMESIZE 50
 #define BUFFER 40
 
-int main()
+int mq_timedreceive_11_1()
 {
         char mqname[NAMESIZE], msgrv1[BUFFER], msgrv2[BUFFER];
         const char *msgptr1 = "test message1";
@@ -34,7 +34,7 @@
 #define NAMESIZE 50
 #define BUFFER 40
 
-int main()
+int mq_timedreceive_17_2()
 {
         char mqname[NAMESIZE], msgrv[BUFFER];
         mqd_t mqdes;
@@ -43,7 +43,7 @@ void exit_handler(int signo)
 }
 
 
-int main()
+int mq_timedreceive_18_1()
 {
         char mqname[NAMESIZE], msgrv[BUFFER];
         mqd_t mqdes;
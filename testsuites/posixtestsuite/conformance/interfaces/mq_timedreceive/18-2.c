@@ -42,7 +42,7 @@ void exit_handler(int signo)
 	blocking = 1;
 	return;
 }
-int main()
+int mq_timedreceive_18_2()
 {
         char mqname[NAMESIZE], msgrv[BUFFER];
         mqd_t mqdes;
@@ -29,7 +29,7 @@
 #define NAMESIZE 50
 #define BUFFER 20
 
-int main()
+int mq_timedreceive_2_1()
 {
         char mqname[NAMESIZE], msgrv[BUFFER];
         const char *msgptr = "test message";
@@ -40,7 +40,7 @@ void exit_handler(int signo)
 	blocking = 1;
 	return;
 }
-int main()
+int mq_timedreceive_5_2()
 {
         char mqname[NAMESIZE], msgrv[BUFFER];
         mqd_t mqdes;
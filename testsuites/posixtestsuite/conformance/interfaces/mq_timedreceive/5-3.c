@@ -40,7 +40,7 @@ void stopreceive(int signo)
 {
 	return;
 }
-int main()
+int mq_timedreceive_5_3()
 {
         char mqname[NAMESIZE], msgrv[BUFFER];
         mqd_t mqdes;
@@ -38,7 +38,7 @@ void exit_handler(int signo)
 	blocking = 1;
 	return;
 }
-int main()
+int mq_timedreceive_8_1()
 {
         char mqname[NAMESIZE], msgrv[BUFFER];
         mqd_t mqdes;
@@ -29,7 +29,7 @@
 #define BUFFER 40
 #define MAXMSG 10
 
-int main()
+int mq_timedsend_1_1()
 {
         char qname[NAMESIZE], msgrcd[BUFFER];
         const char *msgptr = MSGSTR;
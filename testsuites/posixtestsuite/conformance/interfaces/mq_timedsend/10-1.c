@@ -29,7 +29,7 @@
 #define BUFFER 100
 #define MAXMSG 5
 
-int main()
+int mq_timedsend_10_1()
 {
         char qname[NAMESIZE];
         char msgptr[MESSAGESIZE];
@@ -124,7 +124,7 @@ void *a_thread_func()
 		return NULL;
 }
 
-int main()
+int mq_timedsend_12_1()
 {
         pthread_t new_th;
 	int i;
@@ -32,7 +32,7 @@ static unsigned invalidpri[NUMINVALID] = {
 };
 
 
-int main()
+int mq_timedsend_13_1()
 {
         char qname[NAMESIZE];
         const char *msgptr = MSGSTR;
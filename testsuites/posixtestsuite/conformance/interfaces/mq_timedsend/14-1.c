@@ -31,7 +31,7 @@ static long messagesize[NUMINVALID] = {
 };
 
 
-int main()
+int mq_timedsend_14_1()
 {
         char qname[NAMESIZE];
         const char *msgptr = MSGSTR;
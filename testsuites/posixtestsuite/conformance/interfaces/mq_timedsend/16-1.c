@@ -56,7 +56,7 @@ void stopsleep_handler(int signo)
 	return;
 }
 
-int main()
+int mq_timedsend_16_1()
 {
 	int pid;
 	struct mq_attr attr;
@@ -14,7 +14,7 @@
 #include <stdio.h>
 #include "posixtest.h"
 
-int main()
+int mq_timedsend_17_1()
 {
 	printf("Will not test timeout resolution.\n");
 	return PTS_UNTESTED;
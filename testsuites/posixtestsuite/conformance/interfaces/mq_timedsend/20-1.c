@@ -46,10 +46,10 @@ void testfailed_handler(int signo)
 	printf("Test FAILED\n");
 	mq_close(gqueue);
 	mq_unlink(gqname);
-	exit(PTS_FAIL);
+	return PTS_FAIL ;
 }
 
-int main()
+int mq_timedsend_20_1()
 {
         char *msgptr=MSGSTR;
 	struct timespec ts;
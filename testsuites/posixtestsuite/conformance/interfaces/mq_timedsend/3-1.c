@@ -41,7 +41,7 @@
 #define BUFFER 40
 #define MAXMSG 10
 
-int main()
+int mq_timedsend_3_1()
 {
         char qname[NAMESIZE], msgrcd[BUFFER];
         const char *msgptr1 = MSG1;
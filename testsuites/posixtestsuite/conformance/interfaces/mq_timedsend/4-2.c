@@ -24,7 +24,7 @@
 #define NAMESIZE 50
 #define MSGSTR "0123456789"
 
-int main()
+int mq_timedsend_4_2()
 {
         char qname[NAMESIZE];
         const char *msgptr = MSGSTR;
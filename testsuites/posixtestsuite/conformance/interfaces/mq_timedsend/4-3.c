@@ -30,7 +30,7 @@
 #define BUFFER 40
 #define MAXMSG 5
 
-int main()
+int mq_timedsend_4_3()
 {
         char qname[NAMESIZE], msgrcd[BUFFER];
         const char *msgptr = MSGSTR;
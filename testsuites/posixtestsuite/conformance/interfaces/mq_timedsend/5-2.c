@@ -49,7 +49,7 @@ void justreturn_handler(int signo)
 	return;
 }
 
-int main()
+int mq_timedsend_5_2()
 {
 	int pid;
         const char *msgptr = MSGSTR;
@@ -53,7 +53,7 @@ void stopsleep_handler(int signo)
 	return;
 }
 
-int main()
+int mq_timedsend_5_3()
 {
 	int pid;
 	struct mq_attr attr;
@@ -16,7 +16,7 @@
 #include <stdio.h>
 #include "posixtest.h"
 
-int main()
+int mq_timedsend_6_1()
 {
 	printf("Priority Scheduling needed to make a reliable test case\n");
 	printf("for this instance.  Will not be tested.\n");
@@ -37,7 +37,7 @@
 #define BUFFER 40
 #define MAXMSG 5
 
-int main()
+int mq_timedsend_7_1()
 {
         char qname[NAMESIZE], msgrcd[BUFFER];
         char msgptr[MESSAGESIZE];
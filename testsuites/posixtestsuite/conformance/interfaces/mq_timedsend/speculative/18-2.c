@@ -27,7 +27,7 @@
 #define NAMESIZE 50
 #define MSGSTR "0123456789"
 
-int main()
+int mq_timedsend_18_2()
 {
         char qname[NAMESIZE];
         const char *msgptr = MSGSTR;
@@ -28,7 +28,7 @@
 
 #define NAMESIZE	50
 
-int main()
+int mq_unlink_1_1()
 {
 	char mqname[NAMESIZE];
 	mqd_t mqdes;
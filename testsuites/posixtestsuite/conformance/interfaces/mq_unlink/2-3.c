@@ -15,7 +15,7 @@
 #include <stdio.h>
 #include "posixtest.h"
 
-int main()
+int mq_unlink_2_3()
 {
 	printf("Difficult to detect whether mq_unlink will block until all the reference have been closed\n");
 	printf("for this instance.  Will not be tested.\n");
@@ -26,7 +26,7 @@
 #define TEST "7-2"
 #define FUNCTION "mq_unlink"
 
-int main()
+int mq_unlink_7_2()
 {
 	char mqname[50];
 
@@ -0,0 +1,307 @@
+#ifndef _CONFORMSNCE_RUN_TEST_H
+#define _CONFORMSNCE_RUN_TEST_H
+
+extern int mq_open_1_1();
+extern int mq_open_11_1();
+extern int mq_open_12_1();
+extern int mq_open_13_1();
+extern int mq_open_15_1();
+extern int mq_open_18_1();
+extern int mq_open_19_1();
+extern int mq_open_21_1();
+extern int mq_open_22_1();
+extern int mq_open_23_1();
+extern int mq_open_25_2();
+extern int mq_open_27_1();
+extern int mq_open_27_2();
+extern int mq_open_28_1();
+extern int mq_open_29_1();
+extern int mq_open_3_1();
+extern int mq_open_7_1();
+extern int mq_open_7_3();
+extern int mq_open_8_1();
+extern int mq_open_9_1();
+extern int mq_open_2_2();
+extern int mq_open_2_3();
+extern int mq_open_26_1();
+extern int mq_open_6_1();
+extern int mq_close_1_1();
+extern int mq_close_3_1();
+extern int mq_close_3_2();
+extern int mq_close_3_3();
+extern int mq_unlink_1_1();
+extern int mq_unlink_7_1();
+extern int mq_unlink_7_2();
+extern int mq_send_1_1();
+extern int mq_send_10_1();
+extern int mq_send_11_1();
+extern int mq_send_11_2();
+extern int mq_send_13_1();
+extern int mq_send_14_1();
+extern int mq_send_2_1();
+extern int mq_send_3_1();
+extern int mq_send_3_2();
+extern int mq_send_4_1();
+extern int mq_send_4_2();
+extern int mq_send_4_3();
+extern int mq_send_7_1();
+extern int mq_send_8_1();
+extern int mq_send_9_1();
+extern int mq_timedsend_1_1();
+extern int mq_timedsend_10_1();
+extern int mq_timedsend_11_1();
+extern int mq_timedsend_11_2();
+extern int mq_timedsend_13_1();
+extern int mq_timedsend_14_1();
+extern int mq_timedsend_18_1();
+extern int mq_timedsend_19_1();
+extern int mq_timedsend_2_1();
+extern int mq_timedsend_3_1();
+extern int mq_timedsend_3_2();
+extern int mq_timedsend_4_1();
+extern int mq_timedsend_4_2();
+extern int mq_timedsend_4_3();
+extern int mq_timedsend_7_1();
+extern int mq_timedsend_8_1();
+extern int mq_timedsend_9_1();
+extern int mq_timedsend_18_2();
+extern int mq_receive_1_1();
+extern int mq_receive_10_1();
+extern int mq_receive_11_1();
+extern int mq_receive_11_2();
+extern int mq_receive_12_1();
+extern int mq_receive_2_1();
+extern int mq_receive_7_1();
+extern int mq_receive_8_1();
+extern int mq_timedreceive_1_1();
+extern int mq_timedreceive_10_1();
+extern int mq_timedreceive_11_1();
+extern int mq_timedreceive_13_1();
+extern int mq_timedreceive_14_1();
+extern int mq_timedreceive_15_1();
+extern int mq_timedreceive_17_1();
+extern int mq_timedreceive_17_2();
+extern int mq_timedreceive_17_3();
+extern int mq_timedreceive_2_1();
+extern int mq_timedreceive_7_1();
+extern int mq_timedreceive_10_2();
+extern int mq_getattr_2_1();
+extern int mq_getattr_2_2();
+extern int mq_getattr_3_1();
+extern int mq_getattr_4_1();
+extern int mq_getattr_7_1();
+extern int mq_setattr_1_1();
+extern int mq_setattr_1_2();
+extern int mq_setattr_2_1();
+extern int mq_setattr_5_1();
+
+typedef int test_run_main();
+test_run_main *run_test_arry_1[] = {
+    mq_open_1_1,
+    mq_open_11_1,
+    mq_open_12_1,
+    mq_open_13_1,
+    mq_open_15_1,
+    mq_open_18_1,
+    mq_open_19_1,
+    mq_open_21_1,
+    mq_open_22_1,
+    mq_open_23_1,
+    mq_open_25_2,
+    mq_open_27_1,
+    mq_open_27_2,
+    mq_open_28_1,
+    mq_open_29_1,
+    mq_open_3_1,
+    mq_open_7_1,
+    mq_open_7_3,
+    mq_open_8_1,
+    mq_open_9_1,
+    mq_open_2_2,
+    mq_open_2_3,
+    mq_open_26_1,
+    mq_open_6_1,
+
+    mq_close_1_1,
+    mq_close_3_1,
+    mq_close_3_2,
+    mq_close_3_3,
+
+    mq_unlink_1_1,
+    mq_unlink_7_1,
+    mq_unlink_7_2,
+
+    mq_send_1_1,
+    mq_send_10_1,
+    mq_send_11_1,
+    mq_send_11_2,
+    mq_send_13_1,
+    mq_send_14_1,
+    mq_send_2_1,
+    mq_send_3_1,
+    mq_send_3_2,
+    mq_send_4_1,
+    mq_send_4_2,
+    mq_send_4_3,
+    mq_send_7_1,
+    mq_send_8_1,
+    mq_send_9_1,
+
+    mq_timedsend_1_1,
+    mq_timedsend_10_1,
+    mq_timedsend_11_1,
+    mq_timedsend_11_2,
+    mq_timedsend_13_1,
+    mq_timedsend_14_1,
+    mq_timedsend_18_1,
+    mq_timedsend_19_1,
+    mq_timedsend_2_1,
+    mq_timedsend_3_1,
+    mq_timedsend_3_2,
+    mq_timedsend_4_1,
+    mq_timedsend_4_2,
+    mq_timedsend_4_3,
+    mq_timedsend_7_1,
+    mq_timedsend_8_1,
+    mq_timedsend_9_1,
+    mq_timedsend_18_2,
+
+    mq_receive_1_1,
+    mq_receive_10_1,
+    mq_receive_11_1,
+    mq_receive_11_2,
+    mq_receive_12_1,
+    mq_receive_2_1,
+    mq_receive_7_1,
+    mq_receive_8_1,
+
+    mq_timedreceive_1_1,
+    mq_timedreceive_10_1,
+    mq_timedreceive_11_1,
+    mq_timedreceive_13_1,
+    mq_timedreceive_14_1,
+    mq_timedreceive_15_1,
+    mq_timedreceive_17_1,
+    mq_timedreceive_17_2,
+    mq_timedreceive_17_3,
+    mq_timedreceive_2_1,
+    mq_timedreceive_7_1,
+    mq_timedreceive_10_2,
+
+    mq_getattr_2_1,
+    mq_getattr_2_2,
+    mq_getattr_3_1,
+    mq_getattr_4_1,
+    mq_getattr_7_1,
+
+    mq_setattr_1_1,
+    mq_setattr_1_2,
+    mq_setattr_2_1,
+    mq_setattr_5_1,
+};
+
+char run_test_name_1[][50] = {
+    "mq_open_1_1",
+    "mq_open_11_1",
+    "mq_open_12_1",
+    "mq_open_13_1",
+    "mq_open_15_1",
+    "mq_open_18_1",
+    "mq_open_19_1",
+    "mq_open_21_1",
+    "mq_open_22_1",
+    "mq_open_23_1",
+    "mq_open_25_2",
+    "mq_open_27_1",
+    "mq_open_27_2",
+    "mq_open_28_1",
+    "mq_open_29_1",
+    "mq_open_3_1",
+    "mq_open_7_1",
+    "mq_open_7_3",
+    "mq_open_8_1",
+    "mq_open_9_1",
+    "mq_open_2_2",
+    "mq_open_2_3",
+    "mq_open_26_1",
+    "mq_open_6_1",
+
+    "mq_close_1_1",
+    "mq_close_3_1",
+    "mq_close_3_2",
+    "mq_close_3_3",
+
+    "mq_unlink_1_1",
+    "mq_unlink_7_1",
+    "mq_unlink_7_2",
+
+    "mq_send_1_1",
+    "mq_send_10_1",
+    "mq_send_11_1",
+    "mq_send_11_2",
+    "mq_send_13_1",
+    "mq_send_14_1",
+    "mq_send_2_1",
+    "mq_send_3_1",
+    "mq_send_3_2",
+    "mq_send_4_1",
+    "mq_send_4_2",
+    "mq_send_4_3",
+    "mq_send_7_1",
+    "mq_send_8_1",
+    "mq_send_9_1",
+
+    "mq_timedsend_1_1",
+    "mq_timedsend_10_1",
+    "mq_timedsend_11_1",
+    "mq_timedsend_11_2",
+    "mq_timedsend_13_1",
+    "mq_timedsend_14_1",
+    "mq_timedsend_18_1",
+    "mq_timedsend_19_1",
+    "mq_timedsend_2_1",
+    "mq_timedsend_3_1",
+    "mq_timedsend_3_2",
+    "mq_timedsend_4_1",
+    "mq_timedsend_4_2",
+    "mq_timedsend_4_3",
+    "mq_timedsend_7_1",
+    "mq_timedsend_8_1",
+    "mq_timedsend_9_1",
+    "mq_timedsend_18_2",
+
+    "mq_receive_1_1",
+    "mq_receive_10_1",
+    "mq_receive_11_1",
+    "mq_receive_11_2",
+    "mq_receive_12_1",
+    "mq_receive_2_1",
+    "mq_receive_7_1",
+    "mq_receive_8_1",
+
+    "mq_timedreceive_1_1",
+    "mq_timedreceive_10_1",
+    "mq_timedreceive_11_1",
+    "mq_timedreceive_13_1",
+    "mq_timedreceive_14_1",
+    "mq_timedreceive_15_1",
+    "mq_timedreceive_17_1",
+    "mq_timedreceive_17_2",
+    "mq_timedreceive_17_3",
+    "mq_timedreceive_2_1",
+    "mq_timedreceive_7_1",
+    "mq_timedreceive_10_2",
+
+    "mq_getattr_2_1",
+    "mq_getattr_2_2",
+    "mq_getattr_3_1",
+    "mq_getattr_4_1",
+    "mq_getattr_7_1",
+
+    "mq_setattr_1_1",
+    "mq_setattr_1_2",
+    "mq_setattr_2_1",
+    "mq_setattr_5_1",
+};
+
+#endif
\ No newline at end of file
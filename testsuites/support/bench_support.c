@@ -0,0 +1,41 @@
+/*
+ * Copyright (c) 2023-2023 Huawei Technologies Co., Ltd. All rights reserved.
+ *
+ * UniProton is licensed under Mulan PSL v2.
+ * You can use this software according to the terms and conditions of the Mulan PSL v2.
+ * You may obtain a copy of Mulan PSL v2 at:
+ *          http://license.coscl.org.cn/MulanPSL2
+ * THIS SOFTWARE IS PROVIDED ON AN "AS IS" BASIS, WITHOUT WARRANTIES OF ANY KIND,
+ * EITHER EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO NON-INFRINGEMENT,
+ * MERCHANTABILITY OR FIT FOR A PARTICULAR PURPOSE.
+ * See the Mulan PSL v2 for more details.
+ * Create: 2023-06-01
+ * Description: 性能测试公共函数
+ */
+#include <stdio.h>
+#include "bench_support.h"
+
+static U32 g_benchSeed = 0x2023U;
+
+U32 BenchRand(void)
+{
+    g_benchSeed = g_benchSeed * 1103515245U + 12345U;
+    return g_benchSeed >> 8;
+}
+
+void BenchStatRecord(struct BenchStat *stat, U64 cycle)
+{
+    if (cycle > stat->max) {
+        stat->max = cycle;
+    }
+    stat->total += cycle;
+    stat->count++;
+}
+
+void BenchStatShow(const char *name, const struct BenchStat *stat)
+{
+    U32 avg = (stat->count == 0) ? 0 : (U32)(stat->total / stat->count);
+
+    printf("%s: count %u, max %u cycles, avg %u cycles, fail %u\n", name, stat->count, (U32)stat->max, avg,
+        stat->fail);
+}
@@ -0,0 +1,33 @@
+/*
+ * Copyright (c) 2023-2023 Huawei Technologies Co., Ltd. All rights reserved.
+ *
+ * UniProton is licensed under Mulan PSL v2.
+ * You can use this software according to the terms and conditions of the Mulan PSL v2.
+ * You may obtain a copy of Mulan PSL v2 at:
+ *          http://license.coscl.org.cn/MulanPSL2
+ * THIS SOFTWARE IS PROVIDED ON AN "AS IS" BASIS, WITHOUT WARRANTIES OF ANY KIND,
+ * EITHER EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO NON-INFRINGEMENT,
+ * MERCHANTABILITY OR FIT FOR A PARTICULAR PURPOSE.
+ * See the Mulan PSL v2 for more details.
+ * Create: 2023-06-01
+ * Description: 性能测试公共函数头文件
+ */
+#ifndef BENCH_SUPPORT_H
+#define BENCH_SUPPORT_H
+
+#include "prt_typedef.h"
+
+/* 单项测试的cycle数统计 */
+struct BenchStat {
+    U64 max;
+    U64 total;
+    U32 count;
+    U32 fail;
+};
+
+/* 固定种子的线性同余伪随机数，各次运行的测试序列相同，便于对比不同配置的结果 */
+extern U32 BenchRand(void);
+extern void BenchStatRecord(struct BenchStat *stat, U64 cycle);
+extern void BenchStatShow(const char *name, const struct BenchStat *stat);
+
+#endif /* BENCH_SUPPORT_H */
@@ -77,7 +77,17 @@ interfaceList = [ "pthread_attr_init",
                   "timer_settime",
                   "timer_gettime",
                   "malloc",
-                  "free" ]
+                  "free",
+                  "mq_open",
+                  "mq_close",
+                  "mq_unlink",
+                  "mq_send",
+                  "mq_timedsend",
+                  "mq_receive",
+                  "mq_timedreceive",
+                  "mq_getattr",
+                  "mq_setattr",
+                  "mq_notify" ]
 
 def get_all_c_file(interfacePath):
     ret_files = []
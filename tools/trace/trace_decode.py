@@ -0,0 +1,243 @@
+#!/usr/bin/env python3
+# coding=utf-8
+# Decode UniProton binary trace buffers (PRT_TraceBufGet) into Chrome trace / Perfetto JSON.
+# Copyright © Huawei Technologies Co., Ltd. 2010-2020. All rights reserved.
+
+import sys
+import json
+import struct
+import argparse
+
+# 与prt_trace.h保持一致
+TRACE_MAGIC = 0x45435254
+TRACE_VERSION = 1
+TRACE_DELTA_BITS = 24
+TRACE_DELTA_MAX = (1 << TRACE_DELTA_BITS) - 1
+TRACE_MODE_NAME = {0: "overwrite", 1: "stop"}
+
+HEAD_FORMAT = "IHHIIIIQQQ"
+RECORD_FORMAT = "IIII"
+
+EVENT_TIME = 0
+EVENT_TASK_SWITCH = 1
+EVENT_TASK_READY = 2
+EVENT_TASK_BLOCK = 3
+EVENT_HWI_ENTRY = 4
+EVENT_HWI_EXIT = 5
+EVENT_SEM_PEND = 6
+EVENT_SEM_POST = 7
+EVENT_MUTEX_PEND = 8
+EVENT_MUTEX_POST = 9
+EVENT_QUEUE_READ = 10
+EVENT_QUEUE_WRITE = 11
+EVENT_MEM_ALLOC = 12
+EVENT_MEM_FREE = 13
+EVENT_TIMER_EXPIRE = 14
+
+# 中断及任务未知时的事件所在的线程号，不与任务PID冲突
+HWI_TID = 0x7fffffff
+UNKNOWN_TID = 0x7ffffffe
+
+
+def addr_of(lo, hi):
+    return "0x%x" % ((hi << 32) | lo)
+
+
+# 在当前上下文上记录的瞬时事件: 事件号 -> (名称, 参数生成函数)
+INSTANT_EVENTS = {
+    EVENT_SEM_PEND: ("sem pend", lambda a: {"handle": a[0], "timeout": a[1], "blocked": a[2]}),
+    EVENT_SEM_POST: ("sem post", lambda a: {"handle": a[0], "wakeup": a[1]}),
+    EVENT_MUTEX_PEND: ("mutex pend", lambda a: {"handle": a[0], "timeout": a[1], "blocked": a[2]}),
+    EVENT_MUTEX_POST: ("mutex post", lambda a: {"handle": a[0], "wakeup": a[1]}),
+    EVENT_QUEUE_READ: ("queue read", lambda a: {"queue": a[0], "timeout": a[1], "len": a[2]}),
+    EVENT_QUEUE_WRITE: ("queue write", lambda a: {"queue": a[0], "timeout": a[1], "len": a[2]}),
+    EVENT_MEM_ALLOC: ("mem alloc", lambda a: {"size": a[0], "addr": addr_of(a[1], a[2])}),
+    EVENT_MEM_FREE: ("mem free", lambda a: {"addr": addr_of(a[1], a[2])}),
+    EVENT_TIMER_EXPIRE: ("timer expire", lambda a: {"timer": a[0]}),
+}
+
+
+class TraceBuf:
+    def __init__(self, head, records):
+        (self.magic, self.version, self.core_id, self.record_num, self.mode, self.write_idx,
+         self.lost, self.write_count, self.last_cycle, self.cycle_per_sec) = head
+        self.records = records
+
+    # 按写入顺序返回(cycle, 事件号, 参数)，从最后一条记录的cycle数倒推每条记录的时间
+    def events(self):
+        num = min(self.write_count, self.record_num)
+        start = (self.write_idx - num) % self.record_num if self.record_num else 0
+        ordered = [self.records[(start + i) % self.record_num] for i in range(num)]
+
+        result = []
+        cycle = self.last_cycle
+        for info, arg0, arg1, arg2 in reversed(ordered):
+            event = info >> TRACE_DELTA_BITS
+            result.append((cycle, event, (arg0, arg1, arg2)))
+            if event == EVENT_TIME:
+                cycle -= (arg1 << 32) | arg0
+            else:
+                cycle -= info & TRACE_DELTA_MAX
+        result.reverse()
+        return result
+
+
+def parse_bufs(data, fmt_prefix, name):
+    head_size = struct.calcsize(fmt_prefix + HEAD_FORMAT)
+    record_size = struct.calcsize(fmt_prefix + RECORD_FORMAT)
+    bufs = []
+    offset = 0
+
+    # 一个文件中可以顺序存放多个核的缓冲区
+    while offset + head_size <= len(data):
+        head = struct.unpack_from(fmt_prefix + HEAD_FORMAT, data, offset)
+        if head[0] != TRACE_MAGIC:
+            if not bufs:
+                raise ValueError("%s: bad magic 0x%08x at offset %d" % (name, head[0], offset))
+            break
+        if head[1] != TRACE_VERSION:
+            raise ValueError("%s: unsupported trace version %d" % (name, head[1]))
+
+        record_num = head[3]
+        body = offset + head_size
+        if body + record_num * record_size > len(data):
+            raise ValueError("%s: truncated buffer of core %d" % (name, head[2]))
+        records = [struct.unpack_from(fmt_prefix + RECORD_FORMAT, data, body + i * record_size)
+                   for i in range(record_num)]
+        bufs.append(TraceBuf(head, records))
+        offset = body + record_num * record_size
+
+    return bufs
+
+
+class ChromeTrace:
+    def __init__(self, base_cycle, task_names):
+        self.base_cycle = base_cycle
+        self.task_names = task_names
+        self.events = []
+
+    def ts(self, buf, cycle):
+        return (cycle - self.base_cycle) * 1000000.0 / buf.cycle_per_sec
+
+    def add(self, ph, buf, cycle, tid, name, args=None):
+        event = {"ph": ph, "pid": buf.core_id, "tid": tid, "ts": self.ts(buf, cycle), "name": name}
+        if ph == "i":
+            event["s"] = "t"
+        if args:
+            event["args"] = args
+        self.events.append(event)
+
+    def meta(self, pid, tid, key, value):
+        event = {"ph": "M", "pid": pid, "name": key, "args": {"name": value}}
+        if tid is not None:
+            event["tid"] = tid
+        self.events.append(event)
+
+    def task_name(self, pid):
+        return self.task_names.get(pid, "task 0x%x" % pid)
+
+    def convert(self, buf):
+        running = None
+        hwi_stack = []
+        tids = set()
+        last_cycle = None
+
+        for cycle, event, args in buf.events():
+            last_cycle = cycle
+            if event == EVENT_TIME:
+                continue
+
+            if event == EVENT_TASK_SWITCH:
+                prev_pid, next_pid = args[0], args[1]
+                # 窗口开始前已在运行的任务没有开始时间，不输出结束事件
+                if running is not None:
+                    self.add("E", buf, cycle, running, self.task_name(running))
+                self.add("B", buf, cycle, next_pid, self.task_name(next_pid))
+                tids.update((prev_pid, next_pid))
+                running = next_pid
+            elif event in (EVENT_TASK_READY, EVENT_TASK_BLOCK):
+                name = "ready" if event == EVENT_TASK_READY else "block"
+                self.add("i", buf, cycle, args[0], name)
+                tids.add(args[0])
+            elif event == EVENT_HWI_ENTRY:
+                self.add("B", buf, cycle, HWI_TID, "hwi %d" % args[0])
+                hwi_stack.append(args[0])
+            elif event == EVENT_HWI_EXIT:
+                # 窗口开始时已在处理的中断只有退出事件，忽略
+                if hwi_stack:
+                    self.add("E", buf, cycle, HWI_TID, "hwi %d" % hwi_stack.pop())
+            else:
+                if hwi_stack:
+                    tid = HWI_TID
+                elif running is not None:
+                    tid = running
+                else:
+                    tid = UNKNOWN_TID
+                name, make_args = INSTANT_EVENTS.get(event, ("event %d" % event, lambda a: {"args": list(a)}))
+                self.add("i", buf, cycle, tid, name, make_args(args))
+
+        # 窗口结束时仍未结束的切片在最后一条记录处结束
+        if last_cycle is not None:
+            while hwi_stack:
+                self.add("E", buf, last_cycle, HWI_TID, "hwi %d" % hwi_stack.pop())
+            if running is not None:
+                self.add("E", buf, last_cycle, running, self.task_name(running))
+
+        self.meta(buf.core_id, None, "process_name", "core %d" % buf.core_id)
+        self.meta(buf.core_id, HWI_TID, "thread_name", "hwi")
+        self.meta(buf.core_id, UNKNOWN_TID, "thread_name", "unknown")
+        for pid in sorted(tids):
+            self.meta(buf.core_id, pid, "thread_name", self.task_name(pid))
+
+
+def parse_task_names(items):
+    names = {}
+    for item in items:
+        pid, _, name = item.partition("=")
+        if not name:
+            raise ValueError("bad task name '%s', expect PID=NAME" % item)
+        names[int(pid, 0)] = name
+    return names
+
+
+def main():
+    parser = argparse.ArgumentParser(description="Decode UniProton binary trace buffers into Chrome trace JSON, "
+                                     "which can be opened by chrome://tracing or ui.perfetto.dev.")
+    parser.add_argument("dump", nargs="+", help="raw trace buffer dumped from PRT_TraceBufGet, one or more cores")
+    parser.add_argument("-o", "--output", help="output json file, default stdout")
+    parser.add_argument("-n", "--task-name", action="append", default=[], metavar="PID=NAME",
+                        help="name of a task shown in the trace, can be repeated")
+    parser.add_argument("--big-endian", action="store_true", help="trace buffer is big endian")
+    args = parser.parse_args()
+
+    fmt_prefix = ">" if args.big_endian else "<"
+    bufs = []
+    try:
+        for path in args.dump:
+            with open(path, "rb") as f:
+                bufs.extend(parse_bufs(f.read(), fmt_prefix, path))
+        task_names = parse_task_names(args.task_name)
+    except (OSError, ValueError) as e:
+        sys.stderr.write("trace_decode: %s\n" % e)
+        return 1
+
+    # 各核cycle计数同源时以最早的记录对齐
+    first = [buf.events()[0][0] for buf in bufs if min(buf.write_count, buf.record_num) > 0]
+    trace = ChromeTrace(min(first) if first else 0, task_names)
+    other = {}
+    for buf in bufs:
+        trace.convert(buf)
+        other["core %d" % buf.core_id] = {"mode": TRACE_MODE_NAME.get(buf.mode, buf.mode),
+                                          "records": buf.write_count, "lost": buf.lost}
+
+    result = {"traceEvents": trace.events, "displayTimeUnit": "ns", "otherData": other}
+    if args.output:
+        with open(args.output, "w") as f:
+            json.dump(result, f)
+    else:
+        json.dump(result, sys.stdout)
+    return 0
+
+
+if __name__ == "__main__":
+    sys.exit(main())